@@ -23,10 +23,13 @@
 #pragma once
 
 #include <dwg/ACadVersion.h>
+#include <dwg/CadHandleIndex.h>
+#include <dwg/CadStringPool.h>
 #include <dwg/IHandledCadObject.h>
 #include <dwg/entities/Entity.h>
 #include <dwg/exports.h>
-#include <map>
+#include <memory>
+#include <memory_resource>
 #include <string>
 
 namespace dwg {
@@ -62,6 +65,10 @@ public:
     CadDocument();
     CadDocument(ACadVersion version);
     CadDocument(bool createDefaults);
+    /// \brief Deletes the document and every object registered in it.
+    /// \details The document owns the tables, entries, blocks, entities and objects added to it,
+    /// they are deleted before the memory resource is released. An object removed from the
+    /// document is no longer deleted with it.
     ~CadDocument();
 
     void createDefaults();
@@ -69,6 +76,16 @@ public:
 
     unsigned long long handle() const override;
 
+    /// \brief Object of the document with the handle, nullptr if there is none.
+    /// \details The document itself is found under the handle 0.
+    IHandledCadObject *getCadObject(unsigned long long handle) const;
+
+    template<typename T>
+    T *getCadObjectT(unsigned long long handle) const
+    {
+        return dynamic_cast<T *>(getCadObject(handle));
+    }
+
     CadHeader *header() const;
     void setHeader(CadHeader *);
 
@@ -105,6 +122,16 @@ public:
     void registerCollection(IObservableCadCollection *);
     void unregisterCollection(IObservableCadCollection *);
 
+    /// Takes the next handle from the handle seed of the header.
+    unsigned long long reserveHandle();
+
+    /// Names of the table entries in the document, each distinct name is stored once.
+    CadStringPool &stringPool();
+
+    /// Resource the objects of the document were read into, released with the document.
+    std::shared_ptr<std::pmr::memory_resource> memoryResource() const;
+    void setMemoryResource(const std::shared_ptr<std::pmr::memory_resource> &);
+
 protected:
     void setRootDictionary(CadDictionary *dic);
 
@@ -114,6 +141,7 @@ protected:
 
 private:
     void onAdd(CadObject *);
+    void onAddRange(const std::vector<CadObject *> &);
     void onRemove(CadObject *);
 
 private:
@@ -141,7 +169,9 @@ private:
     MLeaderStyleCollection *_mleaderStyles = nullptr;
     DxfClassCollection *_classes = nullptr;
 
-    std::map<unsigned long long, IHandledCadObject *> _cadObjects;
+    CadHandleIndex _cadObjects;
+    CadStringPool _stringPool;
+    std::shared_ptr<std::pmr::memory_resource> _memoryResource;
 };
 
 }// namespace dwg
@@ -0,0 +1,75 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <dwg/exports.h>
+#include <vector>
+
+namespace dwg {
+
+class IHandledCadObject;
+
+/// \brief Objects of a document by handle, a flat open addressing table with linear probing.
+/// \details A lookup is a multiplicative hash and a scan of adjacent slots, an insert does not
+/// allocate until the table grows. Removals shift the following entries back, so the table never
+/// holds tombstones.
+class LIBDWG_API CadHandleIndex
+{
+public:
+    CadHandleIndex();
+
+    /// Object with the handle, nullptr if there is none.
+    IHandledCadObject *find(unsigned long long handle) const;
+    bool contains(unsigned long long handle) const;
+
+    /// Adds the object, false if the handle is already in the index.
+    bool insert(unsigned long long handle, IHandledCadObject *object);
+    bool remove(unsigned long long handle);
+
+    void reserve(std::size_t count);
+    void clear();
+    std::size_t size() const;
+
+    /// Objects of the index, in no particular order.
+    std::vector<IHandledCadObject *> objects() const;
+
+private:
+    struct Slot
+    {
+        unsigned long long handle = 0;
+        IHandledCadObject *object = nullptr;
+    };
+
+    std::size_t indexOf(unsigned long long handle) const;
+    void rehash(std::size_t capacity);
+
+private:
+    static constexpr std::size_t MinCapacity = 64;
+
+    std::vector<Slot> _slots;
+    std::size_t _mask;
+    std::size_t _size;
+};
+
+}// namespace dwg
@@ -0,0 +1,65 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace dwg {
+
+/// \brief Memory resources used by the objects and templates created in the current thread.
+/// \details Readers open a scope around the parsing of a file so the objects are allocated from the
+/// document pool and the templates from the reader one. Out of any scope the global heap is used.
+/// The resources of a scope are pools of createPool. The pools take their memory in aligned regions
+/// and map each region to the pool without a lock, so a block is released to its pool without a
+/// header in front of it, and a heap block is told apart with two loads.
+class CadMemoryScope
+{
+public:
+    CadMemoryScope(std::pmr::memory_resource *objects, std::pmr::memory_resource *templates);
+    ~CadMemoryScope();
+
+    static std::pmr::memory_resource *objectResource();
+    static std::pmr::memory_resource *templateResource();
+
+    /// Thread safe pool that takes its chunks from \c upstream, the default resource if it is null.
+    static std::shared_ptr<std::pmr::memory_resource>
+            createPool(const std::shared_ptr<std::pmr::memory_resource> &upstream = nullptr);
+
+    /// Allocates a block from a pool of createPool, a null resource uses the global heap.
+    static void *allocate(std::size_t size, std::pmr::memory_resource *resource);
+
+    /// Releases a block of allocate(), size is the one requested on allocation.
+    static void deallocate(void *ptr, std::size_t size);
+
+private:
+    CadMemoryScope(const CadMemoryScope &) = delete;
+    CadMemoryScope &operator=(const CadMemoryScope &) = delete;
+
+private:
+    std::pmr::memory_resource *_previousObjects;
+    std::pmr::memory_resource *_previousTemplates;
+};
+
+}// namespace dwg
\ No newline at end of file
@@ -0,0 +1,85 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <dwg/exports.h>
+#include <string_view>
+#include <vector>
+
+namespace dwg {
+
+class CadObject;
+
+/// \brief Objects of a collection by name, case-insensitive for ASCII letters.
+/// \details A flat open addressing table with linear probing. Every slot keeps the hash of its
+/// folded name, so probes compare hashes before names and growing the table never hashes a name
+/// again. The slots view the names they were added with instead of copying them, the caller keeps
+/// those strings alive, typically interned in a CadStringPool, until the name is removed or renamed.
+/// Lookups fold both sides on the fly.
+class LIBDWG_API CadNameIndex
+{
+public:
+    CadNameIndex();
+
+    /// Object with the name, nullptr if there is none.
+    CadObject *find(std::string_view name) const;
+    bool contains(std::string_view name) const;
+
+    /// Adds the object under a view of the name, false if the name is already in the index.
+    bool insert(std::string_view name, CadObject *object);
+    bool remove(std::string_view name);
+    /// Moves the object to a view of the new name, false if the old name is missing or the new one is taken.
+    bool rename(std::string_view oldName, std::string_view newName);
+
+    void reserve(std::size_t count);
+    void clear();
+    std::size_t size() const;
+
+    /// Hash of the name with the ASCII letters folded to lower case.
+    static std::size_t hash(std::string_view name);
+    /// Ordinal comparison with the ASCII letters folded to lower case.
+    static bool equals(std::string_view a, std::string_view b);
+    static bool less(std::string_view a, std::string_view b);
+
+private:
+    struct Slot
+    {
+        std::size_t hash = 0;
+        std::string_view name;
+        CadObject *object = nullptr;
+    };
+
+    std::size_t slotOf(std::string_view name, std::size_t hash) const;
+    void erase(std::size_t index);
+    void rehash(std::size_t capacity);
+
+private:
+    static constexpr std::size_t MinCapacity = 8;
+
+    std::vector<Slot> _slots;
+    std::size_t _mask;
+    std::size_t _size;
+};
+
+}// namespace dwg
@@ -22,11 +22,14 @@
 
 #pragma once
 
+#include <dwg/CadObjectCast.h>
 #include <dwg/IHandledCadObject.h>
 #include <dwg/ObjectType.h>
 #include <dwg/Registrar.h>
 #include <dwg/exports.h>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dwg {
@@ -38,6 +41,7 @@ class CadDictionary;
 class ExtendedDataDictionary;
 class NonGraphicalObject;
 class TableEntry;
+struct CadObjectExtension;
 
 class LIBDWG_API CadObject : public IHandledCadObject
 {
@@ -46,19 +50,26 @@ protected:
     unsigned long long _handle = 0x0;
     IHandledCadObject *_owner = nullptr;
     CadDocument *_document = nullptr;
-    ExtendedDataDictionary *_extendedData = nullptr;
-    CadDictionary *_xdictionary = nullptr;
-    std::vector<CadObject *> _reactors;
+    /// Rarely used members, see CadObjectExtension, null until one of them is set.
+    CadObjectExtension *_extension = nullptr;
 
 public:
     CadObject();
     virtual ~CadObject();
 
-    virtual ObjectType objectType() const = 0;
-    virtual std::string objectName() const = 0;
-    virtual std::string subclassMarker() const = 0;
+    /// Objects are allocated from the memory resource of the reader scope, see CadMemoryScope.
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size);
 
-    ExtendedDataDictionary *extendedData() const;
+    virtual ObjectType objectType() const = 0;
+    virtual std::string_view objectName() const = 0;
+    virtual std::string_view subclassMarker() const = 0;
+
+    /// Extended data of the object, created on first access.
+    ExtendedDataDictionary *extendedData();
+    /// Extended data of the object, nullptr if it has never been created.
+    const ExtendedDataDictionary *extendedData() const;
+    bool hasExtendedData() const;
     unsigned long long handle() const override;
     IHandledCadObject *owner() const;
     CadDictionary *xdictionary() const;
@@ -86,6 +97,11 @@ public:
     virtual void assignDocument(CadDocument *doc);
     virtual void unassignDocument();
 
+protected:
+    CadObjectExtension *extension();
+
+public:
+
     NonGraphicalObject *updateCollection(NonGraphicalObject *entry, ObjectDictionaryCollection *collection);
     template<typename T>
     T updateCollectionT(T entry, ObjectDictionaryCollection *collection)
@@ -94,7 +110,7 @@ public:
         static_assert(std::is_base_of<NonGraphicalObject, std::remove_pointer_t<T>>::value,
                       "T must point to a type derived from NonGraphicalObject.");
         NonGraphicalObject *existing = updateCollection(entry, collection);
-        return dynamic_cast<T>(existing);
+        return object_cast<std::remove_pointer_t<T>>(existing);
     }
 
     TableEntry *updateTable(TableEntry *entry, Table *table);
@@ -106,7 +122,7 @@ public:
                       "T must point to a type derived from TableEntry.");
 
         TableEntry *existing = updateTable(entry, table);
-        return dynamic_cast<T>(existing);
+        return object_cast<std::remove_pointer_t<T>>(existing);
     }
 
 private:
@@ -0,0 +1,233 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <dwg/ObjectType.h>
+#include <type_traits>
+
+namespace dwg {
+
+class AcdbPlaceHolder;
+class AppId;
+class AppIdsTable;
+class Arc;
+class AttributeBase;
+class AttributeDefinition;
+class AttributeEntity;
+class Block;
+class BlockEnd;
+class BlockRecord;
+class BlockRecordsTable;
+class CadDictionary;
+class Circle;
+class Dimension;
+class DimensionAligned;
+class DimensionAngular2Line;
+class DimensionAngular3Pt;
+class DimensionDiameter;
+class DimensionLinear;
+class DimensionOrdinate;
+class DimensionRadius;
+class DimensionStyle;
+class DimensionStylesTable;
+class Ellipse;
+class Face3D;
+class Group;
+class Hatch;
+class Insert;
+class Layer;
+class LayersTable;
+class Layout;
+class Leader;
+class Line;
+class LineType;
+class LineTypesTable;
+class LwPolyline;
+class MLine;
+class MLineStyle;
+class MText;
+class PlotSettings;
+class Point;
+class PolyfaceMesh;
+class Polyline;
+class Polyline2D;
+class Polyline3D;
+class Ray;
+class Seqend;
+class Shape;
+class Solid;
+class Solid3D;
+class Spline;
+class TextEntity;
+class TextStyle;
+class TextStylesTable;
+class Tolerance;
+class UCS;
+class UCSTable;
+class VPort;
+class VPortsTable;
+class Vertex;
+class Vertex2D;
+class Vertex3D;
+class VertexFaceMesh;
+class VertexFaceRecord;
+class View;
+class ViewsTable;
+class Viewport;
+class XLine;
+class XRecord;
+
+/// \brief Object types reported by a class and by every class derived from it.
+/// \details Only classes whose whole hierarchy reports listed types are specialized, the others
+/// are cast with dynamic_cast.
+template<typename T>
+struct CadObjectTypes
+{
+    static constexpr bool tagged = false;
+};
+
+template<ObjectType... Types>
+struct CadObjectTypeSet
+{
+    static constexpr bool tagged = true;
+
+    static constexpr bool contains(ObjectType type)
+    {
+        return ((type == Types) || ...);
+    }
+};
+
+/// Types shared by unrelated classes, an object reporting one of them is checked with dynamic_cast.
+constexpr bool isSharedObjectType(ObjectType type)
+{
+    return type == ObjectType::UNLISTED || type == ObjectType::INVALID || type == ObjectType::UNDEFINED;
+}
+
+// clang-format off
+template<> struct CadObjectTypes<Arc> : CadObjectTypeSet<ObjectType::ARC> {};
+template<> struct CadObjectTypes<Circle> : CadObjectTypeSet<ObjectType::CIRCLE, ObjectType::ARC> {};
+template<> struct CadObjectTypes<Ellipse> : CadObjectTypeSet<ObjectType::ELLIPSE> {};
+template<> struct CadObjectTypes<Face3D> : CadObjectTypeSet<ObjectType::FACE3D> {};
+template<> struct CadObjectTypes<Hatch> : CadObjectTypeSet<ObjectType::HATCH> {};
+template<> struct CadObjectTypes<Insert> : CadObjectTypeSet<ObjectType::INSERT, ObjectType::MINSERT> {};
+template<> struct CadObjectTypes<Leader> : CadObjectTypeSet<ObjectType::LEADER> {};
+template<> struct CadObjectTypes<Line> : CadObjectTypeSet<ObjectType::LINE> {};
+template<> struct CadObjectTypes<LwPolyline> : CadObjectTypeSet<ObjectType::LWPOLYLINE> {};
+template<> struct CadObjectTypes<MLine> : CadObjectTypeSet<ObjectType::MLINE> {};
+template<> struct CadObjectTypes<MText> : CadObjectTypeSet<ObjectType::MTEXT> {};
+template<> struct CadObjectTypes<Point> : CadObjectTypeSet<ObjectType::POINT> {};
+template<> struct CadObjectTypes<Ray> : CadObjectTypeSet<ObjectType::RAY> {};
+template<> struct CadObjectTypes<Seqend> : CadObjectTypeSet<ObjectType::SEQEND> {};
+template<> struct CadObjectTypes<Shape> : CadObjectTypeSet<ObjectType::SHAPE> {};
+template<> struct CadObjectTypes<Solid> : CadObjectTypeSet<ObjectType::SOLID> {};
+template<> struct CadObjectTypes<Solid3D> : CadObjectTypeSet<ObjectType::SOLID3D> {};
+template<> struct CadObjectTypes<Spline> : CadObjectTypeSet<ObjectType::SPLINE> {};
+template<> struct CadObjectTypes<Tolerance> : CadObjectTypeSet<ObjectType::TOLERANCE> {};
+template<> struct CadObjectTypes<Viewport> : CadObjectTypeSet<ObjectType::VIEWPORT> {};
+template<> struct CadObjectTypes<XLine> : CadObjectTypeSet<ObjectType::XLINE> {};
+template<> struct CadObjectTypes<Block> : CadObjectTypeSet<ObjectType::BLOCK> {};
+template<> struct CadObjectTypes<BlockEnd> : CadObjectTypeSet<ObjectType::ENDBLK> {};
+
+template<> struct CadObjectTypes<TextEntity> : CadObjectTypeSet<ObjectType::TEXT, ObjectType::ATTRIB, ObjectType::ATTDEF> {};
+template<> struct CadObjectTypes<AttributeBase> : CadObjectTypeSet<ObjectType::ATTRIB, ObjectType::ATTDEF> {};
+template<> struct CadObjectTypes<AttributeEntity> : CadObjectTypeSet<ObjectType::ATTRIB> {};
+template<> struct CadObjectTypes<AttributeDefinition> : CadObjectTypeSet<ObjectType::ATTDEF> {};
+
+template<> struct CadObjectTypes<Dimension> : CadObjectTypeSet<ObjectType::DIMENSION_ORDINATE, ObjectType::DIMENSION_LINEAR,
+                                                              ObjectType::DIMENSION_ALIGNED, ObjectType::DIMENSION_ANG_3_Pt,
+                                                              ObjectType::DIMENSION_ANG_2_Ln, ObjectType::DIMENSION_RADIUS,
+                                                              ObjectType::DIMENSION_DIAMETER> {};
+template<> struct CadObjectTypes<DimensionAligned> : CadObjectTypeSet<ObjectType::DIMENSION_ALIGNED, ObjectType::DIMENSION_LINEAR> {};
+template<> struct CadObjectTypes<DimensionLinear> : CadObjectTypeSet<ObjectType::DIMENSION_LINEAR> {};
+template<> struct CadObjectTypes<DimensionAngular2Line> : CadObjectTypeSet<ObjectType::DIMENSION_ANG_2_Ln> {};
+template<> struct CadObjectTypes<DimensionAngular3Pt> : CadObjectTypeSet<ObjectType::DIMENSION_ANG_3_Pt> {};
+template<> struct CadObjectTypes<DimensionDiameter> : CadObjectTypeSet<ObjectType::DIMENSION_DIAMETER> {};
+template<> struct CadObjectTypes<DimensionOrdinate> : CadObjectTypeSet<ObjectType::DIMENSION_ORDINATE> {};
+template<> struct CadObjectTypes<DimensionRadius> : CadObjectTypeSet<ObjectType::DIMENSION_RADIUS> {};
+
+template<> struct CadObjectTypes<Polyline> : CadObjectTypeSet<ObjectType::POLYLINE_2D, ObjectType::POLYLINE_3D,
+                                                             ObjectType::POLYLINE_PFACE, ObjectType::POLYLINE_MESH> {};
+template<> struct CadObjectTypes<Polyline2D> : CadObjectTypeSet<ObjectType::POLYLINE_2D> {};
+template<> struct CadObjectTypes<Polyline3D> : CadObjectTypeSet<ObjectType::POLYLINE_3D> {};
+template<> struct CadObjectTypes<PolyfaceMesh> : CadObjectTypeSet<ObjectType::POLYLINE_PFACE> {};
+
+template<> struct CadObjectTypes<Vertex> : CadObjectTypeSet<ObjectType::VERTEX_2D, ObjectType::VERTEX_3D, ObjectType::VERTEX_MESH,
+                                                           ObjectType::VERTEX_PFACE, ObjectType::VERTEX_PFACE_FACE> {};
+template<> struct CadObjectTypes<Vertex2D> : CadObjectTypeSet<ObjectType::VERTEX_2D> {};
+template<> struct CadObjectTypes<Vertex3D> : CadObjectTypeSet<ObjectType::VERTEX_3D> {};
+template<> struct CadObjectTypes<VertexFaceMesh> : CadObjectTypeSet<ObjectType::VERTEX_PFACE> {};
+template<> struct CadObjectTypes<VertexFaceRecord> : CadObjectTypeSet<ObjectType::VERTEX_PFACE_FACE> {};
+
+template<> struct CadObjectTypes<AppId> : CadObjectTypeSet<ObjectType::APPID> {};
+template<> struct CadObjectTypes<BlockRecord> : CadObjectTypeSet<ObjectType::BLOCK_HEADER> {};
+template<> struct CadObjectTypes<DimensionStyle> : CadObjectTypeSet<ObjectType::DIMSTYLE> {};
+template<> struct CadObjectTypes<Layer> : CadObjectTypeSet<ObjectType::LAYER> {};
+template<> struct CadObjectTypes<LineType> : CadObjectTypeSet<ObjectType::LTYPE> {};
+template<> struct CadObjectTypes<TextStyle> : CadObjectTypeSet<ObjectType::STYLE> {};
+template<> struct CadObjectTypes<UCS> : CadObjectTypeSet<ObjectType::UCS> {};
+template<> struct CadObjectTypes<View> : CadObjectTypeSet<ObjectType::VIEW> {};
+template<> struct CadObjectTypes<VPort> : CadObjectTypeSet<ObjectType::VPORT> {};
+
+template<> struct CadObjectTypes<AppIdsTable> : CadObjectTypeSet<ObjectType::APPID_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<BlockRecordsTable> : CadObjectTypeSet<ObjectType::BLOCK_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<DimensionStylesTable> : CadObjectTypeSet<ObjectType::DIMSTYLE_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<LayersTable> : CadObjectTypeSet<ObjectType::LAYER_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<LineTypesTable> : CadObjectTypeSet<ObjectType::LTYPE_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<TextStylesTable> : CadObjectTypeSet<ObjectType::STYLE_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<UCSTable> : CadObjectTypeSet<ObjectType::UCS_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<ViewsTable> : CadObjectTypeSet<ObjectType::VIEW_CONTROL_OBJ> {};
+template<> struct CadObjectTypes<VPortsTable> : CadObjectTypeSet<ObjectType::VPORT_CONTROL_OBJ> {};
+
+template<> struct CadObjectTypes<AcdbPlaceHolder> : CadObjectTypeSet<ObjectType::ACDBPLACEHOLDER> {};
+template<> struct CadObjectTypes<CadDictionary> : CadObjectTypeSet<ObjectType::DICTIONARY> {};
+template<> struct CadObjectTypes<Group> : CadObjectTypeSet<ObjectType::GROUP> {};
+template<> struct CadObjectTypes<Layout> : CadObjectTypeSet<ObjectType::LAYOUT> {};
+template<> struct CadObjectTypes<MLineStyle> : CadObjectTypeSet<ObjectType::MLINESTYLE> {};
+template<> struct CadObjectTypes<PlotSettings> : CadObjectTypeSet<ObjectType::LAYOUT> {};
+template<> struct CadObjectTypes<XRecord> : CadObjectTypeSet<ObjectType::XRECORD> {};
+// clang-format on
+
+/// \brief Casts a cad object down to T by its objectType(), nullptr if the object is not a T.
+/// \details A type tag check and a static_cast replace the RTTI lookup whenever the object
+/// reports a type of its own, objects with a shared type fall back to dynamic_cast.
+template<typename T, typename U>
+T *object_cast(U *object)
+{
+    if (!object)
+    {
+        return nullptr;
+    }
+
+    using Target = std::remove_cv_t<T>;
+    if constexpr (CadObjectTypes<Target>::tagged && std::is_base_of<std::remove_cv_t<U>, Target>::value)
+    {
+        ObjectType type = object->objectType();
+        if (!isSharedObjectType(type))
+        {
+            return CadObjectTypes<Target>::contains(type) ? static_cast<T *>(object) : nullptr;
+        }
+    }
+    return dynamic_cast<T *>(object);
+}
+
+}// namespace dwg
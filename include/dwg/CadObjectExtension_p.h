@@ -0,0 +1,71 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <dwg/CadMemoryScope_p.h>
+#include <dwg/xdata/ExtendedDataDictionary.h>
+#include <vector>
+
+namespace dwg {
+
+class BookColor;
+class CadDictionary;
+class CadObject;
+class Material;
+
+/// \brief Members of CadObject and Entity that most objects leave at their default.
+/// \details Allocated on first use, an object without extended data, extension dictionary,
+/// reactors, book color or material only pays for the pointer to it. The extended data is owned
+/// by the extension, the other members point to objects of the document.
+struct CadObjectExtension
+{
+    //Allocated with the object it extends, see CadMemoryScope
+    static void *operator new(std::size_t size)
+    {
+        return CadMemoryScope::allocate(size, CadMemoryScope::objectResource());
+    }
+
+    static void operator delete(void *ptr, std::size_t size)
+    {
+        CadMemoryScope::deallocate(ptr, size);
+    }
+
+    CadObjectExtension() = default;
+    CadObjectExtension(const CadObjectExtension &) = delete;
+    CadObjectExtension &operator=(const CadObjectExtension &) = delete;
+
+    ~CadObjectExtension()
+    {
+        delete extendedData;
+    }
+
+    ExtendedDataDictionary *extendedData = nullptr;
+    CadDictionary *xdictionary = nullptr;
+    std::vector<CadObject *> reactors;
+
+    //Entity members
+    BookColor *bookColor = nullptr;
+    Material *material = nullptr;
+};
+
+}// namespace dwg
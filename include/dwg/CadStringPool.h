@@ -0,0 +1,69 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <dwg/exports.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dwg {
+
+/// \brief Interned strings of a document, each distinct value is stored once.
+/// \details Every intern call takes a reference on the value, a returned pointer stays valid until
+/// it was released as often as interned, or the pool is cleared or destroyed. Two strings interned
+/// in the same pool are equal exactly when their pointers are equal.
+class LIBDWG_API CadStringPool
+{
+public:
+    CadStringPool();
+    ~CadStringPool();
+
+    /// Stored copy of the value, added on the first call.
+    const std::string *intern(std::string_view value);
+    /// Drops a reference taken by intern, the value is removed with its last reference.
+    void release(const std::string *value);
+    /// Stored copy of the value, nullptr if it was never interned.
+    const std::string *find(std::string_view value) const;
+
+    void clear();
+    std::size_t size() const;
+
+private:
+    CadStringPool(const CadStringPool &) = delete;
+    CadStringPool &operator=(const CadStringPool &) = delete;
+
+private:
+    struct Entry
+    {
+        std::unique_ptr<std::string> value;
+        std::size_t references;
+    };
+
+    //Keys view the owned strings, the heap copies do not move when the map rehashes
+    std::unordered_map<std::string_view, Entry> _strings;
+};
+
+}// namespace dwg
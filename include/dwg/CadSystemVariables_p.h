@@ -290,7 +290,7 @@ public:
 
 #pragma endregion CadHeader Dxf System Variables
 
-    static std::map<std::string, CadSystemVariableAttribute> headerMap();
+    static const std::map<std::string, CadSystemVariableAttribute> &headerMap();
 
     static DwgVariant value(const std::string &, const DxfCode &, CadHeader *header);
 
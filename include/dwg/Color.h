@@ -30,8 +30,8 @@ namespace dwg {
 class LIBDWG_API Color
 {
     static const std::vector<std::vector<unsigned char>> _indexRgb;
-    const int _maxTrueColor = 0b0001'0000'0000'0000'0000'0000'0000;
-    const int _trueColorFlag = 0b0100'0000'0000'0000'0000'0000'0000'0000;
+    static constexpr int _maxTrueColor = 0b0001'0000'0000'0000'0000'0000'0000;
+    static constexpr int _trueColorFlag = 0b0100'0000'0000'0000'0000'0000'0000'0000;
     unsigned int _color;
     static unsigned int getInt24(const std::vector<unsigned char> &array);
 
@@ -35,7 +35,7 @@ public:
 
     virtual ~INamedCadObject() {}
 
-    virtual std::string name() const = 0;
+    virtual const std::string &name() const = 0;
 
     Delegate<void(const std::string &, const std::string &)> OnNameChanged;
 };
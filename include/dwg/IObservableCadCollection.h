@@ -25,6 +25,7 @@
 #include <dwg/exports.h>
 #include <dwg/utils/Delegate.h>
 #include <string>
+#include <vector>
 
 namespace dwg {
 
@@ -52,8 +53,29 @@ public:
         return objects;
     }
 
+    /// \brief Holds back OnAdd, the added objects are fired in one OnAddRange on resume.
+    /// \details Calls nest, the objects are fired by the outermost resumeNotifications(). A removal
+    /// while suspended fires the held back objects first so the order of the events is kept.
+    void suspendNotifications();
+    void resumeNotifications();
+    bool notificationsSuspended() const;
+
     Delegate<void(CadObject *)> OnAdd;
+    /// Fired once for a bulk insert in place of one OnAdd per item.
+    Delegate<void(const std::vector<CadObject *> &)> OnAddRange;
     Delegate<void(CadObject *)> OnRemove;
+
+protected:
+    void notifyAdded(CadObject *);
+    void notifyAdded(const std::vector<CadObject *> &);
+    void notifyRemoved(CadObject *);
+
+private:
+    void flushAdded();
+
+private:
+    int _suspendCount = 0;
+    std::vector<CadObject *> _pendingAdded;
 };
 
 }// namespace dwg
\ No newline at end of file
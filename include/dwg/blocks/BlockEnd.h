@@ -33,9 +33,9 @@ public:
     BlockEnd(BlockRecord *record);
     ~BlockEnd() = default;
 
-    std::string objectName() const override;
+    std::string_view objectName() const override;
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -39,10 +39,10 @@ public:
              ACadVersion version, const std::string &dxfName, short itemClassId, short maintenanceVersion,
              ProxyFlags proxyFlags, bool wasZombie);
 
-    std::string dxfName() const;
+    const std::string &dxfName() const;
     void setDxfName(const std::string &dxfName);
 
-    std::string cppClassName() const;
+    const std::string &cppClassName() const;
     void setCppClassName(const std::string &name);
 
     std::string applicationName() const;
@@ -77,13 +77,13 @@ private:
     std::string _cppClassName;
     std::string _applicationName;
     ProxyFlags _proxyFlags;
-    int _instanceCount;
-    bool _wasZombie;
-    bool _isAnEntity;
-    short _classNumber;
-    short _itemClassId;
-    ACadVersion _dwgVersion;
-    short _maintenanceVersion;
+    int _instanceCount = 0;
+    bool _wasZombie = false;
+    bool _isAnEntity = false;
+    short _classNumber = 0;
+    short _itemClassId = 0;
+    ACadVersion _dwgVersion = ACadVersion::Unknown;
+    short _maintenanceVersion = 0;
 };
 
 }// namespace dwg
\ No newline at end of file
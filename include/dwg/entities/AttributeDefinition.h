@@ -38,8 +38,8 @@ public:
     ~AttributeDefinition();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string prompt() const;
     void setPrompt(const std::string &prompt);
@@ -35,8 +35,8 @@ public:
     virtual ~Circle();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     const XYZ &center() const;
     void setCenter(const XYZ &center);
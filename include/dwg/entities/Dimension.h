@@ -47,7 +47,7 @@ public:
     virtual ~Dimension();
 
 public:
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view subclassMarker() const override;
 
     AttachmentPointType attachmentPoint() const;
     void setAttachmentPoint(AttachmentPointType value);
@@ -35,8 +35,8 @@ public:
     ~DimensionAngular2Line();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     const XYZ & angleVertex() const;
     void setAngleVertex(const XYZ &value);
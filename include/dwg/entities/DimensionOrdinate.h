@@ -35,8 +35,8 @@ public:
     ~DimensionOrdinate();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     const XYZ &featureLocation() const;
     void setFeatureLocation(const XYZ &value);
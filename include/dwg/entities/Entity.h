@@ -43,7 +43,7 @@ public:
     Entity();
     virtual ~Entity();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     virtual BookColor *bookColor() const;
     virtual void setBookColor(BookColor *);
@@ -81,15 +81,14 @@ protected:
     void tableOnRemove(CadObject *item);
 
 private:
+    //Ordered by size to avoid padding, the book color and the material are in the CadObjectExtension
     Layer *_layer;
+    LineType *_linetype;
+    double _linetypeScale;
     Color _color;
+    Transparency _transparency;
     LineweightType _lineweight;
-    double _linetypeScale;
     bool _isInvisible;
-    Transparency _transparency;
-    LineType *_linetype;
-    BookColor *_bookColor;
-    Material *_material;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -36,8 +36,8 @@ public:
     virtual ~Face3D();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     XYZ firstCorner() const;
     void setFirstCorner(const XYZ &);
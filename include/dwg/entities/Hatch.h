@@ -41,8 +41,8 @@ public:
     ~Hatch();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     double elevation() const;
     void setElevation(double elevation);
@@ -42,8 +42,8 @@ public:
     ~Insert();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     BlockRecord *block() const;
     void setBlock(BlockRecord *);
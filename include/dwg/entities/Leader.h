@@ -40,8 +40,8 @@ public:
     ~Leader();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     DimensionStyle *style() const;
     void setStyle(DimensionStyle *style);
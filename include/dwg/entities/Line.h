@@ -26,6 +26,9 @@
 
 namespace dwg {
 
+/// \brief Line entity.
+/// \details On 64-bit targets a line takes 160 bytes: 40 for CadObject, 40 for Entity and 80 for the
+/// points and thickness. Drawings have millions of them, Line.cpp checks the size at compile time.
 class LIBDWG_API Line : public Entity
 {
     RTTR_ENABLE(Entity)
@@ -35,8 +38,8 @@ public:
     ~Line();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     XYZ normal() const;
     void setNormal(const XYZ &normal);
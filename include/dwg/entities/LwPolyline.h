@@ -47,8 +47,8 @@ public:
     virtual ~LwPolyline();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     LwPolylineFlags flags() const;
     void setFlags(LwPolylineFlags);
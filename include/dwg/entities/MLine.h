@@ -53,8 +53,8 @@ public:
     ~MLine();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     MLineStyle *style() const;
     void setStyle(MLineStyle *style);
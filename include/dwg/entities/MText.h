@@ -56,8 +56,8 @@ public:
     ~MText();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     double horizontalWidth() const;
     void setHorizontalWidth(double width);
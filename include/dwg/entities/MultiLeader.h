@@ -61,8 +61,8 @@ public:
     virtual ~MultiLeader();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     BlockRecord *arrowhead() const;
     void setArrowhead(BlockRecord *);
@@ -33,7 +33,7 @@ public:
     ~PdfUnderlay();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
+    virtual std::string_view objectName() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -40,7 +40,7 @@ public:
     Polyline();
     virtual ~Polyline();
 
-    virtual std::string objectName() const override;
+    virtual std::string_view objectName() const override;
 
     double elevation() const;
     void setElevation(double);
@@ -93,7 +93,7 @@ public:
     ~Polyline2D();
 
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 class Polyline3D : public Polyline
@@ -105,7 +105,7 @@ public:
     ~Polyline3D();
 
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -36,8 +36,8 @@ public:
     ~PolyfaceMesh();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     VertexFaceRecordCollection *faces();
 
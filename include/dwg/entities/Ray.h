@@ -35,8 +35,8 @@ public:
     ~Ray();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     XYZ startPoint() const;
     void setStartPoint(const XYZ &point);
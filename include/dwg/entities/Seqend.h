@@ -35,7 +35,7 @@ public:
     ~Seqend();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
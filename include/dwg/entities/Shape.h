@@ -35,8 +35,8 @@ public:
     ~Shape();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     double thickness() const;
     void setThickness(double);
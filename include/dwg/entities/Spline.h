@@ -37,8 +37,8 @@ public:
     virtual ~Spline();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     XYZ normal() const;
     void setNormal(const XYZ &);
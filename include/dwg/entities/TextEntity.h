@@ -39,8 +39,8 @@ public:
     virtual ~TextEntity();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
     virtual const std::type_info &typeInfo() const;
 
     double thickness() const;
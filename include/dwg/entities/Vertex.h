@@ -34,7 +34,7 @@ public:
     Vertex(const XYZ &);
     ~Vertex();
 
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 
     double bulge() const;
     void setBulge(double);
@@ -74,7 +74,7 @@ public:
     Vertex2D(const XY &);
     Vertex2D(const XYZ &);
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 class Vertex3D : public Vertex
@@ -82,7 +82,7 @@ class Vertex3D : public Vertex
 public:
     Vertex3D();
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 class VertexFaceMesh : public Vertex
@@ -91,7 +91,7 @@ public:
     VertexFaceMesh();
     VertexFaceMesh(const XYZ &);
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 };
 
 class VertexFaceRecord : public Vertex
@@ -100,7 +100,7 @@ public:
     VertexFaceRecord();
     VertexFaceRecord(const XYZ &);
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     short index1() const;
     void setIndex1(short);
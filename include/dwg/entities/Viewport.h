@@ -47,8 +47,8 @@ public:
     ~Viewport();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     XYZ center() const;
     void setCenter(const XYZ &);
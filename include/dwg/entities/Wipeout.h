@@ -33,8 +33,8 @@ public:
     ~Wipeout();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
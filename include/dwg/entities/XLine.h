@@ -35,8 +35,8 @@ public:
     ~XLine();
 
     virtual ObjectType objectType() const override;
-    virtual std::string objectName() const override;
-    virtual std::string subclassMarker() const override;
+    virtual std::string_view objectName() const override;
+    virtual std::string_view subclassMarker() const override;
 
     const XYZ &firstPoint() const;
     void setFirstPoint(const XYZ &);
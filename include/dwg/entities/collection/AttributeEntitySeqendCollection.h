@@ -36,6 +36,7 @@ public:
     AttributeEntitySeqendCollection(CadObject *owner);
     ~AttributeEntitySeqendCollection();
 
+    std::vector<CadObject *> rawCadObjects() const override;
     CadObject *owner() const;
     Seqend *seqend() const override;
     void setSeqend(Seqend *) override;
@@ -45,6 +45,10 @@ public:
 
     void add(Entity *entity);
     void add(const std::initializer_list<Entity *> &entities);
+
+    /// \brief Adds all the entities, none of them is added if one is rejected.
+    /// \details The document is notified once through OnAddRange instead of once per entity.
+    void addRange(const std::vector<Entity *> &entities);
     Entity *remove(Entity *entity);
     void clear();
 
@@ -36,6 +36,7 @@ public:
     VertexSeqendCollection(CadObject *owner);
     ~VertexSeqendCollection();
 
+    std::vector<CadObject *> rawCadObjects() const override;
     CadObject *owner() const;
     Seqend *seqend() const override;
     void setSeqend(Seqend *) override;
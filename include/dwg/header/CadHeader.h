@@ -166,7 +166,7 @@ public:
     char dgnUnderlayFramesVisibility() const;
     void setDgnUnderlayFramesVisibility(char);
 
-    const std::string &dimensionAlternateDimensioningSuffix() const;
+    std::string dimensionAlternateDimensioningSuffix() const;
     void setDimensionAlternateDimensioningSuffix(const std::string &);
 
     short dimensionAlternateUnitDecimalPlaces() const;
@@ -196,7 +196,7 @@ public:
     double dimensionAltMzf() const;
     void setDimensionAltMzf(double);
 
-    const std::string &dimensionAltMzs() const;
+    std::string dimensionAltMzs() const;
     void setDimensionAltMzs(const std::string &);
 
     short dimensionAngularDimensionDecimalPlaces() const;
@@ -241,7 +241,7 @@ public:
     TextArrowFitType dimensionDimensionTextArrowFit() const;
     void setDimensionDimensionTextArrowFit(TextArrowFitType);
 
-    const Color &dimensionExtensionLineColor() const;
+    Color dimensionExtensionLineColor() const;
     void setDimensionExtensionLineColor(const Color &);
 
     double dimensionExtensionLineExtension() const;
@@ -277,7 +277,7 @@ public:
     LinearUnitFormat dimensionLinearUnitFormat() const;
     void setDimensionLinearUnitFormat(LinearUnitFormat);
 
-    const Color &dimensionLineColor() const;
+    Color dimensionLineColor() const;
     void setDimensionLineColor(const Color &);
 
     double dimensionLineExtension() const;
@@ -301,13 +301,13 @@ public:
     double dimensionMzf() const;
     void setDimensionMzf(double);
 
-    const std::string &dimensionMzs() const;
+    std::string dimensionMzs() const;
     void setDimensionMzs(const std::string &);
 
     double dimensionPlusTolerance() const;
     void setDimensionPlusTolerance(double);
 
-    const std::string &dimensionPostFix() const;
+    std::string dimensionPostFix() const;
     void setDimensionPostFix(const std::string &);
 
     double dimensionRounding() const;
@@ -346,13 +346,13 @@ public:
     const std::string &dimensionTex2() const;
     void setDimensionTex2(const std::string &);
 
-    const Color &dimensionTextBackgroundColor() const;
+    Color dimensionTextBackgroundColor() const;
     void setDimensionTextBackgroundColor(const Color &);
 
     DimensionTextBackgroundFillMode dimensionTextBackgroundFillMode() const;
     void setDimensionTextBackgroundFillMode(DimensionTextBackgroundFillMode);
 
-    const Color &dimensionTextColor() const;
+    Color dimensionTextColor() const;
     void setDimensionTextColor(const Color &);
 
     TextDirection dimensionTextDirection() const;
@@ -561,7 +561,7 @@ public:
     const XY &modelSpaceLimitsMin() const;
     void setModelSpaceLimitsMin(const XY &);
 
-    const XYZ &modelSpaceOrigin() const;
+    XYZ modelSpaceOrigin() const;
     void setModelSpaceOrigin(const XYZ &);
 
     const XYZ &modelSpaceOrthographicBackDOrigin() const;
@@ -588,10 +588,10 @@ public:
     UCS *modelSpaceUcsBase() const;
     void setModelSpaceUcsBase(UCS *);
 
-    const XYZ &modelSpaceXAxis() const;
+    XYZ modelSpaceXAxis() const;
     void setModelSpaceXAxis(const XYZ &);
 
-    const XYZ &modelSpaceYAxis() const;
+    XYZ modelSpaceYAxis() const;
     void setModelSpaceYAxis(const XYZ &);
 
     double northDirection() const;
@@ -666,13 +666,13 @@ public:
     UCS *paperSpaceUcsBase() const;
     void setPaperSpaceUcsBase(UCS *);
 
-    const XYZ &paperSpaceUcsOrigin() const;
+    XYZ paperSpaceUcsOrigin() const;
     void setPaperSpaceUcsOrigin(const XYZ &);
 
-    const XYZ &paperSpaceUcsXAxis() const;
+    XYZ paperSpaceUcsXAxis() const;
     void setPaperSpaceUcsXAxis(const XYZ &);
 
-    const XYZ &paperSpaceUcsYAxis() const;
+    XYZ paperSpaceUcsYAxis() const;
     void setPaperSpaceUcsYAxis(const XYZ &);
 
     short plotStyleMode() const;
@@ -870,7 +870,7 @@ public:
     const std::string &versionGuid() const;
     void setVersionGuid(const std::string &);
 
-    const std::string &versionString() const;
+    std::string versionString() const;
     void setVersionString(const std::string &);
 
     double viewportDefaultViewScaleFactor() const;
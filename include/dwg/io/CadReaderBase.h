@@ -28,6 +28,8 @@
 #include <dwg/utils/Delegate.h>
 #include <dwg/utils/Encoding.h>
 #include <fstream>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <type_traits>
 
@@ -51,6 +53,8 @@ protected:
     CadDocument *_document;
     std::fstream *_fileStream;
     Encoding _encoding = Encoding(CodePage::Utf8);
+    /// Templates are only needed while reading, their pool is released with the reader.
+    std::shared_ptr<std::pmr::memory_resource> _templateResource;
 };
 
 
@@ -23,6 +23,8 @@
 #pragma once
 
 #include <dwg/exports.h>
+#include <memory>
+#include <memory_resource>
 
 namespace dwg {
 
@@ -41,10 +43,18 @@ public:
     bool keepUnknownNonGraphicalObjects() const;
     void setKeepUnknownNonGraphicalObjects(bool value);
 
+    /// \brief Resource the pool of the read document takes its memory from, kept alive by the document.
+    /// \details The objects are allocated from a pool owned by the document and released in bulk
+    /// when it is destroyed, the pool asks this resource for large chunks only. When not set the
+    /// chunks come from the default resource.
+    std::shared_ptr<std::pmr::memory_resource> memoryResource() const;
+    void setMemoryResource(const std::shared_ptr<std::pmr::memory_resource> &value);
+
 private:
     bool _failsafe;
     bool _keepUnknownEntities;
     bool _keepUnknownNonGraphicalObjects;
+    std::shared_ptr<std::pmr::memory_resource> _memoryResource;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -0,0 +1,94 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <dwg/ACadVersion.h>
+#include <dwg/CadUtils.h>
+#include <fmt/core.h>
+#include <stdexcept>
+
+namespace dwg {
+
+/// \brief Compile-time counterpart of the version flags in DwgSectionIO.
+/// \details Object encoders and decoders are instantiated once per tag, so the
+/// R2000Plus/R2004Plus/... branches fold away instead of being tested for every
+/// field of every object.
+template<ACadVersion V>
+struct DwgVersionTag
+{
+    static constexpr ACadVersion version = V;
+
+    static constexpr bool R13_14Only = V == ACadVersion::AC1014 || V == ACadVersion::AC1012;
+    static constexpr bool R13_15Only = V >= ACadVersion::AC1012 && V <= ACadVersion::AC1015;
+    static constexpr bool R2000Plus = V >= ACadVersion::AC1015;
+    static constexpr bool R2004Pre = V < ACadVersion::AC1018;
+    static constexpr bool R2007Pre = V <= ACadVersion::AC1021;
+    static constexpr bool R2004Plus = V >= ACadVersion::AC1018;
+    static constexpr bool R2007Plus = V >= ACadVersion::AC1021;
+    static constexpr bool R2010Plus = V >= ACadVersion::AC1024;
+    static constexpr bool R2013Plus = V >= ACadVersion::AC1027;
+    static constexpr bool R2018Plus = V >= ACadVersion::AC1032;
+};
+
+/// \brief Expands \p X once for every DwgVersionTag handled by dispatchDwgVersion.
+/// \details Used to instantiate the encoders shared between translation units.
+#define DWG_FOR_EACH_VERSION_TAG(X)                                                                                    \
+    X(DwgVersionTag<ACadVersion::AC1012>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1014>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1015>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1018>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1021>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1024>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1027>)                                                                              \
+    X(DwgVersionTag<ACadVersion::AC1032>)
+
+/// \brief Resolves the runtime version once and calls \p fn with the matching DwgVersionTag.
+/// \details Only the versions handled by the object section (R13 to R2018) are dispatched.
+template<typename Fn>
+decltype(auto) dispatchDwgVersion(ACadVersion version, Fn &&fn)
+{
+    switch (version)
+    {
+        case ACadVersion::AC1012:
+            return fn(DwgVersionTag<ACadVersion::AC1012>());
+        case ACadVersion::AC1014:
+            return fn(DwgVersionTag<ACadVersion::AC1014>());
+        case ACadVersion::AC1015:
+            return fn(DwgVersionTag<ACadVersion::AC1015>());
+        case ACadVersion::AC1018:
+            return fn(DwgVersionTag<ACadVersion::AC1018>());
+        case ACadVersion::AC1021:
+            return fn(DwgVersionTag<ACadVersion::AC1021>());
+        case ACadVersion::AC1024:
+            return fn(DwgVersionTag<ACadVersion::AC1024>());
+        case ACadVersion::AC1027:
+            return fn(DwgVersionTag<ACadVersion::AC1027>());
+        case ACadVersion::AC1032:
+            return fn(DwgVersionTag<ACadVersion::AC1032>());
+        default:
+            throw std::runtime_error(
+                    fmt::format("Dwg version not supported: {}", CadUtils::GetNameFromVersion(version)));
+    }
+}
+
+}// namespace dwg
@@ -22,16 +22,57 @@
 
 #pragma once
 
+#include <dwg/ACadVersion.h>
 #include <dwg/io/dwg/readers/IDwgStreamReader_p.h>
+#include <memory>
+#include <streambuf>
 
 namespace dwg {
 
+/// \brief Read-only stream buffer over an object data block that is owned elsewhere.
+/// \details Every cursor created over the same block gets its own get pointer, so
+/// the main, text and handle cursors advance independently without copying data.
+/// The cursor readers consume the bytes with \c sbumpc and \c sgetn, seeks only
+/// happen when a cursor is placed. Seeks on the put area are accepted and ignored.
+class DwgObjectBuffer : public std::streambuf
+{
+public:
+    DwgObjectBuffer(const unsigned char *data, std::size_t size);
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+};
+
+/// \brief Reader that splits an object into its main data, string stream and handle stream.
+/// \details When constructed over a buffer the reader owns three cursors over the same
+/// bytes. The cursors are placed once per object with \c setMainPositionInBits,
+/// \c setTextPositionByFlag and \c setHandlePositionInBits and then only move forward,
+/// text reads go to the text cursor and handle reads go to the handle cursor.
+/// Before R2007 the strings are stored inline and the text cursor is the main cursor.
 class DwgMergedReader : public IDwgStreamReader
 {
 public:
     DwgMergedReader(IDwgStreamReader *mainReader, IDwgStreamReader *textReader, IDwgStreamReader *handleReader);
+    DwgMergedReader(ACadVersion version, const std::vector<unsigned char> &buffer, Encoding encoding = Encoding());
     ~DwgMergedReader();
 
+    IDwgStreamReader *mainReader() const;
+    IDwgStreamReader *textReader() const;
+    IDwgStreamReader *handleReader() const;
+
+    void setMainPositionInBits(long long position);
+    void setHandlePositionInBits(long long position);
+    long long setTextPositionByFlag(long long position);
+
+    Encoding encoding() const override;
+    void setEncoding(Encoding value) override;
+    std::iostream *stream() override;
+    int bitShift() const override;
+    long long position() const override;
+    bool isEmpty() const override;
+    void setPosition(long long) override;
+
     void advance(int offset) override;
     void advanceByte() override;
     unsigned long long handleReference() override;
@@ -54,6 +95,10 @@ public:
     std::vector<unsigned char> readBytes(int length) override;
     XY read2BitDoubleWithDefault(const XY &defValue) override;
     XYZ read3BitDoubleWithDefault(const XYZ &defValue) override;
+    void read2BitDoubles(XY *points, std::size_t count) override;
+    void read3BitDoubles(XYZ *points, std::size_t count) override;
+    void read2BitDoublesWithDefault(XY *points, std::size_t count, const XY &defValue) override;
+    void read3BitDoublesWithDefault(XYZ *points, std::size_t count, const XYZ &defValue) override;
     Color readCmColor() override;
     Color readEnColor(Transparency &transparency, bool &flag) override;
     DateTime read8BitJulianDate() override;
@@ -72,6 +117,8 @@ public:
     unsigned long long readRawULong() override;
     std::vector<unsigned char> readSentinel() override;
     short readShort() override;
+    long long readRawLong() override;
+    std::string readString(size_t length, Encoding encoding) override;
     std::string readTextUtf8() override;
     Timespan readTimeSpan() override;
     unsigned int readUInt() override;
@@ -80,10 +127,17 @@ public:
     void setPositionInBits(long long position) override;
     long long setPositionByFlag(long long position) override;
 
+private:
+    struct Cursor;
+    IDwgStreamReader *createCursor(ACadVersion version, Encoding encoding);
+
 private:
     IDwgStreamReader *_mainReader;
     IDwgStreamReader *_textReader;
     IDwgStreamReader *_handleReader;
+    const unsigned char *_data = nullptr;
+    std::size_t _size = 0;
+    std::vector<std::unique_ptr<Cursor>> _cursors;
 };
 
 }// namespace dwg
\ No newline at end of file
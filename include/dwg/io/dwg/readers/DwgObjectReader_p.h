@@ -25,6 +25,7 @@
 #include <dwg/ObjectType.h>
 #include <dwg/io/dwg/DwgSectionIO_p.h>
 #include <map>
+#include <memory>
 #include <queue>
 #include <vector>
 
@@ -55,6 +56,7 @@ class CadWipeoutBase;
 class PlotSettings;
 class Vertex;
 class StateTemplate;
+class DwgMergedReader;
 
 class DwgObjectReader : public DwgSectionIO
 {
@@ -70,6 +72,21 @@ public:
     void read();
 
 private:
+    using ObjectReadFn = CadTemplate *(DwgObjectReader::*)();
+    using ClassReadFn = CadTemplate *(DwgObjectReader::*)(DxfClass *);
+
+    //Entry of the dispatch table, indexed by the object type code or the class number
+    struct ObjectReader
+    {
+        ObjectReadFn read = nullptr;
+        ClassReadFn readClass = nullptr;
+        DxfClass *dxfClass = nullptr;
+    };
+
+    static const std::vector<ObjectReader> &fixedObjectReaders();
+    static ObjectReadFn classObjectReader(const std::string &dxfName);
+    void buildObjectReaders(DxfClassCollection *classes);
+
     ObjectType getEntityType(long long offset);
 
 #pragma region Common entity data
@@ -130,13 +147,15 @@ private:
 #pragma region Object readers
     CadTemplate *readObject(ObjectType type);
     CadTemplate *readUnlistedType(short classNumber);
-    // CadTemplate *readDocumentTable<T>(Table<T> table);
-    // CadTemplate *readDocumentTable<T>(CadTableTemplate<T> temp);
+    template<typename T>
+    CadTemplate *readDocumentTable();
     CadTemplate *readBlock();
     CadTemplate *readEndBlock();
     CadTemplate *readSeqend();
     CadTemplate *readVertex2D();
     CadTemplate *readVertex3D(Vertex *vertex);
+    template<typename T>
+    CadTemplate *readVertex();
     CadTemplate *readPfaceVertex();
     CadTemplate *readPolyline2D();
     CadTemplate *readPolyline3D();
@@ -188,6 +207,8 @@ private:
     CadTemplate *readSortentsTable();
     CadTemplate *readVisualStyle();
     CadTemplate *readCadImage(CadWipeoutBase *image);
+    template<typename T>
+    CadTemplate *readImage();
     CadTemplate *readImageDefinition();
     CadTemplate *readImageDefinitionReactor();
     CadTemplate *readXRecord();
@@ -205,6 +226,17 @@ private:
 private:
     IDwgStreamReader *_sreader;
     CadHeader *_header;
+    DwgDocumentBuilder *_builder;
+    DxfClassCollection *_classes;
+    std::queue<unsigned long long> _handles;
+    std::map<unsigned long long, long long> _handleMap;
+    std::map<unsigned long long, ObjectType> _readedObjects;
+    std::vector<ObjectReader> _objectReaders;
+
+    std::vector<unsigned char> _crcStreamBuffer;
+    std::unique_ptr<DwgMergedReader> _mergedReader;
+    long long _objectInitialPos = 0;
+    unsigned int _size = 0;
 };
 
 }// namespace dwg
\ No newline at end of file
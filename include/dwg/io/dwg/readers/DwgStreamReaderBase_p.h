@@ -48,7 +48,7 @@ public:
     void setBitShift(int);
     void setPosition(long long) override;
 
-    bool isEmpty() const;
+    bool isEmpty() const override;
     void setEmpty(bool);
 
     unsigned char readByte() override;
@@ -84,6 +84,10 @@ public:
     std::vector<unsigned char> readSentinel() override;
     XY read2BitDoubleWithDefault(const XY &) override;
     XYZ read3BitDoubleWithDefault(const XYZ &) override;
+    void read2BitDoubles(XY *points, std::size_t count) override;
+    void read3BitDoubles(XYZ *points, std::size_t count) override;
+    void read2BitDoublesWithDefault(XY *points, std::size_t count, const XY &defValue) override;
+    void read3BitDoublesWithDefault(XYZ *points, std::size_t count, const XYZ &defValue) override;
     Color readCmColor() override;
     Color readEnColor(Transparency &, bool &flag) override;
     Color readColorByIndex() override;
@@ -105,15 +109,24 @@ protected:
     void applyFlagToPosition(long long lastPos, long long &length, long long &strDataSize);
     unsigned char applyShiftToLasByte();
     void applyShiftToArr(int length, std::vector<unsigned char> &arr);
+    void applyShiftToArr(int length, unsigned char *arr);
     unsigned char read3bits();
     DateTime julianToDate(int jdata, int miliseconds);
 
+private:
+    double decodeBitDouble();
+    double decodeBitDoubleWithDefault(double def);
+    unsigned char nextByte();
+    void nextBytes(unsigned char *arr, int length);
+    template<typename T>
+    T nextLittleEndian();
+
 protected:
     std::iostream *_stream;
     StreamWrapper _wrapper;
     unsigned char _lastByte = 0;
     int _bitShift = 0;
-    bool _isEmpty;
+    bool _isEmpty = false;
     Encoding _encoding;
 };
 
@@ -75,6 +75,8 @@ namespace dwg {
 class IDwgStreamReader
 {
 public:
+    virtual ~IDwgStreamReader() = default;
+
     virtual Encoding encoding() const = 0;
 
     virtual void setEncoding(Encoding value) = 0;
@@ -85,6 +87,8 @@ public:
 
     virtual long long position() const = 0;
 
+    virtual bool isEmpty() const = 0;
+
     virtual void setPosition(long long) = 0;
 
     virtual unsigned char readByte() = 0;
@@ -161,6 +165,18 @@ public:
 
     virtual XYZ read3BitDoubleWithDefault(const XYZ &) = 0;
 
+    //Batch decoders for point runs, the caller owns a buffer of at least count points
+
+    virtual void read2BitDoubles(XY *points, std::size_t count) = 0;
+
+    virtual void read3BitDoubles(XYZ *points, std::size_t count) = 0;
+
+    //Each point uses the previous one as default, the first one uses defValue
+
+    virtual void read2BitDoublesWithDefault(XY *points, std::size_t count, const XY &defValue) = 0;
+
+    virtual void read3BitDoublesWithDefault(XYZ *points, std::size_t count, const XYZ &defValue) = 0;
+
     virtual Color readCmColor() = 0;
 
     virtual Color readEnColor(Transparency &, bool &flag) = 0;
@@ -76,6 +76,7 @@ class LeaderLine;
 class Line;
 class Point;
 class PolyfaceMesh;
+class Polyline;
 class Polyline2D;
 class Polyline3D;
 class Seqend;
@@ -134,96 +135,181 @@ public:
     bool writeXData() const;
 
 private:
+    //Encoders templated on V are instantiated once per DwgVersionTag
+    template<typename V>
+    void write();
+    template<typename V>
     void registerObject(CadObject *cadObject);
     void writeSize(CRC8StreamHandler *stream, unsigned int size);
     void writeSizeInBits(CRC8StreamHandler *stream, unsigned long long size);
+    template<typename V>
     void writeXrefDependantBit(TableEntry *entry);
+    template<typename V>
     void writeCommonData(CadObject *cadObject);
+    template<typename V>
     void writeCommonNonEntityData(CadObject *cadObject);
+    template<typename V>
     void writeCommonEntityData(Entity *entity);
+    template<typename V>
     void writeEntityMode(Entity *entity);
+    template<typename V>
     void writeExtendedData(ExtendedDataDictionary *data);
+    template<typename V>
     void writeExtendedDataEntry(AppId *app, ExtendedData *entry);
+    template<typename V>
     void writeReactorsAndDictionaryHandle(CadObject *cadObject);
     unsigned char getEntMode(Entity *entity);
 
 private:
+    template<typename V>
     void writeLTypeControlObject();
+    template<typename V>
     void writeBlockControl();
+    template<typename V>
     void writeLayers(LayersTable *layers);
+    template<typename V>
     void writeTextStyles(TextStylesTable *textStyles);
+    template<typename V>
     void writeViews(ViewsTable *views);
+    template<typename V>
     void writeUCSs(UCSTable *ucss);
+    template<typename V>
     void writeVPorts(VPortsTable *vports);
+    template<typename V>
     void writeAppIds(AppIdsTable *appids);
+    template<typename V>
     void writeDimensionStyles(DimensionStylesTable *dimStyles);
+    template<typename V>
     void writeEntries();
+    template<typename V>
     void writeBlockEntities();
+    template<typename V>
     void writeAppId(AppId *app);
+    template<typename V>
     void writeBlockRecord(BlockRecord *blkRecord);
+    template<typename V>
     void writeBlockHeader(BlockRecord *record);
+    template<typename V>
     void writeBlockBegin(Block *block);
+    template<typename V>
     void writeBlockEnd(BlockEnd *blkEnd);
+    template<typename V>
     void writeLayer(Layer *layer);
+    template<typename V>
     void writeLineType(LineType *ltype);
+    template<typename V>
     void writeTextStyle(TextStyle *style);
+    template<typename V>
     void writeUCS(UCS *ucs);
+    template<typename V>
     void writeView(View *view);
+    template<typename V>
     void writeDimensionStyle(DimensionStyle *dimStyle);
+    template<typename V>
     void writeVPort(VPort *vport);
 
 private:
     void writeEntity(Entity *entity);
+    template<typename V>
+    void writeEntity(Entity *entity);
+    template<typename V>
     void writeArc(Arc *arc);
+    template<typename V>
     void writeAttribute(AttributeEntity *att);
+    template<typename V>
     void writeAttDefinition(AttributeDefinition *attdef);
+    template<typename V>
     void writeCommonAttData(AttributeBase *att);
+    template<typename V>
     void writeCircle(Circle *circle);
+    template<typename V>
     void writeCommonDimensionData(Dimension *dimension);
+    template<typename V>
     void writeDimensionLinear(DimensionLinear *dimension);
+    template<typename V>
     void writeDimensionAligned(DimensionAligned *dimension);
+    template<typename V>
     void writeDimensionRadius(DimensionRadius *dimension);
+    template<typename V>
     void writeDimensionAngular2Line(DimensionAngular2Line *dimension);
+    template<typename V>
     void writeDimensionAngular3Pt(DimensionAngular3Pt *dimension);
+    template<typename V>
     void writeDimensionDiameter(DimensionDiameter *dimension);
+    template<typename V>
     void writeDimensionOrdinate(DimensionOrdinate *dimension);
+    template<typename V>
     void writeEllipse(Ellipse *ellipse);
+    template<typename V>
     void writeInsert(Insert *insert);
+    template<typename V>
     void writeFace3D(Face3D *face);
+    template<typename V>
     void writeMLine(MLine *mline);
+    template<typename V>
     void writeLwPolyline(LwPolyline *lwPolyline);
+    template<typename V>
     void writeHatch(Hatch *hatch);
+    template<typename V>
     void writeLeader(Leader *leader);
+    template<typename V>
     void writeMultiLeader(MultiLeader *multiLeader);
+    template<typename V>
     void writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *annotContext);
+    template<typename V>
     void writeLine(Line *line);
+    template<typename V>
     void writePoint(Point *point);
+    template<typename V>
     void writePolyfaceMesh(PolyfaceMesh *fm);
+    template<typename V>
     void writePolyline2D(Polyline2D *pline);
+    template<typename V>
     void writePolyline3D(Polyline3D *pline);
+    template<typename V>
     void writeSeqend(Seqend *seqend);
+    template<typename V>
     void writeShape(Shape *shape);
+    template<typename V>
     void writeSolid(Solid *solid);
+    template<typename V>
     void writeSolid3D(Solid3D *solid);
+    template<typename V>
     void writeCadImage(CadWipeoutBase *image);
+    template<typename V>
     void writeSpline(Spline *spline);
+    template<typename V>
     void writeRay(Ray *ray);
+    template<typename V>
     void writeTextEntity(TextEntity *text);
+    template<typename V>
     void writeMText(MText *mtext);
+    template<typename V>
     void writeFaceRecord(VertexFaceRecord *face);
+    template<typename V>
     void writeVertex2D(Vertex2D *vertex);
+    template<typename V>
     void writeVertex(Vertex *vertex);
+    template<typename V>
     void writeTolerance(Tolerance *tolerance);
+    template<typename V>
     void writeViewport(Viewport *viewport);
+    template<typename V>
     void writeXLine(XLine *xline);
+    template<typename V>
     void writeChildEntities(const std::vector<Entity *> &entities, Seqend *seqend);
 
 private:
     void writeObjects();
     void writeObject(CadObject *obj);
+    template<typename V>
+    void writeObject(CadObject *obj);
     void writeAcdbPlaceHolder(AcdbPlaceHolder *acdbPlaceHolder);
+    template<typename V>
     void writeBookColor(BookColor *color);
+    template<typename V>
     void writeCadDictionaryWithDefault(CadDictionaryWithDefault *dictionary);
+    template<typename V>
     void writeDictionary(CadDictionary *dictionary);
     void addEntriesToWriter(CadDictionary *dictionary);
     void writeDictionaryVariable(DictionaryVariable *dictionaryVariable);
@@ -231,12 +317,17 @@ private:
     void writeGroup(Group *group);
     void writeImageDefinitionReactor(ImageDefinitionReactor *definitionReactor);
     void writeImageDefinition(ImageDefinition *definition);
+    template<typename V>
     void writeLayout(Layout *layout);
+    template<typename V>
     void writeMLineStyle(MLineStyle *mlineStyle);
+    template<typename V>
     void writeMultiLeaderStyle(MultiLeaderStyle *mLeaderStyle);
+    template<typename V>
     void writePlotSettings(PlotSettings *plot);
     void writeScale(Scale *scale);
     void writeSortEntitiesTable(SortEntitiesTable *sortEntitiesTable);
+    template<typename V>
     void writeXRecord(XRecord *xrecord);
 
 private:
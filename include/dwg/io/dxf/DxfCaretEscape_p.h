@@ -0,0 +1,52 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <dwg/exports.h>
+#include <string>
+#include <string_view>
+
+namespace dwg {
+
+/// \brief Caret escapes of the DXF string values.
+/// \details Line feed, carriage return and tab are written as ^J, ^M and ^I, a caret is
+/// written as "^ ". Both directions run in a single pass and strings without anything to
+/// replace are returned as they are.
+class LIBDWG_API DxfCaretEscape
+{
+public:
+    /// Position of the first caret or character written as a caret escape, \c npos if none.
+    static std::size_t findEscaped(std::string_view str);
+
+    static std::string escape(std::string_view str);
+
+    /// Escapes from \p first on, as returned by \c findEscaped, the characters before it are copied.
+    static std::string escape(std::string_view str, std::size_t first);
+
+    static std::string unescape(std::string_view str);
+
+private:
+    static bool isEscaped(char c);
+};
+
+}// namespace dwg
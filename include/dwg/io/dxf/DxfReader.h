@@ -23,8 +23,11 @@
 #pragma once
 
 #include <dwg/ACadVersion.h>
+#include <dwg/Coordinate.h>
 #include <dwg/io/CadReaderBase.h>
 #include <dwg/io/dxf/DxfReaderConfiguration.h>
+#include <dwg/units/UnitsType.h>
+#include <string>
 #include <vector>
 
 
@@ -35,6 +38,28 @@ class Entity;
 class DxfDocumentBuilder;
 class DxfClass;
 class DxfClassCollection;
+class DxfTextReader;
+struct DxfSectionRange;
+
+/// \brief Header variables of a DXF file read by DxfReader::probe().
+/// \details Variables missing in the header keep their default value.
+struct LIBDWG_API DxfHeaderSummary
+{
+    bool isBinary = false;
+    /// $ACADVER
+    ACadVersion version = ACadVersion::Unknown;
+    std::string versionName;
+    /// $DWGCODEPAGE
+    std::string codePage;
+    /// $EXTMIN
+    XYZ extMin = XYZ::Zero;
+    /// $EXTMAX
+    XYZ extMax = XYZ::Zero;
+    /// $INSUNITS
+    UnitsType insUnits = UnitsType::Unitless;
+    /// $HANDSEED
+    unsigned long long handleSeed = 0;
+};
 
 class LIBDWG_API DxfReader : public CadReaderBase<DxfReaderConfiguration>
 {
@@ -47,25 +72,40 @@ public:
     CadDocument *readTables();
     std::vector<Entity *> readEntities();
 
+    /// \brief Reads the HEADER section only, without building a document.
+    /// \details The stream is read in growing blocks until the ENDSEC of the header,
+    /// the cost depends on the size of the header and not on the size of the file.
+    DxfHeaderSummary probe();
+
     static bool IsBinary(const std::string &filename);
     static bool IsBinary(std::iostream *stream, bool resetPos = false);
 
 private:
-    DxfClassCollection *readClasses();
-    DxfClass *readClass();
-    void readBlocks();
-    void readEntitiesPrivate();
-    void readObjects();
-    void readThumbnailImage();
+    void readSections(DxfTextReader *reader);
+    void readChunks(DxfTextReader *reader, const std::vector<const DxfSectionRange *> &sections);
+    void readSection(const std::string &name, IDxfStreamReader *reader);
+    CadHeader *readHeader(IDxfStreamReader *reader);
+    DxfClassCollection *readClasses(IDxfStreamReader *reader);
+    DxfClass *readClass(IDxfStreamReader *reader);
+    void readTables(IDxfStreamReader *reader);
+    void readBlocks(IDxfStreamReader *reader);
+    void readEntitiesPrivate(IDxfStreamReader *reader);
+    void readObjects(IDxfStreamReader *reader);
+    void readThumbnailImage(IDxfStreamReader *reader);
     IDxfStreamReader *getReader();
+    void readVersion(const std::string &name);
     IDxfStreamReader *goToSection(const std::string &sectionName);
     IDxfStreamReader *createReader(bool isBinary, bool isAC1009Format);
+    IDxfStreamReader *createReader(std::iostream *stream, bool isBinary, bool isAC1009Format);
+    static bool probeHeader(IDxfStreamReader *reader, DxfHeaderSummary &summary);
     void triggerNotification(const std::string &msg, Notification);
 
 private:
     ACadVersion _version;
     DxfDocumentBuilder *_builder;
     IDxfStreamReader *_reader;
+
+    static constexpr std::size_t ProbeBlockSize = 1 << 16;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -29,6 +29,7 @@ namespace dwg {
 class LIBDWG_API DxfReaderConfiguration : public CadReaderConfiguration
 {
     bool _clearCache;
+    bool _parallelSections;
 
 public:
     DxfReaderConfiguration();
@@ -38,6 +39,13 @@ public:
     bool clearCache() const;
 
     void setClearCache(bool value);
+
+    /// \brief Reads the ENTITIES and OBJECTS sections on several threads, large ones split in chunks.
+    /// \details Off by default, the per-type entity and object readers are not ported yet
+    /// and the chunk workers would only skip records.
+    bool parallelSections() const;
+
+    void setParallelSections(bool value);
 };
 
 }// namespace dwg
\ No newline at end of file
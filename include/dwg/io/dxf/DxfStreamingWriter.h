@@ -0,0 +1,93 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <dwg/Coordinate.h>
+#include <dwg/io/dxf/DxfWriterConfiguration.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace dwg {
+
+class CadDocument;
+class CadObjectHolder;
+class DxfEntitiesSectionWriter;
+class Entity;
+class IDxfStreamWriter;
+
+/// \brief Writes a DXF file entity by entity.
+/// \details The sections before ENTITIES come from a document that only needs the header and
+/// the tables, the entities are written as they are appended and are not kept, so the memory
+/// does not grow with the number of entities. The appended entities, their vertices, attributes
+/// and seqends get their handles from a counter that starts at the handle seed of the document,
+/// the $HANDSEED written by \c open reserves \c handleCapacity handles for them. OBJECTS is
+/// written by \c close, or by the destructor if the writer is still open.
+class LIBDWG_API DxfStreamingWriter : public DxfWriterConfiguration
+{
+public:
+    DxfStreamingWriter(const std::string &filename, bool binary);
+    DxfStreamingWriter(std::fstream *stream, bool binary);
+    ~DxfStreamingWriter();
+
+    unsigned long long handleCapacity() const;
+    void setHandleCapacity(unsigned long long value);
+
+    /// Writes HEADER, CLASSES, TABLES and BLOCKS and starts the ENTITIES section.
+    void open(CadDocument *document);
+
+    /// Writes the entity with the next handle, owned by the model space if it has no owner.
+    /// The vertices and attributes of the entity and their seqend get the handles that follow.
+    unsigned long long append(Entity *entity);
+
+    /// The shortcuts below write the entity without building it, \c layer must be in the layers table.
+    unsigned long long appendPoint(const XYZ &location, const std::string &layer = "0");
+
+    unsigned long long appendLine(const XYZ &start, const XYZ &end, const std::string &layer = "0");
+
+    unsigned long long appendLwPolyline(const std::vector<XY> &vertices, bool closed, const std::string &layer = "0");
+
+    /// Ends ENTITIES, writes OBJECTS and the end of file.
+    void close();
+
+private:
+    unsigned long long nextHandle();
+    void assignSubEntityHandles(Entity *entity);
+    void checkLayer(const std::string &layer) const;
+    void writeEntityStart(const std::string &name, unsigned long long handle, const std::string &layer,
+                          const std::string &subclass);
+
+private:
+    std::fstream *_stream = nullptr;
+    bool _ownsStream = false;
+    bool _binary = false;
+    CadDocument *_document = nullptr;
+    IDxfStreamWriter *_writer = nullptr;
+    CadObjectHolder *_holder = nullptr;
+    DxfEntitiesSectionWriter *_entities = nullptr;
+    unsigned long long _nextHandle = 0;
+    unsigned long long _lastHandle = 0;
+    unsigned long long _handleCapacity = 0x10000000;
+};
+
+}// namespace dwg
@@ -48,6 +48,7 @@ private:
     void writeEntities();
     void writeObjects();
     void writeACDSData();
+    void triggerNotification(const std::string &message, Notification notificationType);
 
 private:
     bool _binary = false;
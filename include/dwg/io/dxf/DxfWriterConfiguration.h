@@ -49,9 +49,24 @@ public:
 
     std::set<std::string> headerVariables() const;
 
+    /// Digits after the decimal point of the doubles in ASCII files, trailing zeros are dropped.
+    /// A negative value, the default, writes the shortest string that reads back to the same double.
+    int doublePrecision() const;
+
+    void setDoublePrecision(int value);
+
+    /// \brief Threads writing the records of the ENTITIES and BLOCKS sections.
+    /// \details 0, the default, uses the hardware concurrency and 1 writes on the calling thread.
+    /// The output does not depend on the number of threads.
+    int sectionThreads() const;
+
+    void setSectionThreads(int value);
+
 private:
     bool _writeAllHeaderVariables;
     bool _writeOptionalValues;
+    int _doublePrecision;
+    int _sectionThreads;
     std::set<std::string> _headerVariables;
 };
 
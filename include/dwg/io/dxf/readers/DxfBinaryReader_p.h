@@ -22,12 +22,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <dwg/io/dxf/readers/DxfStreamReaderBase_p.h>
 #include <dwg/utils/Encoding.h>
-#include <dwg/utils/StreamWrapper.h>
+#include <dwg/utils/EndianConverter.h>
+#include <vector>
 
 namespace dwg {
 
+/// \brief Reader for binary DXF.
+/// \details The stream is loaded once and values are read from the buffer, strings
+/// are views into it unless they need an encoding conversion.
 class DxfBinaryReader : public DxfStreamReaderBase
 {
 public:
@@ -36,9 +42,11 @@ public:
     DxfBinaryReader(std::iostream *stream, Encoding encoding);
     virtual ~DxfBinaryReader();
 
+    void readNext() override;
     void start() override;
 
     std::string readStringLine() override;
+    std::string_view readStringView() override;
     DxfCode readCode() override;
     bool lineAsBool() override;
     double lineAsDouble() override;
@@ -48,10 +56,40 @@ public:
     unsigned long long lineAsHandle() override;
     std::vector<unsigned char> lineAsBinaryChunk() override;
 
+protected:
+    static bool isAscii(std::string_view str);
+
+    /// Little endian value at the cursor, zero once the buffer is exhausted.
+    template<typename T>
+    T readValue();
+
 protected:
     Encoding _encoding;
     std::iostream *_stream;
-    StreamWrapper _wrapper;
+    std::vector<char> _buffer;
+    const char *_current;
+    const char *_end;
 };
 
+template<typename T>
+inline T DxfBinaryReader::readValue()
+{
+    T value{};
+    if (static_cast<std::size_t>(_end - _current) < sizeof(T))
+    {
+        _current = _end;
+        return value;
+    }
+
+    //Unaligned load, the compiler turns it into a single move
+    std::memcpy(&value, _current, sizeof(T));
+    if constexpr (is_big_endian)
+    {
+        unsigned char *bytes = reinterpret_cast<unsigned char *>(&value);
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    _current += sizeof(T);
+    return value;
+}
+
 }// namespace dwg
\ No newline at end of file
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <dwg/io/dxf/readers/DxfSectionReaderBase_p.h>
+#include <vector>
 
 namespace dwg {
 
@@ -33,6 +34,13 @@ public:
     ~DxfEntitiesSectionReader();
 
     void read() override;
+
+    /// Reads the records up to ENDSEC without touching the builder, the reader must be
+    /// on the first record. Safe to run on a worker thread with its own reader.
+    std::vector<CadEntityTemplate *> readTemplates();
+
+    /// Adds the templates to the builder in the given order.
+    void addTemplates(const std::vector<CadEntityTemplate *> &templates);
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -23,9 +23,12 @@
 #pragma once
 
 #include <dwg/io/dxf/readers/DxfSectionReaderBase_p.h>
+#include <vector>
 
 namespace dwg {
 
+class CadTemplate;
+
 class DxfObjectsSectionReader : public DxfSectionReaderBase
 {
 public:
@@ -33,6 +36,16 @@ public:
     ~DxfObjectsSectionReader();
 
     void read() override;
+
+    /// Reads the records up to ENDSEC without touching the builder, the reader must be
+    /// on the first record. Safe to run on a worker thread with its own reader.
+    std::vector<CadTemplate *> readTemplates();
+
+    /// Adds the templates to the builder in the given order.
+    void addTemplates(const std::vector<CadTemplate *> &templates);
+
+private:
+    CadTemplate *readObject();
 };
 
 }// namespace dwg
\ No newline at end of file
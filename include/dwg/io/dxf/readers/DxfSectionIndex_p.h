@@ -0,0 +1,78 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+#pragma once
+
+#include <cstddef>
+#include <dwg/exports.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dwg {
+
+/// \brief Byte range of a single DXF section in an ASCII buffer.
+/// \details The range starts at the group code line of the section name, a reader
+/// created over it returns the name on its first read, and ends right after the
+/// ENDSEC value line.
+struct DxfSectionRange
+{
+    std::string name;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    /// Record offsets where the section is split for parallel parsing, only for ENTITIES and OBJECTS.
+    /// A split never falls inside a VERTEX or ATTRIB run, those stay with their owner up to the SEQEND.
+    std::vector<std::size_t> chunks;
+};
+
+/// \brief Locations of the sections of an ASCII DXF buffer, built in a single pass.
+/// \details The scan also keeps the $ACADVER and $DWGCODEPAGE values of the header,
+/// which are the only variables needed before the sections can be parsed.
+class LIBDWG_API DxfSectionIndex
+{
+public:
+    /// Minimum size in bytes of a chunk of records.
+    static constexpr std::size_t ChunkSize = 1 << 20;
+
+    DxfSectionIndex();
+
+    static DxfSectionIndex Scan(const char *data, std::size_t size, std::size_t chunkSize = ChunkSize);
+
+    /// Splits a section at its chunk offsets, the first chunk starts with the section name
+    /// and the last one ends with ENDSEC.
+    static std::vector<DxfSectionRange> Chunks(const DxfSectionRange &section);
+
+    const std::vector<DxfSectionRange> &sections() const;
+
+    /// First section with the given name, nullptr if the buffer does not have it.
+    const DxfSectionRange *find(std::string_view name) const;
+
+    const std::string &acadVersion() const;
+
+    const std::string &codePage() const;
+
+private:
+    std::vector<DxfSectionRange> _sections;
+    std::string _acadVersion;
+    std::string _codePage;
+};
+
+}// namespace dwg
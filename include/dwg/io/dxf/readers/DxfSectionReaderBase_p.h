@@ -30,14 +30,24 @@ namespace dwg {
 
 class IDxfStreamReader;
 class DxfDocumentBuilder;
+class CadEntityTemplate;
 class DxfSectionReaderBase
 {
 public:
     DxfSectionReaderBase(IDxfStreamReader *reader, DxfDocumentBuilder *builder);
+    virtual ~DxfSectionReaderBase();
 
     virtual void read() = 0;
 
 protected:
+    /// Reads the entity that starts at the current group code 0, the reader is left
+    /// on the group code 0 of the next record.
+    CadEntityTemplate *readEntity();
+
+    /// Moves the reader to the group code 0 of the next record.
+    void skipRecord();
+
+
     void readCommonObjectData(std::string &name, unsigned long long &handle,
                               std::optional<unsigned long long> &ownerHandle,
                               std::optional<unsigned long long> &xdictHandle,
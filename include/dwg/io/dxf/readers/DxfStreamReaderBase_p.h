@@ -36,11 +36,13 @@ public:
     DxfCode dxfCode() const override;
     GroupCodeValueType groupCodeValue() const override;
     int code() const override;
+    const DxfToken &token() const override;
     DwgVariant value() const override;
     size_t position() const override;
     std::string valueRaw() const override;
 
     std::string valueAsString() const override;
+    std::string_view valueAsStringView() const override;
     bool valueAsBool() const override;
     short valueAsShort() const override;
     unsigned short valueAsUShort() const override;
@@ -61,6 +63,7 @@ public:
 
     virtual DxfCode readCode() = 0;
     virtual std::string readStringLine() = 0;
+    virtual std::string_view readStringView();
     virtual double lineAsDouble() = 0;
     virtual short lineAsShort() = 0;
     virtual int lineAsInt() = 0;
@@ -69,7 +72,7 @@ public:
     virtual std::vector<unsigned char> lineAsBinaryChunk() = 0;
     virtual bool lineAsBool() = 0;
 
-    DwgVariant transformValue(GroupCodeValueType code);
+    void transformValue(GroupCodeValueType code);
 
 protected:
     void setDxfCode(DxfCode);
@@ -77,10 +80,13 @@ protected:
     void setPosition(size_t);
     void setValueRaw(const std::string &);
 
+    /// String token returned once the data is exhausted, it closes the loops reading the stream.
+    void setEndToken(std::string_view value);
+
 protected:
-    DxfCode _dxfcode;
-    GroupCodeValueType _groupCodeValue;
-    DwgVariant _value;
+    DxfToken _token;
+    std::string _stringValue;
+    std::vector<unsigned char> _chunkValue;
     std::size_t _position;/// Current line or offset in the file
     std::string _valueRaw;
 };
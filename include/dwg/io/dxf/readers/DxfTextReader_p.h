@@ -22,9 +22,12 @@
 
 #pragma once
 
+#include <dwg/io/dxf/readers/DxfSectionIndex_p.h>
 #include <dwg/io/dxf/readers/DxfStreamReaderBase_p.h>
+#include <dwg/io/dxf/readers/DxfTextTokenizer_p.h>
 #include <dwg/utils/Encoding.h>
-#include <dwg/utils/StreamWrapper.h>
+#include <memory>
+#include <vector>
 
 namespace dwg {
 
@@ -32,10 +35,29 @@ class DxfTextReader : public DxfStreamReaderBase
 {
 public:
     DxfTextReader(std::iostream *stream, Encoding encoding);
+
+    /// Reader over [begin, end) of a buffer shared with other readers.
+    /// \details Past the end of the range the reader returns 0/ENDSEC, as if the range was a closed section.
+    DxfTextReader(std::shared_ptr<const std::vector<char>> buffer, std::size_t begin, std::size_t end,
+                  Encoding encoding);
     virtual ~DxfTextReader();
+
+    /// Sections of the buffer, scanned on first use.
+    const DxfSectionIndex &sectionIndex();
+
+    /// Independent reader over a single section, the buffer is not copied.
+    DxfTextReader *createSectionReader(const DxfSectionRange &section) const;
+
+    /// Moves the reader to the name of a section, the next read returns it.
+    void seekSection(const DxfSectionRange &section);
+
+    void setEncoding(const Encoding &encoding);
+
     void readNext() override;
+    void start() override;
 
     std::string readStringLine() override;
+    std::string_view readStringView() override;
     DxfCode readCode() override;
     bool lineAsBool() override;
     double lineAsDouble() override;
@@ -45,10 +67,18 @@ public:
     unsigned long long lineAsHandle() override;
     std::vector<unsigned char> lineAsBinaryChunk() override;
 
+private:
+    const std::string &readLine();
+
 private:
     Encoding _encoding;
     std::iostream *_stream;
-    StreamWrapper _wrapper;
+    std::shared_ptr<const std::vector<char>> _buffer;
+    std::size_t _begin;
+    std::size_t _end;
+    std::string_view _terminator;
+    DxfTextTokenizer _tokenizer;
+    std::unique_ptr<DxfSectionIndex> _sectionIndex;
 };
 
 }// namespace dwg
\ No newline at end of file
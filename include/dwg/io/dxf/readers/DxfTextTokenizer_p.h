@@ -0,0 +1,62 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace dwg {
+
+/// \brief Splits an ASCII DXF buffer into lines without copying.
+/// \details The buffer is owned by the caller and must outlive the tokenizer.
+/// Lines are returned as views into the buffer with the line terminator removed,
+/// both LF and CRLF endings are accepted.
+class DxfTextTokenizer
+{
+public:
+    DxfTextTokenizer();
+    DxfTextTokenizer(const char *data, std::size_t size);
+
+    void reset();
+    void seek(std::size_t offset);
+    bool atEnd() const;
+    std::size_t offset() const;
+
+    /// Next line, without the line terminator.
+    bool nextLine(std::string_view &line);
+
+    /// Next group code line, trimmed and parsed, false if the line is not a valid code.
+    bool nextCode(int &code);
+
+    /// Next group code and its value line.
+    bool next(int &code, std::string_view &value);
+
+    static std::string_view trim(std::string_view str);
+
+private:
+    const char *_begin;
+    const char *_end;
+    const char *_current;
+};
+
+}// namespace dwg
@@ -0,0 +1,75 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <dwg/DxfCode.h>
+#include <dwg/GroupCodeValueType.h>
+#include <string_view>
+
+namespace dwg {
+
+/// \brief Typed value of the current DXF group code.
+/// \details The numeric members share storage and only the one matching \c kind is valid.
+/// String and chunk values point to storage owned by the stream reader and are valid
+/// until the next call to \c readNext.
+struct DxfToken
+{
+    enum class Kind : unsigned char
+    {
+        None,
+        String,
+        Double,
+        Integer,
+        Handle,
+        Bool,
+        Chunk,
+    };
+
+    DxfCode code = DxfCode::Invalid;
+    GroupCodeValueType valueType = GroupCodeValueType::None;
+    Kind kind = Kind::None;
+
+    union
+    {
+        double doubleValue = 0.0;
+        long long intValue;
+        unsigned long long handleValue;
+        bool boolValue;
+    };
+
+    const char *data = nullptr;
+    std::size_t size = 0;
+
+    std::string_view stringView() const
+    {
+        return kind == Kind::String ? std::string_view(data, size) : std::string_view();
+    }
+
+    const unsigned char *chunkData() const
+    {
+        return reinterpret_cast<const unsigned char *>(data);
+    }
+};
+
+}// namespace dwg
@@ -24,7 +24,9 @@
 
 #include <dwg/DxfCode.h>
 #include <dwg/GroupCodeValueType.h>
+#include <dwg/io/dxf/readers/DxfToken_p.h>
 #include <dwg/utils/DwgVariant.h>
+#include <string_view>
 
 namespace dwg {
 
@@ -37,11 +39,18 @@ public:
     virtual GroupCodeValueType groupCodeValue() const = 0;
 
     virtual int code() const = 0;
+
+    /// Typed value of the current group code, valid until the next readNext.
+    virtual const DxfToken &token() const = 0;
+
+    /// Boxed copy of the current value, built on request.
     virtual DwgVariant value() const = 0;
 
     virtual size_t position() const = 0;
 
     virtual std::string valueAsString() const = 0;
+    /// Raw string value without unescaping, empty if the value is not a string.
+    virtual std::string_view valueAsStringView() const = 0;
     virtual std::string valueRaw() const = 0;
     virtual bool valueAsBool() const = 0;
     virtual short valueAsShort() const = 0;
@@ -24,23 +24,48 @@
 
 #include <dwg/io/dxf/writers/DxfStreamWriterBase_p.h>
 #include <dwg/utils/Encoding.h>
+#include <fmt/format.h>
 #include <fstream>
+#include <string_view>
 
 namespace dwg {
 
+/// \brief Writer for ASCII DXF.
+/// \details Lines are formatted into a memory buffer that is written to the stream
+/// in blocks of \c BufferSize bytes, the stream only sees the data on flush or close.
+/// The destructor flushes what is still buffered.
+/// A writer without stream keeps the whole output in memory.
 class DxfAsciiWriter : public DxfStreamWriterBase
 {
 public:
+    static constexpr std::size_t BufferSize = 1 << 16;
+
     DxfAsciiWriter(std::fstream *stream, Encoding encoding);
+    ~DxfAsciiWriter();
 
     void flush() override;
     void close() override;
     void writeDxfCode(int code) override;
     void writeValue(int code, DwgVariant value) override;
+    void writeStringValue(int code, std::string_view value) override;
+    IDxfStreamWriter *createMemoryWriter() const override;
+    void writeBuffer(const IDxfStreamWriter *memoryWriter) override;
+
+    int doublePrecision() const;
+    /// Fixed digits after the decimal point, negative for the shortest round trip string.
+    void setDoublePrecision(int value);
+
+private:
+    void writeDouble(double value);
+    void writeLine(std::string_view str);
+    void endLine();
+    void drain();
 
 private:
     std::fstream *_stream;
     Encoding _encoding;
+    fmt::memory_buffer _buffer;
+    int _doublePrecision;
 };
 
 }// namespace dwg
\ No newline at end of file
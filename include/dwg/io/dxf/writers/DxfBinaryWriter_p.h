@@ -24,23 +24,39 @@
 
 #include <dwg/io/dxf/writers/DxfStreamWriterBase_p.h>
 #include <dwg/utils/Encoding.h>
+#include <fmt/format.h>
 #include <fstream>
 
 namespace dwg {
 
+/// \brief Writer for binary DXF.
+/// \details Values are collected in a memory buffer written to the stream in blocks of
+/// \c BufferSize bytes, a writer without stream keeps the whole output in memory.
+/// The destructor flushes what is still buffered.
 class DxfBinaryWriter : public DxfStreamWriterBase
 {
 public:
+    static constexpr std::size_t BufferSize = 1 << 16;
+
     DxfBinaryWriter(std::fstream *stream, Encoding encoding);
+    ~DxfBinaryWriter();
 
     void flush() override;
     void close() override;
     void writeDxfCode(int code) override;
     void writeValue(int code, DwgVariant value) override;
+    void writeStringValue(int code, std::string_view value) override;
+    IDxfStreamWriter *createMemoryWriter() const override;
+    void writeBuffer(const IDxfStreamWriter *memoryWriter) override;
+
+private:
+    void writeBytes(const void *data, std::size_t size);
+    void drain();
 
 private:
     std::fstream *_stream;
     Encoding _encoding;
+    fmt::memory_buffer _buffer;
 };
 
 }// namespace dwg
\ No newline at end of file
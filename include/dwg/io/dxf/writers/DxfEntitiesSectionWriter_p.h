@@ -35,6 +35,9 @@ public:
 
     std::string sectionName() const override;
     void writeSection() override;
+
+    /// Writes a single entity record, used to stream entities without a section loop.
+    void append(Entity *entity);
 };
 
 }// namespace dwg
\ No newline at end of file
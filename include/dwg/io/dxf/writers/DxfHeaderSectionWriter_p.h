@@ -23,6 +23,7 @@
 #pragma once
 
 #include <dwg/io/dxf/writers/DxfSectionWriterBase_p.h>
+#include <optional>
 
 namespace dwg {
 
@@ -35,6 +36,12 @@ public:
 
     std::string sectionName() const override;
     void writeSection() override;
+
+    /// Writes \c value as $HANDSEED instead of the handle seed of the document header.
+    void setHandleSeed(unsigned long long value);
+
+private:
+    std::optional<unsigned long long> _handleSeed;
 };
 
 }// namespace dwg
\ No newline at end of file
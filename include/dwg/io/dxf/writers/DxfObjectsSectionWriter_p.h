@@ -53,6 +53,7 @@ public:
 
 protected:
     void writeObject(CadObject *co);
+    void writeUnlistedObject(CadObject *co);
     void writeBookColor(BookColor *color);
     void writeDictionary(CadDictionary *e);
     void writeDictionaryVariable(DictionaryVariable *dictvar);
@@ -22,9 +22,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <dwg/ACadVersion.h>
 #include <dwg/io/Notification.h>
+#include <dwg/io/dxf/CadObjectHolder_p.h>
 #include <dwg/io/dxf/DxfWriterConfiguration.h>
+#include <dwg/io/dxf/writers/IDxfStreamWriter_p.h>
+#include <dwg/utils/Delegate.h>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
 
 namespace dwg {
 
@@ -85,6 +93,8 @@ public:
     ACadVersion version() const;
     CadObjectHolder *holder();
 
+    Delegate<void(const std::string &, Notification)> OnNotification;
+
 protected:
     virtual void writeSection() = 0;
     void writeCommonObjectData(CadObject *object);
@@ -93,9 +103,28 @@ protected:
     void writeLongTextValue(int code, int subcode, const std::string &text);
     void writeEntity(Entity *entity);
 
+    /// Formats the items [0, count) with \c fn on worker threads and appends the output in item order.
+    /// \details Each worker gets a section writer of type \c Writer over a memory writer and an object
+    /// holder of its own. The output, the queued objects and the notifications are merged in order, the
+    /// result is the same as calling \c fn for every item on this writer, whatever the number of threads
+    /// set in the configuration.
+    template<typename Writer, typename Fn>
+    void writeInParallel(std::size_t count, Fn fn);
+
     void notify(const std::string &, Notification notificationType = Notification::None);
 
 private:
+    /// Notifications of a worker writer, replayed on the calling thread once the worker is done.
+    struct NotificationLog
+    {
+        std::vector<std::pair<std::string, Notification>> entries;
+        void add(const std::string &message, Notification notificationType)
+        {
+            entries.emplace_back(message, notificationType);
+        }
+    };
+
+    void writeUnlistedEntity(Entity *entity);
     void writeArc(Arc *arc);
     void writeCircle(Circle *circle);
     void writeDimension(Dimension *dim);
@@ -142,4 +171,61 @@ protected:
     DxfWriterConfiguration _configuration;
 };
 
+template<typename Writer, typename Fn>
+inline void DxfSectionWriterBase::writeInParallel(std::size_t count, Fn fn)
+{
+    std::size_t threads = _configuration.sectionThreads() > 0 ? (std::size_t) _configuration.sectionThreads()
+                                                              : std::max(1u, std::thread::hardware_concurrency());
+    std::size_t workers = std::min(threads, count);
+    if (workers < 2)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            fn(static_cast<Writer &>(*this), i);
+        }
+        return;
+    }
+
+    //Contiguous ranges, one for each worker
+    std::vector<std::unique_ptr<IDxfStreamWriter>> buffers(workers);
+    std::vector<CadObjectHolder> holders(workers);
+    std::vector<NotificationLog> logs(workers);
+    std::vector<std::future<void>> tasks;
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+        buffers[w].reset(_writer->createMemoryWriter());
+        tasks.push_back(std::async(std::launch::async, [&, w]() {
+            Writer writer(buffers[w].get(), _document, &holders[w], _configuration);
+            writer.OnNotification.add(&logs[w], &NotificationLog::add);
+            for (std::size_t i = count * w / workers; i < count * (w + 1) / workers; ++i)
+            {
+                fn(writer, i);
+            }
+        }));
+    }
+
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+        tasks[w].get();
+        _writer->writeBuffer(buffers[w].get());
+
+        for (const std::pair<std::string, Notification> &entry: logs[w].entries)
+        {
+            notify(entry.first, entry.second);
+        }
+
+        CadObjectHolder &holder = holders[w];
+        while (!holder.entities().empty())
+        {
+            _holder->entities().push(holder.entities().front());
+            holder.entities().pop();
+        }
+        while (!holder.objects().empty())
+        {
+            _holder->objects().push(holder.objects().front());
+            holder.objects().pop();
+        }
+    }
+}
+
 }// namespace dwg
@@ -39,6 +39,10 @@ public:
 
     void write(int code, DwgVariant value, DxfClassMap *clsmap = nullptr) override;
 
+    void writeToken(DxfCode code, std::string_view value) override;
+
+    void writeToken(int code, std::string_view value) override;
+
     void writeTrueColor(int code, const Color &color, DxfClassMap *clsmap = nullptr) override;
 
     void writeCmColor(int code, const Color &color, DxfClassMap *clsmap = nullptr) override;
@@ -50,6 +54,11 @@ public:
 protected:
     virtual void writeDxfCode(int code) = 0;
     virtual void writeValue(int code, DwgVariant value) = 0;
+    virtual void writeStringValue(int code, std::string_view value) = 0;
+
+private:
+    void writeEscapedString(int code, std::string_view value);
+    void writeCoordinate(int code, const DwgVariant &value);
 
 private:
     bool _writeOptional = false;
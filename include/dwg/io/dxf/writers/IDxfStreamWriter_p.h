@@ -26,6 +26,7 @@
 #include <dwg/Color.h>
 #include <dwg/DxfCode.h>
 #include <dwg/utils/DwgVariant.h>
+#include <string_view>
 
 
 namespace dwg {
@@ -44,6 +45,12 @@ public:
 
     virtual void write(int code, DwgVariant value, DxfClassMap *clsmap = nullptr) = 0;
 
+    /// Writes a string value without wrapping it in a DwgVariant, used for
+    /// object names and subclass markers that are written for every object.
+    virtual void writeToken(DxfCode code, std::string_view value) = 0;
+
+    virtual void writeToken(int code, std::string_view value) = 0;
+
     virtual void writeTrueColor(int code, const Color &color, DxfClassMap *clsmap = nullptr) = 0;
 
     virtual void writeCmColor(int code, const Color &color, DxfClassMap *clsmap = nullptr) = 0;
@@ -55,6 +62,12 @@ public:
     virtual void flush() = 0;
 
     virtual void close() = 0;
+
+    /// Writer with the same format and options that keeps its output in memory.
+    virtual IDxfStreamWriter *createMemoryWriter() const = 0;
+
+    /// Appends the output of a writer created by createMemoryWriter.
+    virtual void writeBuffer(const IDxfStreamWriter *memoryWriter) = 0;
 };
 
 }// namespace dwg
\ No newline at end of file
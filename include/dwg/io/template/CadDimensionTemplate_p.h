@@ -33,7 +33,7 @@ public:
     DimensionPlaceHolder();
     ObjectType objectType() const override;
     double measurement() const override;
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 };
 
 class CadDimensionTemplate : public CadEntityTemplate
@@ -40,6 +40,10 @@ public:
     CadTemplate(CadObject *obj);
     virtual ~CadTemplate() noexcept {}
 
+    /// Templates only live while the document is read, they are allocated from the reader resource.
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size);
+
     CadObject *cadObject() const;
     void setCadObject(CadObject *v);
 
@@ -99,9 +103,7 @@ public:
 
     T cadObjectT() const
     {
-        auto o = rawObject();
-        auto t = dynamic_cast<T>(o);
-        return t;
+        return object_cast<std::remove_pointer_t<T>>(rawObject());
     }
     void setCadObjectT(T v)
     {
@@ -39,10 +39,10 @@ public:
     ~BookColor();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
-    std::string name() const override;
+    const std::string &name() const override;
     void setName(const std::string &) override;
 
     std::string colorName() const;
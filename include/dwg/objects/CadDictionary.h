@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <dwg/CadNameIndex.h>
+#include <dwg/CadStringPool.h>
 #include <dwg/IObservableCadCollection.h>
 #include <dwg/objects/DictionaryCloningFlags.h>
 #include <dwg/objects/NonGraphicalObject.h>
@@ -35,10 +37,13 @@ class LIBDWG_API CadDictionary : public NonGraphicalObject, public IObservableCa
 {
     struct StringComparerOrdinalIgnoreCase
     {
-        bool operator()(const std::string &lhs, const std::string &rhs) const;
+        bool operator()(std::string_view lhs, std::string_view rhs) const;
     };
 
-    std::map<std::string, NonGraphicalObject *, StringComparerOrdinalIgnoreCase> _entries;
+    CadStringPool _keys;              /**< Keys while the dictionary is not in a document. */
+    CadStringPool *_keyPool = &_keys; /**< Pool holding the keys, the one of the document once assigned. */
+    std::map<std::string_view, NonGraphicalObject *, StringComparerOrdinalIgnoreCase> _entries;
+    CadNameIndex _names;
     bool _hardOwnerFlag;
     DictionaryCloningFlags _clonningFlags;
 
@@ -71,10 +76,13 @@ public:
     virtual ~CadDictionary();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
     std::vector<CadObject *> rawCadObjects() const override;
 
+    void assignDocument(CadDocument *doc) override;
+    void unassignDocument() override;
+
     bool hardOwnerFlag() const;
     void setHardOwnerFlag(bool);
 
@@ -100,12 +108,13 @@ public:
         static_assert(std::is_base_of<NonGraphicalObject, std::remove_pointer_t<T>>::value,
                       "T must point to a type derived from NonGraphicalObject.");
 
-        return dynamic_cast<T>(value(name));
+        return object_cast<std::remove_pointer_t<T>>(value(name));
     }
 
 public:
-    using iterator = std::map<std::string, NonGraphicalObject *, StringComparerOrdinalIgnoreCase>::iterator;
-    using const_iterator = std::map<std::string, NonGraphicalObject *, StringComparerOrdinalIgnoreCase>::const_iterator;
+    using iterator = std::map<std::string_view, NonGraphicalObject *, StringComparerOrdinalIgnoreCase>::iterator;
+    using const_iterator =
+            std::map<std::string_view, NonGraphicalObject *, StringComparerOrdinalIgnoreCase>::const_iterator;
 
     iterator begin()
     {
@@ -213,7 +222,10 @@ public:
 
 private:
     CadDictionary *ensureCadDictionaryExist(const std::string &name);
-    void onEntryNameChanged(const std::string &olName, const std::string &newName);
+    void onEntryNameChanged(NonGraphicalObject *entry, const std::string &olName, const std::string &newName);
+    std::string_view internKey(std::string_view key);
+    void releaseKey(std::string_view key);
+    void moveKeys(CadStringPool *pool);
 };
 
 }// namespace dwg
\ No newline at end of file
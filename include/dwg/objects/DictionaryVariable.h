@@ -33,8 +33,8 @@ public:
     ~DictionaryVariable();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string value() const;
     void setValue(const std::string &);
@@ -53,8 +53,8 @@ public:
     ~GeoData();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     GeoDataVersion version() const;
     void setVersion(GeoDataVersion);
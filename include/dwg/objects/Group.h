@@ -37,8 +37,8 @@ public:
     ~Group();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string description() const;
     void setDescription(const std::string &);
@@ -35,8 +35,8 @@ public:
     ~ImageDefinitionReactor();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     int classVersion() const;
     void setClassVersion(int);
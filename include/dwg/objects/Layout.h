@@ -44,8 +44,8 @@ public:
     static constexpr auto PaperLayoutName = "Layout1";
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     LayoutFlags layoutFlags() const;
     void setLayoutFlags(LayoutFlags);
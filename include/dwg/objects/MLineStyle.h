@@ -50,8 +50,8 @@ public:
     static MLineStyle *Default();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     MLineStyleFlags flags() const;
     void setFlags(MLineStyleFlags);
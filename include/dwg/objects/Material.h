@@ -33,8 +33,8 @@ public:
     ~Material();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -85,8 +85,8 @@ public:
     ~MultiLeaderAnnotContext();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::vector<LeaderRoot> leaderRoots() const;
     double scaleFactor() const;
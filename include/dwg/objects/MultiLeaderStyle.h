@@ -56,8 +56,8 @@ public:
     ~MultiLeaderStyle();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     LeaderContentType contentType() const;
     void setContentType(LeaderContentType);
@@ -38,10 +38,11 @@ public:
     NonGraphicalObject(const std::string &name);
     virtual ~NonGraphicalObject() override;
 
-    virtual std::string name() const override;
+    virtual const std::string &name() const override;
     virtual void setName(const std::string &value);
 
-    Delegate<void(const std::string &, const std::string &)> OnNameChanged;
+    /// Raised before the name changes, with the object, its current name and the new one.
+    Delegate<void(NonGraphicalObject *, const std::string &, const std::string &)> OnNameChanged;
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -32,7 +32,7 @@ public:
     PdfUnderlayDefinition();
     ~PdfUnderlayDefinition() = default;
 
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 
     std::string page() const;
     void setPage(const std::string &);
@@ -42,8 +42,8 @@ public:
     ~PlotSettings();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string pageName() const;
     void setPageName(const std::string &);
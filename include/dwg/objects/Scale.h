@@ -39,8 +39,8 @@ public:
     static Scale *Default();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     double paperUnits() const;
     void setPaperUnits(double);
@@ -49,8 +49,8 @@ public:
     ~SortEntitiesTable();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     BlockRecord *blockOwner() const;
     void setBlockOwner(BlockRecord *);
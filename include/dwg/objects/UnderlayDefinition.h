@@ -35,7 +35,7 @@ public:
     ~UnderlayDefinition();
 
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     std::string file() const;
     void setFile(const std::string &);
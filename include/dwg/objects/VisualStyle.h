@@ -37,8 +37,8 @@ public:
     VisualStyle();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string rasterFile() const;
     void setRasterFile(const std::string &);
@@ -48,8 +48,8 @@ public:
     ~XRecord();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     DictionaryCloningFlags cloningFlags() const;
     void setCloningFlags(DictionaryCloningFlags);
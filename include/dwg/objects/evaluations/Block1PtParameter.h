@@ -33,7 +33,7 @@ public:
     Block1PtParameter();
     virtual ~Block1PtParameter();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     XYZ location() const;
     void setLocation(const XYZ &value);
@@ -33,7 +33,7 @@ public:
     Block2PtParameter();
     virtual ~Block2PtParameter();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     XYZ firstPoint() const;
     void setFirstPoint(const XYZ &);
@@ -32,7 +32,7 @@ public:
     BlockElement();
     virtual ~BlockElement();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     std::string elementName() const;
     void setElementName(const std::string &name);
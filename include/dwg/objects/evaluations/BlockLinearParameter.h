@@ -33,8 +33,8 @@ public:
     virtual ~BlockLinearParameter();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string label() const;
     void setLabel(const std::string &);
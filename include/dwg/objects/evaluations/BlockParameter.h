@@ -32,7 +32,7 @@ public:
     BlockParameter();
     virtual ~BlockParameter();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     bool value280() const;
     void setValue280(bool);
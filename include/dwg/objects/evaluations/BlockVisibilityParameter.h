@@ -42,7 +42,7 @@ public:
     BlockVisibilityParameter();
     ~BlockVisibilityParameter();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     std::vector<Entity *> entities() const;
     void setEntities(const std::vector<Entity *> &);
@@ -35,7 +35,7 @@ public:
     virtual ~EvaluationExpression();
 
     ObjectType objectType() const override;
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
     int value90() const;
     void setValue90(int value);
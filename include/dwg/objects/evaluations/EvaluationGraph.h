@@ -52,8 +52,8 @@ public:
     ~EvaluationGraph();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     int value96() const;
     void setValue96(int);
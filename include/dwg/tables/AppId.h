@@ -34,8 +34,8 @@ public:
     ~AppId();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
 public:
     static std::string DefaultName;
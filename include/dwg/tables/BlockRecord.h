@@ -63,8 +63,8 @@ public:
     static BlockRecord *PaperSpace();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     BlockEnd *blockEnd();
     void setBlockEnd(BlockEnd *);
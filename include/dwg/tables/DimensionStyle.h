@@ -58,8 +58,8 @@ public:
     ~DimensionStyle();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     std::string alternateDimensioningSuffix() const;
     void setAlternateDimensioningSuffix(const std::string &);
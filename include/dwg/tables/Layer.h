@@ -53,8 +53,8 @@ public:
     static Layer *Defpoints();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     LayerFlags flags() const;
     void setFlags(LayerFlags);
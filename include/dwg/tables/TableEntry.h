@@ -35,22 +35,32 @@ public:
     TableEntry(const std::string &name);
     virtual ~TableEntry();
 
-    std::string subclassMarker() const override;
+    std::string_view subclassMarker() const override;
 
-    virtual std::string name() const override;
+    /// The interned name while the entry is in a document, valid until the name changes.
+    virtual const std::string &name() const override;
     virtual void setName(const std::string &value);
 
+    /// \brief Whether both entries have the same name, case sensitive.
+    /// \details Entries of the same document share interned names, the check is a pointer comparison.
+    bool sameName(const TableEntry *other) const;
+
     StandardFlags flags() const;
     void setFlags(StandardFlags flags);
 
-    Delegate<void(const std::string &, const std::string &)> OnNameChanged;
+    /// Raised before the name changes, with the entry, its current name and the new one.
+    Delegate<void(TableEntry *, const std::string &, const std::string &)> OnNameChanged;
+
+    void assignDocument(CadDocument *doc) override;
+    void unassignDocument() override;
 
 protected:
     TableEntry();
 
 protected:
-    StandardFlags _flags; /**< Flags associated with the table entry. */
-    std::string _name;    /**< The name of the table entry. */
+    StandardFlags _flags;                       /**< Flags associated with the table entry. */
+    std::string _name;                          /**< The name of the table entry while it is not in a document. */
+    const std::string *_internedName = nullptr; /**< The name in the string pool of the document. */
 };
 
 }// namespace dwg
\ No newline at end of file
@@ -40,8 +40,8 @@ public:
     static TextStyle *Default();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     StyleFlags flags() const;
     void setFlags(StyleFlags);
@@ -50,8 +50,8 @@ public:
     static VPort *Default();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
 
     XY bottomLeft() const;
     void setBottomLeft(const XY &);
@@ -35,7 +35,7 @@ public:
     ~AppIdsTable();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 
 protected:
     std::vector<std::string> defaultEntries() const override;
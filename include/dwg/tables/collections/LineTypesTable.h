@@ -36,7 +36,7 @@ public:
     ~LineTypesTable();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 
     LineType *byLayer() const;
     LineType *byBlock() const;
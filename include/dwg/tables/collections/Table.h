@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <dwg/CadNameIndex.h>
 #include <dwg/CadObject.h>
+#include <dwg/CadStringPool.h>
 #include <dwg/IObservableCadCollection.h>
 #include <dwg/utils/Delegate.h>
 #include <map>
@@ -34,11 +36,17 @@ namespace dwg {
 
 class LIBDWG_API Table : public CadObject, public IObservableCadCollection
 {
+    struct StringComparerOrdinalIgnoreCase
+    {
+        bool operator()(std::string_view lhs, std::string_view rhs) const;
+    };
+
 public:
     using pointer = TableEntry *;
     using pointee = TableEntry;
-    using iterator = typename std::map<std::string, pointer>::iterator;
-    using const_iterator = typename std::map<std::string, pointer>::const_iterator;
+    using map_type = std::map<std::string_view, pointer, StringComparerOrdinalIgnoreCase>;
+    using iterator = typename map_type::iterator;
+    using const_iterator = typename map_type::const_iterator;
 
     static_assert(std::is_pointer<pointer>::value, "T must be a pointer type.");
     static_assert(std::is_base_of<TableEntry, pointee>::value, "T must point to a type derived from TableEntry.");
@@ -47,8 +55,8 @@ public:
     Table(CadDocument *document);
     ~Table();
 
-    std::string objectName() const override;
-    std::string subclassMarker() const override;
+    std::string_view objectName() const override;
+    std::string_view subclassMarker() const override;
     std::vector<CadObject *> rawCadObjects() const override;
 
     std::size_t size() const;
@@ -60,7 +68,7 @@ public:
     T valueT(const std::string &key) const
     {
         pointer ptr = value(key);
-        return dynamic_cast<T>(ptr);
+        return object_cast<std::remove_pointer_t<T>>(ptr);
     }
 
     iterator begin()
@@ -81,6 +89,9 @@ public:
     }
     void createDefaultEntries();
 
+    void assignDocument(CadDocument *doc) override;
+    void unassignDocument() override;
+
 protected:
     void addHandlePrefix(pointer v);
     void push_back(const std::string &n, pointer v);
@@ -89,10 +100,16 @@ protected:
 
 private:
     std::string createName() const;
-    void onEntryNameChanged(const std::string &oldname, const std::string &newname);
+    void onEntryNameChanged(TableEntry *entry, const std::string &oldname, const std::string &newname);
+    std::string_view internKey(std::string_view key);
+    void releaseKey(std::string_view key);
+    void moveKeys(CadStringPool *pool);
 
 private:
-    std::map<std::string, pointer> _entries;
+    CadStringPool _keys;              /**< Keys while the table is not in a document. */
+    CadStringPool *_keyPool = &_keys; /**< Pool holding the keys, the one of the document once assigned. */
+    map_type _entries;                /**< Entries by interned key, ordered for the writers. */
+    CadNameIndex _names;              /**< Entries by interned key, case-insensitive like the map. */
 };
 
 }// namespace dwg
\ No newline at end of file
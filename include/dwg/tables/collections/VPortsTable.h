@@ -22,7 +22,7 @@
 
 #pragma once
 
-#include <dwg/tables/View.h>
+#include <dwg/tables/VPort.h>
 #include <dwg/tables/collections/Table.h>
 
 namespace dwg {
@@ -35,7 +35,7 @@ public:
     ~VPortsTable();
 
     ObjectType objectType() const override;
-    std::string objectName() const override;
+    std::string_view objectName() const override;
 
     using Table::add;
     void add(VPort *item);
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "DelegateT.h"
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -47,6 +48,24 @@ class Delegate<Return(Args...)>
     // Mutex for thread-safe operations on the delegate list.
     std::mutex _mutex;
 
+    // Immutable copy of the list read by invocations, replaced on every change so invoking takes no lock.
+    typedef std::vector<ptr> Snapshot;
+    std::atomic<const Snapshot *> _snapshot{nullptr};
+
+    // Replaced copies, an invocation may still read them, they are freed with the delegate.
+    std::vector<std::unique_ptr<const Snapshot>> _retired;
+
+    // Publishes the current list to invocations, called with the mutex held.
+    void publish()
+    {
+        const Snapshot *snapshot = invoke_delegates.empty() ? nullptr : new Snapshot(invoke_delegates);
+        const Snapshot *previous = _snapshot.exchange(snapshot, std::memory_order_acq_rel);
+        if (previous)
+        {
+            _retired.emplace_back(previous);
+        }
+    }
+
 public:
     // Default constructor.
     Delegate() = default;
@@ -60,7 +79,9 @@ public:
     // Clears all delegates from the list.
     void clear()
     {
+        std::unique_lock<std::mutex> l(this->_mutex);
         invoke_delegates.clear();
+        publish();
     }
 
     // Add a static function delegate.
@@ -86,6 +107,7 @@ public:
             }
             // Add the delegate to the list.
             invoke_delegates.emplace_back(oneDelegate);
+            publish();
         }
     }
 
@@ -112,6 +134,7 @@ public:
             }
             // Add the delegate to the list.
             invoke_delegates.emplace_back(oneDelegate);
+            publish();
         }
     }
 
@@ -136,6 +159,7 @@ public:
                 {
                     // Erase the matching delegate.
                     invoke_delegates.erase(it);
+                    publish();
                     return;
                 }
                 ++it;
@@ -164,6 +188,7 @@ public:
                 {
                     // Erase the matching delegate.
                     invoke_delegates.erase(it);
+                    publish();
                     return;
                 }
                 ++it;
@@ -177,8 +202,15 @@ public:
         // Create a vector to store the return values.
         std::vector<Return> vecRt;
 
+        // Without any delegate there is nothing to invoke.
+        const Snapshot *delegates = _snapshot.load(std::memory_order_acquire);
+        if (!delegates)
+        {
+            return vecRt;
+        }
+
         // Iterate through each delegate and invoke it if valid.
-        for (auto &_invokeObj: invoke_delegates)
+        for (auto &_invokeObj: *delegates)
         {
             if (_invokeObj && _invokeObj->canInvoke())
             {
@@ -203,6 +235,24 @@ class Delegate<void(Args...)>
     // Mutex for thread-safe operations on the delegate list.
     std::mutex _mutex;
 
+    // Immutable copy of the list read by invocations, replaced on every change so invoking takes no lock.
+    typedef std::vector<ptr> Snapshot;
+    std::atomic<const Snapshot *> _snapshot{nullptr};
+
+    // Replaced copies, an invocation may still read them, they are freed with the delegate.
+    std::vector<std::unique_ptr<const Snapshot>> _retired;
+
+    // Publishes the current list to invocations, called with the mutex held.
+    void publish()
+    {
+        const Snapshot *snapshot = invoke_delegates.empty() ? nullptr : new Snapshot(invoke_delegates);
+        const Snapshot *previous = _snapshot.exchange(snapshot, std::memory_order_acq_rel);
+        if (previous)
+        {
+            _retired.emplace_back(previous);
+        }
+    }
+
 public:
     // Default constructor.
     Delegate() = default;
@@ -216,7 +266,9 @@ public:
     // Clears all delegates from the list.
     void clear()
     {
+        std::unique_lock<std::mutex> l(this->_mutex);
         invoke_delegates.clear();
+        publish();
     }
 
     // Add a static function delegate.
@@ -243,6 +295,7 @@ public:
             }
             // Add the delegate to the list.
             invoke_delegates.emplace_back(oneDelegate);
+            publish();
         }
         _mutex.unlock();
     }
@@ -271,6 +324,7 @@ public:
             }
             // Add the delegate to the list.
             invoke_delegates.emplace_back(oneDelegate);
+            publish();
         }
         _mutex.unlock();
     }
@@ -296,6 +350,7 @@ public:
                 {
                     // Erase the matching delegate.
                     invoke_delegates.erase(it);
+                    publish();
                     _mutex.unlock();
                     return;
                 }
@@ -326,6 +381,7 @@ public:
                 {
                     // Erase the matching delegate.
                     invoke_delegates.erase(it);
+                    publish();
                     _mutex.unlock();
                     return;
                 }
@@ -338,8 +394,15 @@ public:
     // Invoke all stored delegates with the given arguments.
     void operator()(Args... args)
     {
+        // Without any delegate there is nothing to invoke.
+        const Snapshot *delegates = _snapshot.load(std::memory_order_acquire);
+        if (!delegates)
+        {
+            return;
+        }
+
         // Iterate through each delegate and invoke it if valid.
-        for (auto &_invokeObj: invoke_delegates)
+        for (auto &_invokeObj: *delegates)
         {
             if (_invokeObj && _invokeObj->canInvoke())
             {
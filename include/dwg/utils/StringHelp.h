@@ -24,6 +24,7 @@
 
 #include <dwg/exports.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dwg {
@@ -32,35 +33,35 @@ class LIBDWG_API StringHelp
 {
     // parse string to number
 public:
-    static char parse8(const std::string &);
-    static bool tryParse8(const std::string &, char &);
+    static char parse8(std::string_view);
+    static bool tryParse8(std::string_view, char &);
 
-    static short parse16(const std::string &);
-    static bool tryParse16(const std::string &, short &);
+    static short parse16(std::string_view);
+    static bool tryParse16(std::string_view, short &);
 
-    static int parse32(const std::string &);
-    static bool tryParse32(const std::string &, int &value);
+    static int parse32(std::string_view);
+    static bool tryParse32(std::string_view, int &value);
 
-    static long long parse64(const std::string &);
-    static bool tryParse64(const std::string &, long long &value);
+    static long long parse64(std::string_view);
+    static bool tryParse64(std::string_view, long long &value);
 
-    static unsigned char parseUnsigned8(const std::string &);
-    static bool tryParseUnsigned8(const std::string &, unsigned char &);
+    static unsigned char parseUnsigned8(std::string_view);
+    static bool tryParseUnsigned8(std::string_view, unsigned char &);
 
-    static unsigned short parseUnsigned16(const std::string &);
-    static bool tryParseUnsigned16(const std::string &, unsigned short &);
+    static unsigned short parseUnsigned16(std::string_view);
+    static bool tryParseUnsigned16(std::string_view, unsigned short &);
 
-    static unsigned int parseUnsigned32(const std::string &);
-    static bool tryParseUnsigned32(const std::string &, unsigned int &value);
+    static unsigned int parseUnsigned32(std::string_view);
+    static bool tryParseUnsigned32(std::string_view, unsigned int &value);
 
-    static unsigned long long parseUnsigned64(const std::string &);
-    static bool tryParseUnsigned64(const std::string &, unsigned long long &value);
+    static unsigned long long parseUnsigned64(std::string_view);
+    static bool tryParseUnsigned64(std::string_view, unsigned long long &value);
 
-    static unsigned long long parseHex64(const std::string &);
-    static bool tryParseHex64(const std::string &, unsigned long long &value);
+    static unsigned long long parseHex64(std::string_view);
+    static bool tryParseHex64(std::string_view, unsigned long long &value);
 
-    static double parseFloat(const std::string &);
-    static bool tryParseFloat(const std::string &, double &value);
+    static double parseFloat(std::string_view);
+    static bool tryParseFloat(std::string_view, double &value);
 
     static bool parseBool(const std::string &);
     static bool tryParseBool(const std::string &, bool &value);
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <dwg/exports.h>
 #include <map>
 
@@ -37,6 +38,11 @@ class LIBDWG_API ExtendedDataDictionary
 
 public:
     ExtendedDataDictionary(CadObject *owner);
+
+    /// Allocated with the objects, see CadMemoryScope.
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size);
+
     void add(AppId *app);
     void add(AppId *app, ExtendedData *extendedData);
     std::map<AppId *, ExtendedData *> data() const;
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <dwg/DxfCode.h>
+#include <cstddef>
 #include <dwg/utils/DwgVariant.h>
 
 namespace dwg {
@@ -33,6 +34,11 @@ class LIBDWG_API ExtendedDataRecord
 {
 public:
     virtual ~ExtendedDataRecord() = default;
+
+    /// Records are allocated with the objects, see CadMemoryScope.
+    static void *operator new(std::size_t size);
+    static void operator delete(void *ptr, std::size_t size);
+
     DxfCode code() const;
     DwgVariant rawValue() const;
 
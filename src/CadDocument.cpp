@@ -74,7 +74,31 @@ CadDocument::CadDocument(ACadVersion version) : CadDocument(true)
     _header->setVersion(version);
 }
 
-CadDocument::~CadDocument() {}
+CadDocument::~CadDocument()
+{
+    //The objects may live in the memory resource, they are destroyed before it is released.
+    //The document is in the index as well and the objects do not delete each other, except for
+    //the seqends, which the collection of their entity deletes.
+    for (IHandledCadObject *object: _cadObjects.objects())
+    {
+        if (object != this && !dynamic_cast<Seqend *>(object))
+        {
+            delete object;
+        }
+    }
+    _cadObjects.clear();
+
+    delete _colors;
+    delete _layouts;
+    delete _groups;
+    delete _scales;
+    delete _mlineStyles;
+    delete _imageDefinitions;
+    delete _mleaderStyles;
+    delete _classes;
+    delete _summaryInfo;
+    delete _header;
+}
 
 void CadDocument::createDefaults()
 {
@@ -96,6 +120,11 @@ void CadDocument::createDefaults()
     _ucss = new UCSTable(this);
     _vports = new VPortsTable(this);
     _appIds = new AppIdsTable(this);
+    for (Table *table: std::initializer_list<Table *>{_blockRecords, _layers, _dimensionStyles, _textStyles,
+                                                      _lineTypes, _views, _ucss, _vports, _appIds})
+    {
+        registerCollection(table);
+    }
 
 
     //Root dictionary
@@ -185,6 +214,11 @@ unsigned long long CadDocument::handle() const
     return 0ULL;
 }
 
+IHandledCadObject *CadDocument::getCadObject(unsigned long long handle) const
+{
+    return _cadObjects.find(handle);
+}
+
 CadHeader *CadDocument::header() const
 {
     return _header;
@@ -321,65 +355,55 @@ BlockRecord *CadDocument::paperSpace() const
 void CadDocument::registerCollection(IObservableCadCollection *collection)
 {
     assert(collection);
-    AppIdsTable *appIds = dynamic_cast<AppIdsTable *>(collection);
-    if (appIds)
-    {
-        _appIds = appIds;
-        _appIds->setOwner(this);
-    }
-    BlockRecordsTable *blockRecords = dynamic_cast<BlockRecordsTable *>(collection);
-    if (blockRecords)
-    {
-        _blockRecords = blockRecords;
-        _blockRecords->setOwner(this);
-    }
-    DimensionStylesTable *dimensionStyles = dynamic_cast<DimensionStylesTable *>(collection);
-    if (dimensionStyles)
-    {
-        _dimensionStyles = dimensionStyles;
-        _dimensionStyles->setOwner(this);
-    }
-    LayersTable *layers = dynamic_cast<LayersTable *>(collection);
-    if (layers)
-    {
-        _layers = layers;
-        _layers->setOwner(this);
-    }
-    LineTypesTable *lineTypes = dynamic_cast<LineTypesTable *>(collection);
-    if (lineTypes)
-    {
-        _lineTypes = lineTypes;
-        _lineTypes->setOwner(this);
-    }
-    TextStylesTable *textStyles = dynamic_cast<TextStylesTable *>(collection);
-    if (textStyles)
-    {
-        _textStyles = textStyles;
-        _textStyles->setOwner(this);
-    }
-    UCSTable *ucss = dynamic_cast<UCSTable *>(collection);
-    if (ucss)
-    {
-        _ucss = ucss;
-        _ucss->setOwner(this);
-    }
-    ViewsTable *views = dynamic_cast<ViewsTable *>(collection);
-    if (views)
-    {
-        _views = views;
-        _views->setOwner(this);
-    }
-    VPortsTable *vports = dynamic_cast<VPortsTable *>(collection);
-    if (vports)
-    {
-        _vports = vports;
-        _vports->setOwner(this);
+
+    //The tables are told apart by their object type, a single cross cast instead of one per table
+    CadObject *cadObject = dynamic_cast<CadObject *>(collection);
+    switch (cadObject ? cadObject->objectType() : ObjectType::INVALID)
+    {
+        case ObjectType::APPID_CONTROL_OBJ:
+            _appIds = static_cast<AppIdsTable *>(cadObject);
+            _appIds->setOwner(this);
+            break;
+        case ObjectType::BLOCK_CONTROL_OBJ:
+            _blockRecords = static_cast<BlockRecordsTable *>(cadObject);
+            _blockRecords->setOwner(this);
+            break;
+        case ObjectType::DIMSTYLE_CONTROL_OBJ:
+            _dimensionStyles = static_cast<DimensionStylesTable *>(cadObject);
+            _dimensionStyles->setOwner(this);
+            break;
+        case ObjectType::LAYER_CONTROL_OBJ:
+            _layers = static_cast<LayersTable *>(cadObject);
+            _layers->setOwner(this);
+            break;
+        case ObjectType::LTYPE_CONTROL_OBJ:
+            _lineTypes = static_cast<LineTypesTable *>(cadObject);
+            _lineTypes->setOwner(this);
+            break;
+        case ObjectType::STYLE_CONTROL_OBJ:
+            _textStyles = static_cast<TextStylesTable *>(cadObject);
+            _textStyles->setOwner(this);
+            break;
+        case ObjectType::UCS_CONTROL_OBJ:
+            _ucss = static_cast<UCSTable *>(cadObject);
+            _ucss->setOwner(this);
+            break;
+        case ObjectType::VIEW_CONTROL_OBJ:
+            _views = static_cast<ViewsTable *>(cadObject);
+            _views->setOwner(this);
+            break;
+        case ObjectType::VPORT_CONTROL_OBJ:
+            _vports = static_cast<VPortsTable *>(cadObject);
+            _vports->setOwner(this);
+            break;
+        default:
+            break;
     }
 
     collection->OnAdd.add(this, &CadDocument::onAdd);
+    collection->OnAddRange.add(this, &CadDocument::onAddRange);
     collection->OnRemove.add(this, &CadDocument::onRemove);
 
-    CadObject *cadObject = dynamic_cast<CadObject *>(collection);
     if (cadObject)
     {
         addCadObject(cadObject);
@@ -399,7 +423,7 @@ void CadDocument::registerCollection(IObservableCadCollection *collection)
     auto &&items = collection->rawCadObjects();
     for (auto &&item: items)
     {
-        CadDictionary *dictionary = dynamic_cast<CadDictionary *>(item);
+        CadDictionary *dictionary = object_cast<CadDictionary>(item);
         if (dictionary)
         {
             registerCollection(dictionary);
@@ -414,23 +438,28 @@ void CadDocument::registerCollection(IObservableCadCollection *collection)
 void CadDocument::unregisterCollection(IObservableCadCollection *collection)
 {
     assert(collection);
-    AppIdsTable *appIds = dynamic_cast<AppIdsTable *>(collection);
-    BlockRecordsTable *blockRecords = dynamic_cast<BlockRecordsTable *>(collection);
-    DimensionStylesTable *dimensionStyles = dynamic_cast<DimensionStylesTable *>(collection);
-    LayersTable *layers = dynamic_cast<LayersTable *>(collection);
-    LineTypesTable *lineTypes = dynamic_cast<LineTypesTable *>(collection);
-    TextStylesTable *textStyles = dynamic_cast<TextStylesTable *>(collection);
-    UCSTable *ucss = dynamic_cast<UCSTable *>(collection);
-    ViewsTable *views = dynamic_cast<ViewsTable *>(collection);
-    VPortsTable *vports = dynamic_cast<VPortsTable *>(collection);
-    if (appIds || blockRecords || dimensionStyles || layers || lineTypes || textStyles || ucss || views || vports)
-    {
-        throw std::runtime_error("The collection cannot be removed from a document.");
+
+    CadObject *cadObject = dynamic_cast<CadObject *>(collection);
+    switch (cadObject ? cadObject->objectType() : ObjectType::INVALID)
+    {
+        case ObjectType::APPID_CONTROL_OBJ:
+        case ObjectType::BLOCK_CONTROL_OBJ:
+        case ObjectType::DIMSTYLE_CONTROL_OBJ:
+        case ObjectType::LAYER_CONTROL_OBJ:
+        case ObjectType::LTYPE_CONTROL_OBJ:
+        case ObjectType::STYLE_CONTROL_OBJ:
+        case ObjectType::UCS_CONTROL_OBJ:
+        case ObjectType::VIEW_CONTROL_OBJ:
+        case ObjectType::VPORT_CONTROL_OBJ:
+            throw std::runtime_error("The collection cannot be removed from a document.");
+        default:
+            break;
     }
+
     collection->OnAdd.remove(this, &CadDocument::onAdd);
+    collection->OnAddRange.remove(this, &CadDocument::onAddRange);
     collection->OnRemove.remove(this, &CadDocument::onRemove);
 
-    CadObject *cadObject = dynamic_cast<CadObject *>(collection);
     if (cadObject)
     {
         removeCadObject(cadObject);
@@ -451,7 +480,7 @@ void CadDocument::unregisterCollection(IObservableCadCollection *collection)
     auto &&items = collection->rawCadObjects();
     for (auto &&item: items)
     {
-        CadDictionary *dictionary = dynamic_cast<CadDictionary *>(item);
+        CadDictionary *dictionary = object_cast<CadDictionary>(item);
         if (dictionary)
         {
             unregisterCollection(dictionary);
@@ -463,10 +492,25 @@ void CadDocument::unregisterCollection(IObservableCadCollection *collection)
     }
 }
 
+CadStringPool &CadDocument::stringPool()
+{
+    return _stringPool;
+}
+
+std::shared_ptr<std::pmr::memory_resource> CadDocument::memoryResource() const
+{
+    return _memoryResource;
+}
+
+void CadDocument::setMemoryResource(const std::shared_ptr<std::pmr::memory_resource> &value)
+{
+    _memoryResource = value;
+}
+
 CadDocument::CadDocument(bool createDefaults)
 {
     _classes = new DxfClassCollection();
-    _cadObjects.insert({handle(), this});
+    _cadObjects.insert(handle(), this);
     if (createDefaults)
     {
         this->createDefaults();
@@ -495,6 +539,13 @@ CadDictionary *CadDocument::updateCollection(const std::string &dictName, bool c
     return dictionary;
 }
 
+unsigned long long CadDocument::reserveHandle()
+{
+    unsigned long long nextHandle = _header->handleSeed();
+    _header->setHandleSeed(nextHandle + 1);
+    return nextHandle;
+}
+
 void CadDocument::addCadObject(CadObject *cadObject)
 {
     if (cadObject->document())
@@ -503,20 +554,18 @@ void CadDocument::addCadObject(CadObject *cadObject)
                 fmt::format("The item with handle {} is already assigned to a document", cadObject->handle()));
     }
 
-    if (cadObject->handle() == 0 || _cadObjects.find(cadObject->handle()) != _cadObjects.end())
+    if (cadObject->handle() == 0 || _cadObjects.contains(cadObject->handle()))
     {
-        unsigned long long nextHandle = _header->handleSeed();
-        cadObject->setHandle(nextHandle);
-        _header->setHandleSeed(nextHandle + 1);
+        cadObject->setHandle(reserveHandle());
     }
     else if (cadObject->handle() >= _header->handleSeed())
     {
         _header->setHandleSeed(cadObject->handle() + 1);
     }
 
-    _cadObjects.insert({cadObject->handle(), cadObject});
+    _cadObjects.insert(cadObject->handle(), cadObject);
 
-    BlockRecord *record = dynamic_cast<BlockRecord *>(cadObject);
+    BlockRecord *record = object_cast<BlockRecord>(cadObject);
     if (record)
     {
         addCadObject(record->blockEntity());
@@ -525,12 +574,20 @@ void CadDocument::addCadObject(CadObject *cadObject)
     cadObject->assignDocument(this);
 }
 
-void CadDocument::removeCadObject(CadObject *cadObject) {}
+void CadDocument::removeCadObject(CadObject *cadObject)
+{
+    if (_cadObjects.find(cadObject->handle()) != cadObject || !_cadObjects.remove(cadObject->handle()))
+    {
+        return;
+    }
+
+    cadObject->unassignDocument();
+}
 
 void CadDocument::onAdd(CadObject *item)
 {
     assert(item);
-    CadDictionary *dictionary = dynamic_cast<CadDictionary *>(item);
+    CadDictionary *dictionary = object_cast<CadDictionary>(item);
     if (dictionary)
     {
         registerCollection(dictionary);
@@ -541,10 +598,19 @@ void CadDocument::onAdd(CadObject *item)
     }
 }
 
+void CadDocument::onAddRange(const std::vector<CadObject *> &items)
+{
+    _cadObjects.reserve(_cadObjects.size() + items.size());
+    for (auto &&item: items)
+    {
+        onAdd(item);
+    }
+}
+
 void CadDocument::onRemove(CadObject *item)
 {
     assert(item);
-    CadDictionary *dictionary = dynamic_cast<CadDictionary *>(item);
+    CadDictionary *dictionary = object_cast<CadDictionary>(item);
     if (dictionary)
     {
         unregisterCollection(dictionary);
@@ -0,0 +1,170 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadHandleIndex.h>
+
+namespace dwg {
+
+CadHandleIndex::CadHandleIndex() : _slots(MinCapacity), _mask(MinCapacity - 1), _size(0) {}
+
+IHandledCadObject *CadHandleIndex::find(unsigned long long handle) const
+{
+    //Empty slots have no object, the handle 0 is a valid key for the document itself
+    for (std::size_t i = indexOf(handle);; i = (i + 1) & _mask)
+    {
+        const Slot &slot = _slots[i];
+        if (!slot.object)
+        {
+            return nullptr;
+        }
+        if (slot.handle == handle)
+        {
+            return slot.object;
+        }
+    }
+}
+
+bool CadHandleIndex::contains(unsigned long long handle) const
+{
+    return find(handle) != nullptr;
+}
+
+bool CadHandleIndex::insert(unsigned long long handle, IHandledCadObject *object)
+{
+    if (!object)
+    {
+        return false;
+    }
+
+    //Keep the load under 1/2, probe sequences stay short with sequential handles
+    if ((_size + 1) * 2 > _slots.size())
+    {
+        rehash(_slots.size() * 2);
+    }
+
+    for (std::size_t i = indexOf(handle);; i = (i + 1) & _mask)
+    {
+        Slot &slot = _slots[i];
+        if (!slot.object)
+        {
+            slot.handle = handle;
+            slot.object = object;
+            ++_size;
+            return true;
+        }
+        if (slot.handle == handle)
+        {
+            return false;
+        }
+    }
+}
+
+bool CadHandleIndex::remove(unsigned long long handle)
+{
+    std::size_t i = indexOf(handle);
+    while (_slots[i].object && _slots[i].handle != handle)
+    {
+        i = (i + 1) & _mask;
+    }
+    if (!_slots[i].object)
+    {
+        return false;
+    }
+
+    //Backward shift, move up every following entry that the hole would cut from its home slot
+    for (std::size_t j = (i + 1) & _mask; _slots[j].object; j = (j + 1) & _mask)
+    {
+        std::size_t home = indexOf(_slots[j].handle);
+        if (((j - home) & _mask) >= ((j - i) & _mask))
+        {
+            _slots[i] = _slots[j];
+            i = j;
+        }
+    }
+    _slots[i] = Slot();
+    --_size;
+    return true;
+}
+
+void CadHandleIndex::reserve(std::size_t count)
+{
+    std::size_t capacity = _slots.size();
+    while (capacity < count * 2)
+    {
+        capacity *= 2;
+    }
+    if (capacity != _slots.size())
+    {
+        rehash(capacity);
+    }
+}
+
+void CadHandleIndex::clear()
+{
+    _slots.assign(MinCapacity, Slot());
+    _mask = MinCapacity - 1;
+    _size = 0;
+}
+
+std::size_t CadHandleIndex::size() const
+{
+    return _size;
+}
+
+std::vector<IHandledCadObject *> CadHandleIndex::objects() const
+{
+    std::vector<IHandledCadObject *> objects;
+    objects.reserve(_size);
+    for (const Slot &slot: _slots)
+    {
+        if (slot.object)
+        {
+            objects.push_back(slot.object);
+        }
+    }
+    return objects;
+}
+
+std::size_t CadHandleIndex::indexOf(unsigned long long handle) const
+{
+    //Fibonacci hashing, the high bits of the product are the well mixed ones
+    unsigned long long hash = handle * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(hash >> 32) & _mask;
+}
+
+void CadHandleIndex::rehash(std::size_t capacity)
+{
+    std::vector<Slot> slots(capacity);
+    slots.swap(_slots);
+    _mask = capacity - 1;
+    _size = 0;
+
+    for (const Slot &slot: slots)
+    {
+        if (slot.object)
+        {
+            insert(slot.handle, slot.object);
+        }
+    }
+}
+
+}// namespace dwg
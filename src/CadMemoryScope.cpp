@@ -0,0 +1,288 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <dwg/CadMemoryScope_p.h>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace dwg {
+
+namespace {
+
+thread_local std::pmr::memory_resource *_objectResource = nullptr;
+thread_local std::pmr::memory_resource *_templateResource = nullptr;
+
+constexpr std::size_t BlockAlignment = alignof(std::max_align_t);
+
+//Pool memory comes in regions aligned on their size, a region belongs to a single pool
+constexpr unsigned RegionShift = 20;
+constexpr std::size_t RegionSize = std::size_t(1) << RegionShift;
+
+//Pool of every region of the 48-bit address space, in two levels of 16384 entries. The lookup is
+//two atomic loads, so releasing a block never takes a lock and heap blocks are found in no region.
+class RegionMap
+{
+public:
+    static constexpr unsigned LeafBits = 14;
+    static constexpr std::size_t LeafSize = std::size_t(1) << LeafBits;
+    static constexpr unsigned AddressBits = 48;
+
+    void assign(const void *region, std::pmr::memory_resource *pool)
+    {
+        std::uintptr_t key = keyOf(region);
+        if (key >> (2 * LeafBits))
+        {
+            throw std::bad_alloc();
+        }
+        leaf(key >> LeafBits)[key & (LeafSize - 1)].store(pool, std::memory_order_release);
+    }
+
+    std::pmr::memory_resource *find(const void *ptr) const
+    {
+        std::uintptr_t key = keyOf(ptr);
+        if (key >> (2 * LeafBits))
+        {
+            return nullptr;
+        }
+        Leaf *entries = _leaves[key >> LeafBits].load(std::memory_order_acquire);
+        return entries ? entries[key & (LeafSize - 1)].load(std::memory_order_acquire) : nullptr;
+    }
+
+private:
+    using Leaf = std::atomic<std::pmr::memory_resource *>;
+
+    static std::uintptr_t keyOf(const void *ptr)
+    {
+        static_assert(AddressBits == RegionShift + 2 * LeafBits, "The map covers the address bits");
+        return reinterpret_cast<std::uintptr_t>(ptr) >> RegionShift;
+    }
+
+    //The leaves are never released, the regions of a range are usually used again
+    Leaf *leaf(std::uintptr_t index)
+    {
+        Leaf *entries = _leaves[index].load(std::memory_order_acquire);
+        if (entries)
+        {
+            return entries;
+        }
+
+        Leaf *created = new Leaf[LeafSize]();
+        if (!_leaves[index].compare_exchange_strong(entries, created, std::memory_order_acq_rel))
+        {
+            delete[] created;
+            return entries;
+        }
+        return created;
+    }
+
+private:
+    std::atomic<Leaf *> _leaves[LeafSize] = {};
+};
+
+RegionMap &regionMap()
+{
+    static RegionMap map;
+    return map;
+}
+
+//Upstream of a pool, hands out the chunks of the pool from regions mapped to it.
+//Small chunks share regions and stay until the tracker is destroyed, which is when the pool
+//releases them anyway, larger chunks get regions of their own and go back when released.
+class ChunkTracker : public std::pmr::memory_resource
+{
+public:
+    ChunkTracker(const std::shared_ptr<std::pmr::memory_resource> &upstream, std::pmr::memory_resource *pool)
+        : _upstream(upstream), _pool(pool), _next(nullptr), _end(nullptr)
+    {
+    }
+
+    ~ChunkTracker()
+    {
+        for (void *region: _regions)
+        {
+            release(region, RegionSize);
+        }
+    }
+
+private:
+    static constexpr std::size_t LargeChunk = RegionSize / 4;
+
+    std::pmr::memory_resource *upstream() const
+    {
+        return _upstream ? _upstream.get() : std::pmr::get_default_resource();
+    }
+
+    static std::size_t regionBytes(std::size_t bytes)
+    {
+        return (bytes + RegionSize - 1) & ~(RegionSize - 1);
+    }
+
+    void *reserve(std::size_t bytes)
+    {
+        void *region = upstream()->allocate(bytes, RegionSize);
+        for (std::size_t offset = 0; offset < bytes; offset += RegionSize)
+        {
+            regionMap().assign(static_cast<char *>(region) + offset, _pool);
+        }
+        return region;
+    }
+
+    void release(void *region, std::size_t bytes)
+    {
+        for (std::size_t offset = 0; offset < bytes; offset += RegionSize)
+        {
+            regionMap().assign(static_cast<char *>(region) + offset, nullptr);
+        }
+        upstream()->deallocate(region, bytes, RegionSize);
+    }
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        if (bytes > LargeChunk || alignment > LargeChunk)
+        {
+            return reserve(regionBytes(bytes));
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::uintptr_t next = reinterpret_cast<std::uintptr_t>(_next);
+        next = (next + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        if (!_next || next + bytes > reinterpret_cast<std::uintptr_t>(_end))
+        {
+            char *region = static_cast<char *>(reserve(RegionSize));
+            _regions.push_back(region);
+            _end = region + RegionSize;
+            next = reinterpret_cast<std::uintptr_t>(region);
+        }
+        _next = reinterpret_cast<char *>(next + bytes);
+        return reinterpret_cast<void *>(next);
+    }
+
+    void do_deallocate(void *chunk, std::size_t bytes, std::size_t alignment) override
+    {
+        if (bytes > LargeChunk || alignment > LargeChunk)
+        {
+            release(chunk, regionBytes(bytes));
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    std::shared_ptr<std::pmr::memory_resource> _upstream;
+    std::pmr::memory_resource *_pool;
+    std::mutex _mutex;
+    std::vector<void *> _regions;
+    char *_next;
+    char *_end;
+};
+
+//The tracker is declared first, the pool returns its chunks to it when destroyed
+class CadMemoryPool : public std::pmr::memory_resource
+{
+public:
+    explicit CadMemoryPool(const std::shared_ptr<std::pmr::memory_resource> &upstream)
+        : _tracker(upstream, this), _pool(&_tracker)
+    {
+    }
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        return _pool.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        _pool.deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    ChunkTracker _tracker;
+    std::pmr::synchronized_pool_resource _pool;
+};
+
+}// namespace
+
+CadMemoryScope::CadMemoryScope(std::pmr::memory_resource *objects, std::pmr::memory_resource *templates)
+    : _previousObjects(_objectResource), _previousTemplates(_templateResource)
+{
+    _objectResource = objects;
+    _templateResource = templates;
+}
+
+CadMemoryScope::~CadMemoryScope()
+{
+    _objectResource = _previousObjects;
+    _templateResource = _previousTemplates;
+}
+
+std::pmr::memory_resource *CadMemoryScope::objectResource()
+{
+    return _objectResource;
+}
+
+std::pmr::memory_resource *CadMemoryScope::templateResource()
+{
+    return _templateResource;
+}
+
+std::shared_ptr<std::pmr::memory_resource>
+        CadMemoryScope::createPool(const std::shared_ptr<std::pmr::memory_resource> &upstream)
+{
+    return std::make_shared<CadMemoryPool>(upstream);
+}
+
+void *CadMemoryScope::allocate(std::size_t size, std::pmr::memory_resource *resource)
+{
+    return resource ? resource->allocate(size, BlockAlignment) : ::operator new(size);
+}
+
+void CadMemoryScope::deallocate(void *ptr, std::size_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    std::pmr::memory_resource *pool = regionMap().find(ptr);
+    if (pool)
+    {
+        pool->deallocate(ptr, size, BlockAlignment);
+    }
+    else
+    {
+        ::operator delete(ptr, size);
+    }
+}
+
+}// namespace dwg
\ No newline at end of file
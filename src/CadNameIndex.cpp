@@ -0,0 +1,248 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadNameIndex.h>
+
+namespace dwg {
+
+namespace {
+
+inline unsigned char fold(char c)
+{
+    unsigned char u = static_cast<unsigned char>(c);
+    return (u >= 'A' && u <= 'Z') ? static_cast<unsigned char>(u | 0x20) : u;
+}
+
+}// namespace
+
+CadNameIndex::CadNameIndex() : _mask(0), _size(0) {}
+
+CadObject *CadNameIndex::find(std::string_view name) const
+{
+    if (_slots.empty())
+    {
+        return nullptr;
+    }
+
+    std::size_t i = slotOf(name, hash(name));
+    return _slots[i].object;
+}
+
+bool CadNameIndex::contains(std::string_view name) const
+{
+    return find(name) != nullptr;
+}
+
+bool CadNameIndex::insert(std::string_view name, CadObject *object)
+{
+    if (!object)
+    {
+        return false;
+    }
+
+    //Keep the load under 1/2, the slots are allocated with the first name
+    if ((_size + 1) * 2 > _slots.size())
+    {
+        rehash(_slots.empty() ? MinCapacity : _slots.size() * 2);
+    }
+
+    std::size_t h = hash(name);
+    Slot &slot = _slots[slotOf(name, h)];
+    if (slot.object)
+    {
+        return false;
+    }
+
+    slot.hash = h;
+    slot.name = name;
+    slot.object = object;
+    ++_size;
+    return true;
+}
+
+bool CadNameIndex::remove(std::string_view name)
+{
+    if (_slots.empty())
+    {
+        return false;
+    }
+
+    std::size_t i = slotOf(name, hash(name));
+    if (!_slots[i].object)
+    {
+        return false;
+    }
+
+    erase(i);
+    return true;
+}
+
+bool CadNameIndex::rename(std::string_view oldName, std::string_view newName)
+{
+    if (_slots.empty())
+    {
+        return false;
+    }
+
+    std::size_t oldHash = hash(oldName);
+    std::size_t i = slotOf(oldName, oldHash);
+    CadObject *object = _slots[i].object;
+    if (!object)
+    {
+        return false;
+    }
+
+    //Only the case changed, the entry keeps its slot
+    if (equals(oldName, newName))
+    {
+        _slots[i].name = newName;
+        return true;
+    }
+
+    if (contains(newName))
+    {
+        return false;
+    }
+
+    erase(i);
+    return insert(newName, object);
+}
+
+void CadNameIndex::reserve(std::size_t count)
+{
+    std::size_t capacity = _slots.empty() ? MinCapacity : _slots.size();
+    while (capacity < count * 2)
+    {
+        capacity *= 2;
+    }
+    if (capacity != _slots.size())
+    {
+        rehash(capacity);
+    }
+}
+
+void CadNameIndex::clear()
+{
+    _slots.clear();
+    _mask = 0;
+    _size = 0;
+}
+
+std::size_t CadNameIndex::size() const
+{
+    return _size;
+}
+
+std::size_t CadNameIndex::hash(std::string_view name)
+{
+    //FNV-1a over the folded bytes
+    unsigned long long h = 0xCBF29CE484222325ULL;
+    for (char c: name)
+    {
+        h ^= fold(c);
+        h *= 0x100000001B3ULL;
+    }
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+bool CadNameIndex::equals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        if (fold(a[i]) != fold(b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CadNameIndex::less(std::string_view a, std::string_view b)
+{
+    std::size_t n = a.size() < b.size() ? a.size() : b.size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned char ca = fold(a[i]);
+        unsigned char cb = fold(b[i]);
+        if (ca != cb)
+        {
+            return ca < cb;
+        }
+    }
+    return a.size() < b.size();
+}
+
+std::size_t CadNameIndex::slotOf(std::string_view name, std::size_t hash) const
+{
+    //Slot holding the name, or the empty slot that ends its probe sequence
+    for (std::size_t i = hash & _mask;; i = (i + 1) & _mask)
+    {
+        const Slot &slot = _slots[i];
+        if (!slot.object || (slot.hash == hash && equals(slot.name, name)))
+        {
+            return i;
+        }
+    }
+}
+
+void CadNameIndex::erase(std::size_t i)
+{
+    //Backward shift, move up every following entry that the hole would cut from its home slot
+    for (std::size_t j = (i + 1) & _mask; _slots[j].object; j = (j + 1) & _mask)
+    {
+        std::size_t home = _slots[j].hash & _mask;
+        if (((j - home) & _mask) >= ((j - i) & _mask))
+        {
+            _slots[i] = std::move(_slots[j]);
+            i = j;
+        }
+    }
+    _slots[i] = Slot();
+    --_size;
+}
+
+void CadNameIndex::rehash(std::size_t capacity)
+{
+    std::vector<Slot> slots(capacity);
+    slots.swap(_slots);
+    _mask = capacity - 1;
+
+    for (Slot &slot: slots)
+    {
+        if (slot.object)
+        {
+            //The stored hash is reused, a name is never hashed twice
+            std::size_t i = slot.hash & _mask;
+            while (_slots[i].object)
+            {
+                i = (i + 1) & _mask;
+            }
+            _slots[i] = std::move(slot);
+        }
+    }
+}
+
+}// namespace dwg
@@ -21,7 +21,9 @@
  */
 
 #include <dwg/CadDocument.h>
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/CadObject.h>
+#include <dwg/CadObjectExtension_p.h>
 #include <dwg/objects/CadDictionary.h>
 #include <dwg/objects/collections/ObjectDictionaryCollection.h>
 #include <dwg/tables/AppId.h>
@@ -31,16 +33,42 @@
 
 namespace dwg {
 
-CadObject::CadObject()
+CadObject::CadObject() {}
+
+CadObject::~CadObject()
+{
+    delete _extension;
+}
+
+void *CadObject::operator new(std::size_t size)
 {
-    _extendedData = new ExtendedDataDictionary(this);
+    return CadMemoryScope::allocate(size, CadMemoryScope::objectResource());
 }
 
-CadObject::~CadObject() {}
+void CadObject::operator delete(void *ptr, std::size_t size)
+{
+    CadMemoryScope::deallocate(ptr, size);
+}
 
-ExtendedDataDictionary *CadObject::extendedData() const
+ExtendedDataDictionary *CadObject::extendedData()
 {
-    return _extendedData;
+    CadObjectExtension *ext = extension();
+    if (!ext->extendedData)
+    {
+        ext->extendedData = new ExtendedDataDictionary(this);
+    }
+    return ext->extendedData;
+}
+
+const ExtendedDataDictionary *CadObject::extendedData() const
+{
+    return _extension ? _extension->extendedData : nullptr;
+}
+
+bool CadObject::hasExtendedData() const
+{
+    const ExtendedDataDictionary *extendedData = _extension ? _extension->extendedData : nullptr;
+    return extendedData && extendedData->begin() != extendedData->end();
 }
 
 unsigned long long CadObject::handle() const
@@ -55,7 +83,7 @@ IHandledCadObject *CadObject::owner() const
 
 CadDictionary *CadObject::xdictionary() const
 {
-    return _xdictionary;
+    return _extension ? _extension->xdictionary : nullptr;
 }
 
 CadDocument *CadObject::document() const
@@ -80,28 +108,34 @@ bool CadObject::hasDynamicSubclass() const
 
 std::vector<CadObject *> CadObject::reactors() const
 {
-    return _reactors;
+    return _extension ? _extension->reactors : std::vector<CadObject *>();
 }
 
 std::vector<CadObject *> &CadObject::reactors()
 {
-    return _reactors;
+    return extension()->reactors;
 }
 
 void CadObject::clearReactors() {}
 
 void CadObject::addReactor(CadObject *reactor)
 {
-    _reactors.push_back(reactor);
+    extension()->reactors.push_back(reactor);
 }
 
 bool CadObject::removeReactor(CadObject *reactor)
 {
-    for (auto it = _reactors.begin(); it != _reactors.end(); ++it)
+    if (!_extension)
+    {
+        return false;
+    }
+
+    std::vector<CadObject *> &reactors = _extension->reactors;
+    for (auto it = reactors.begin(); it != reactors.end(); ++it)
     {
         if (*it == reactor)
         {
-            _reactors.erase(it);
+            reactors.erase(it);
             return true;
         }
     }
@@ -120,36 +154,60 @@ void CadObject::setOwner(IHandledCadObject *obj)
 
 void CadObject::setExtendedData(ExtendedDataDictionary *value)
 {
-    _extendedData = value;
+    if (!_extension && !value)
+    {
+        return;
+    }
+
+    //The extension owns the dictionary, the one replaced is released
+    CadObjectExtension *ext = extension();
+    if (ext->extendedData != value)
+    {
+        delete ext->extendedData;
+        ext->extendedData = value;
+    }
 }
 
 void CadObject::setXDictionary(CadDictionary *value)
 {
-    _xdictionary = value;
+    if (_extension || value)
+    {
+        extension()->xdictionary = value;
+    }
 }
 
 void CadObject::assignDocument(CadDocument *doc)
 {
     _document = doc;
-    if (_xdictionary)
+    if (CadDictionary *xdictionary = this->xdictionary())
     {
-        doc->registerCollection(_xdictionary);
+        doc->registerCollection(xdictionary);
     }
 
-    if (!_extendedData->data().empty())
+    if (hasExtendedData())
     {
-        auto &&entries = _extendedData->data();
-        _extendedData->clear();
+        ExtendedDataDictionary *extendedData = _extension->extendedData;
+        auto &&entries = extendedData->data();
+        extendedData->clear();
 
         for (auto &&[key, value]: entries)
         {
-            _extendedData->add(dynamic_cast<AppId *>(key->clone()), value);
+            extendedData->add(dynamic_cast<AppId *>(key->clone()), value);
         }
     }
 }
 
 void CadObject::unassignDocument() {}
 
+CadObjectExtension *CadObject::extension()
+{
+    if (!_extension)
+    {
+        _extension = new CadObjectExtension();
+    }
+    return _extension;
+}
+
 NonGraphicalObject *CadObject::updateCollection(NonGraphicalObject *entry, ObjectDictionaryCollection *collection)
 {
     if (!entry || !collection)
@@ -0,0 +1,81 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadStringPool.h>
+
+namespace dwg {
+
+CadStringPool::CadStringPool() {}
+
+CadStringPool::~CadStringPool() {}
+
+const std::string *CadStringPool::intern(std::string_view value)
+{
+    auto it = _strings.find(value);
+    if (it != _strings.end())
+    {
+        ++it->second.references;
+        return it->second.value.get();
+    }
+
+    auto str = std::make_unique<std::string>(value);
+    const std::string *result = str.get();
+    _strings.emplace(std::string_view(*result), Entry{std::move(str), 1});
+    return result;
+}
+
+void CadStringPool::release(const std::string *value)
+{
+    if (!value)
+    {
+        return;
+    }
+
+    auto it = _strings.find(std::string_view(*value));
+    if (it == _strings.end() || it->second.value.get() != value)
+    {
+        return;
+    }
+
+    if (--it->second.references == 0)
+    {
+        _strings.erase(it);
+    }
+}
+
+const std::string *CadStringPool::find(std::string_view value) const
+{
+    auto it = _strings.find(value);
+    return it != _strings.end() ? it->second.value.get() : nullptr;
+}
+
+void CadStringPool::clear()
+{
+    _strings.clear();
+}
+
+std::size_t CadStringPool::size() const
+{
+    return _strings.size();
+}
+
+}// namespace dwg
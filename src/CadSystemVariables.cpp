@@ -21,13 +21,16 @@
  */
 
 #include <assert.h>
+#include <cstdint>
 #include <dwg/CadSystemVariables_p.h>
+#include <dwg/CadUtils.h>
 #include <dwg/attributes/CadSystemVariableAttribute_p.h>
 #include <dwg/header/CadHeader.h>
 #include <dwg/utils/StringHelp.h>
 #include <initializer_list>
 #include <memory>
 #include <rttr/registration>
+#include <string_view>
 #include <vector>
 
 namespace dwg {
@@ -284,12 +287,1320 @@ static std::vector<CadSystemVariableAttribute> _headerVariables = {
         {CadSystemVariables::XEDIT, {290}},
 };
 
+namespace {
+
+using HeaderValues = std::vector<DwgVariant>;
+
+//Reads or writes one header variable, the setter receives the values of the variable group codes in order
+struct HeaderVariableThunk
+{
+    const char *name;
+    DwgVariant (*get)(CadHeader *);
+    void (*set)(CadHeader *, const HeaderValues &);
+};
+
+constexpr double MicrosecondsPerDay = 24.0 * 60.0 * 60.0 * 1000000.0;
+
+constexpr HeaderVariableThunk _headerThunks[] = {
+        {CadSystemVariables::ANGBASE,
+         [](CadHeader *header) -> DwgVariant { return header->angleBase(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setAngleBase(values[0].convert<double>()); }},
+        {CadSystemVariables::ANGDIR,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->angularDirection()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setAngularDirection(static_cast<AngularDirection>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::AUNITS,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->angularUnit()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setAngularUnit(static_cast<AngularUnitFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::AUPREC,
+         [](CadHeader *header) -> DwgVariant { return header->angularUnitPrecision(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setAngularUnitPrecision(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMLDRBLK,
+         [](CadHeader *header) -> DwgVariant { return header->arrowBlockName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setArrowBlockName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMASO,
+         [](CadHeader *header) -> DwgVariant { return header->associatedDimensions(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setAssociatedDimensions(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::ATTMODE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<int>(header->attributeVisibility()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setAttributeVisibility(static_cast<AttributeVisibilityMode>(values[0].convert<int>()));
+         }},
+        {CadSystemVariables::BLIPMODE,
+         [](CadHeader *header) -> DwgVariant { return header->blipMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setBlipMode(values[0].convert<bool>()); }},
+        {CadSystemVariables::CAMERADISPLAY,
+         [](CadHeader *header) -> DwgVariant { return header->cameraDisplayObjects(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCameraDisplayObjects(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::CAMERAHEIGHT,
+         [](CadHeader *header) -> DwgVariant { return header->cameraHeight(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setCameraHeight(values[0].convert<double>()); }},
+        {CadSystemVariables::CHAMFERD,
+         [](CadHeader *header) -> DwgVariant { return header->chamferAngle(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setChamferAngle(values[0].convert<double>()); }},
+        {CadSystemVariables::CHAMFERA,
+         [](CadHeader *header) -> DwgVariant { return header->chamferDistance1(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setChamferDistance1(values[0].convert<double>());
+         }},
+        {CadSystemVariables::CHAMFERB,
+         [](CadHeader *header) -> DwgVariant { return header->chamferDistance2(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setChamferDistance2(values[0].convert<double>());
+         }},
+        {CadSystemVariables::CHAMFERC,
+         [](CadHeader *header) -> DwgVariant { return header->chamferLength(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setChamferLength(values[0].convert<double>()); }},
+        {CadSystemVariables::DWGCODEPAGE,
+         [](CadHeader *header) -> DwgVariant { return header->codePage(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setCodePage(values[0].convert<std::string>()); }},
+        {CadSystemVariables::TDCREATE,
+         [](CadHeader *header) -> DwgVariant { return header->createDateTime(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCreateDateTime(CadUtils::FromJulianCalendar(values[0].convert<double>()));
+         }},
+        {CadSystemVariables::PELLIPSE,
+         [](CadHeader *header) -> DwgVariant { return header->createEllipseAsPolyline(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCreateEllipseAsPolyline(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::CECOLOR,
+         [](CadHeader *header) -> DwgVariant { return header->currentEntityColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentEntityColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::CELTSCALE,
+         [](CadHeader *header) -> DwgVariant { return header->currentEntityLinetypeScale(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentEntityLinetypeScale(values[0].convert<double>());
+         }},
+        {CadSystemVariables::CELWEIGHT,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->currentEntityLineWeight()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentEntityLineWeight(static_cast<LineweightType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::CEPSNTYPE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->currentEntityPlotStyle()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentEntityPlotStyle(static_cast<EntityPlotStyleType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::CLAYER,
+         [](CadHeader *header) -> DwgVariant { return header->currentLayerName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentLayerName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::CELTYPE,
+         [](CadHeader *header) -> DwgVariant { return header->currentLineTypeName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentLineTypeName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::CMLJUST,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->currentMultilineJustification()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentMultilineJustification(static_cast<VerticalAlignmentType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::CMLSCALE,
+         [](CadHeader *header) -> DwgVariant { return header->currentMultilineScale(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentMultilineScale(values[0].convert<double>());
+         }},
+        {CadSystemVariables::CMLSTYLE,
+         [](CadHeader *header) -> DwgVariant { return header->currentMultiLineStyleName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentMultiLineStyleName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DGNFRAME,
+         [](CadHeader *header) -> DwgVariant { return header->dgnUnderlayFramesVisibility(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDgnUnderlayFramesVisibility(values[0].convert<char>());
+         }},
+        {CadSystemVariables::DIMAPOST,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateDimensioningSuffix(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateDimensioningSuffix(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMALTD,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateUnitDecimalPlaces(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitDecimalPlaces(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMALT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateUnitDimensioning(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitDimensioning(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMALTU,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionAlternateUnitFormat()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitFormat(static_cast<LinearUnitFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMALTRND,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateUnitRounding(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitRounding(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMALTF,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateUnitScaleFactor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitScaleFactor(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMALTTD,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAlternateUnitToleranceDecimalPlaces(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitToleranceDecimalPlaces(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMALTTZ,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionAlternateUnitToleranceZeroHandling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitToleranceZeroHandling(static_cast<ZeroHandling>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMALTZ,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionAlternateUnitZeroHandling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAlternateUnitZeroHandling(static_cast<ZeroHandling>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMALTMZF,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAltMzf(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAltMzf(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMALTMZS,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAltMzs(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAltMzs(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMADEC,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionAngularDimensionDecimalPlaces(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAngularDimensionDecimalPlaces(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMAUNIT,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionAngularUnit()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAngularUnit(static_cast<AngularUnitFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMAZIN,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionAngularZeroHandling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAngularZeroHandling(static_cast<ZeroHandling>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMARCSYM,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionArcLengthSymbolPosition()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionArcLengthSymbolPosition(static_cast<ArcLengthSymbolPosition>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMASZ,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionArrowSize(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionArrowSize(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMASSOC,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionAssociativity()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionAssociativity(static_cast<DimensionAssociation>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMBLK,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionBlockName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionBlockName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMBLK1,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionBlockNameFirst(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionBlockNameFirst(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMBLK2,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionBlockNameSecond(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionBlockNameSecond(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMCEN,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionCenterMarkSize(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionCenterMarkSize(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMUPT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionCursorUpdate(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionCursorUpdate(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMDEC,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionDecimalPlaces(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionDecimalPlaces(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMDSEP,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionDecimalSeparator(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionDecimalSeparator(values[0].convert<char>());
+         }},
+        {CadSystemVariables::DIMATFIT,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionDimensionTextArrowFit()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionDimensionTextArrowFit(static_cast<TextArrowFitType>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMCLRE,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionExtensionLineColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionExtensionLineColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMEXE,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionExtensionLineExtension(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionExtensionLineExtension(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMEXO,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionExtensionLineOffset(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionExtensionLineOffset(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMFIT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionFit(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setDimensionFit(values[0].convert<short>()); }},
+        {CadSystemVariables::DIMFXL,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionFixedExtensionLineLength(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionFixedExtensionLineLength(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMFRAC,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionFractionFormat()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionFractionFormat(static_cast<FractionFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMTOL,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionGenerateTolerances(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionGenerateTolerances(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMFXLON,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionIsExtensionLineLengthFixed(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionIsExtensionLineLengthFixed(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMJOGANG,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionJoggedRadiusDimensionTransverseSegmentAngle(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionJoggedRadiusDimensionTransverseSegmentAngle(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMLIM,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLimitsGeneration(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLimitsGeneration(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMLFAC,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLinearScaleFactor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLinearScaleFactor(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMLUNIT,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionLinearUnitFormat()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLinearUnitFormat(static_cast<LinearUnitFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMCLRD,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLineColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMDLE,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLineExtension(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineExtension(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMGAP,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLineGap(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineGap(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMDLI,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLineIncrement(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineIncrement(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMLTYPE,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionLineType(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineType(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMLWD,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionLineWeight()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionLineWeight(static_cast<LineweightType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMTM,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionMinusTolerance(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionMinusTolerance(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMMZF,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionMzf(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setDimensionMzf(values[0].convert<double>()); }},
+        {CadSystemVariables::DIMMZS,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionMzs(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionMzs(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMTP,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionPlusTolerance(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionPlusTolerance(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMPOST,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionPostFix(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionPostFix(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMRND,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionRounding(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionRounding(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMSCALE,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionScaleFactor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionScaleFactor(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMSAH,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSeparateArrowBlocks(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSeparateArrowBlocks(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMSTYLE,
+         [](CadHeader *header) -> DwgVariant { return header->currentDimensionStyleName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setCurrentDimensionStyleName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMSD1,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSuppressFirstDimensionLine(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSuppressFirstDimensionLine(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMSE1,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSuppressFirstExtensionLine(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSuppressFirstExtensionLine(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMSOXD,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSuppressOutsideExtensions(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSuppressOutsideExtensions(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMSD2,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSuppressSecondDimensionLine(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSuppressSecondDimensionLine(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMSE2,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionSuppressSecondExtensionLine(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionSuppressSecondExtensionLine(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMLTEX1,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTex1(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTex1(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMLTEX2,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTex2(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTex2(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMTFILLCLR,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextBackgroundColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextBackgroundColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMTFILL,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionTextBackgroundFillMode()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextBackgroundFillMode(static_cast<DimensionTextBackgroundFillMode>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMCLRT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMTXTDIRECTION,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionTextDirection()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextDirection(static_cast<TextDirection>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMTXT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextHeight(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextHeight(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMJUST,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionTextHorizontalAlignment()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextHorizontalAlignment(static_cast<DimensionTextHorizontalAlignment>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMTIX,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextInsideExtensions(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextInsideExtensions(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMTIH,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextInsideHorizontal(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextInsideHorizontal(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMTMOVE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->dimensionTextMovement()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextMovement(static_cast<TextMovement>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::DIMTOFL,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextOutsideExtensions(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextOutsideExtensions(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMTOH,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextOutsideHorizontal(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextOutsideHorizontal(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DIMTXSTY,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextStyleName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextStyleName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::DIMTAD,
+         [](CadHeader *header) -> DwgVariant { return static_cast<int>(header->dimensionTextVerticalAlignment()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextVerticalAlignment(static_cast<DimensionTextVerticalAlignment>(values[0].convert<int>()));
+         }},
+        {CadSystemVariables::DIMTVP,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTextVerticalPosition(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTextVerticalPosition(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMTSZ,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionTickSize(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionTickSize(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMTOLJ,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionToleranceAlignment()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionToleranceAlignment(static_cast<ToleranceAlignment>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMTDEC,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionToleranceDecimalPlaces(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionToleranceDecimalPlaces(values[0].convert<short>());
+         }},
+        {CadSystemVariables::DIMTFAC,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionToleranceScaleFactor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionToleranceScaleFactor(values[0].convert<double>());
+         }},
+        {CadSystemVariables::DIMTZIN,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionToleranceZeroHandling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionToleranceZeroHandling(static_cast<ZeroHandling>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::DIMUNIT,
+         [](CadHeader *header) -> DwgVariant { return header->dimensionUnit(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setDimensionUnit(values[0].convert<short>()); }},
+        {CadSystemVariables::DIMZIN,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->dimensionZeroHandling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDimensionZeroHandling(static_cast<ZeroHandling>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::LIGHTGLYPHDISPLAY,
+         [](CadHeader *header) -> DwgVariant { return header->displayLightGlyphs(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDisplayLightGlyphs(values[0].convert<char>());
+         }},
+        {CadSystemVariables::LWDISPLAY,
+         [](CadHeader *header) -> DwgVariant { return header->displayLineWeight(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDisplayLineWeight(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::DISPSILH,
+         [](CadHeader *header) -> DwgVariant { return header->displaySilhouetteCurves(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDisplaySilhouetteCurves(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::LOFTANG1,
+         [](CadHeader *header) -> DwgVariant { return header->draftAngleFirstCrossSection(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDraftAngleFirstCrossSection(values[0].convert<double>());
+         }},
+        {CadSystemVariables::LOFTANG2,
+         [](CadHeader *header) -> DwgVariant { return header->draftAngleSecondCrossSection(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDraftAngleSecondCrossSection(values[0].convert<double>());
+         }},
+        {CadSystemVariables::LOFTMAG1,
+         [](CadHeader *header) -> DwgVariant { return header->draftMagnitudeFirstCrossSection(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDraftMagnitudeFirstCrossSection(values[0].convert<double>());
+         }},
+        {CadSystemVariables::LOFTMAG2,
+         [](CadHeader *header) -> DwgVariant { return header->draftMagnitudeSecondCrossSection(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDraftMagnitudeSecondCrossSection(values[0].convert<double>());
+         }},
+        {CadSystemVariables::_3DDWFPREC,
+         [](CadHeader *header) -> DwgVariant { return header->dw3DPrecision(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setDw3DPrecision(values[0].convert<double>()); }},
+        {CadSystemVariables::DWFFRAME,
+         [](CadHeader *header) -> DwgVariant { return header->dwgUnderlayFramesVisibility(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setDwgUnderlayFramesVisibility(values[0].convert<char>());
+         }},
+        {CadSystemVariables::ELEVATION,
+         [](CadHeader *header) -> DwgVariant { return header->elevation(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setElevation(values[0].convert<double>()); }},
+        {CadSystemVariables::ENDCAPS,
+         [](CadHeader *header) -> DwgVariant { return header->endCaps(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setEndCaps(values[0].convert<short>()); }},
+        {CadSystemVariables::SORTENTS,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->entitySortingFlags()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setEntitySortingFlags(static_cast<ObjectSortingFlags>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::EXTNAMES,
+         [](CadHeader *header) -> DwgVariant { return header->extendedNames(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setExtendedNames(values[0].convert<bool>()); }},
+        {CadSystemVariables::DIMLWE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->extensionLineWeight()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setExtensionLineWeight(static_cast<LineweightType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::XCLIPFRAME,
+         [](CadHeader *header) -> DwgVariant { return header->externalReferenceClippingBoundaryType(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setExternalReferenceClippingBoundaryType(values[0].convert<unsigned char>());
+         }},
+        {CadSystemVariables::FACETRES,
+         [](CadHeader *header) -> DwgVariant { return header->facetResolution(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setFacetResolution(values[0].convert<double>());
+         }},
+        {CadSystemVariables::FILLETRAD,
+         [](CadHeader *header) -> DwgVariant { return header->filletRadius(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setFilletRadius(values[0].convert<double>()); }},
+        {CadSystemVariables::FILLMODE,
+         [](CadHeader *header) -> DwgVariant { return header->fillMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setFillMode(values[0].convert<bool>()); }},
+        {CadSystemVariables::FINGERPRINTGUID,
+         [](CadHeader *header) -> DwgVariant { return header->fingerPrintGuid(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setFingerPrintGuid(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::HALOGAP,
+         [](CadHeader *header) -> DwgVariant { return header->haloGapPercentage(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setHaloGapPercentage(values[0].convert<unsigned char>());
+         }},
+        {CadSystemVariables::HANDSEED,
+         [](CadHeader *header) -> DwgVariant { return header->handleSeed(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setHandleSeed(values[0].convert<unsigned long long>());
+         }},
+        {CadSystemVariables::HIDETEXT,
+         [](CadHeader *header) -> DwgVariant { return header->hideText(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setHideText(values[0].convert<unsigned char>());
+         }},
+        {CadSystemVariables::HYPERLINKBASE,
+         [](CadHeader *header) -> DwgVariant { return header->hyperLinkBase(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setHyperLinkBase(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::INDEXCTL,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->indexCreationFlags()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setIndexCreationFlags(IndexCreationFlags(QFlag(values[0].convert<unsigned char>())));
+         }},
+        {CadSystemVariables::INSUNITS,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->insUnits()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setInsUnits(static_cast<UnitsType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::INTERFERECOLOR,
+         [](CadHeader *header) -> DwgVariant { return header->interfereColor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setInterfereColor(Color(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::JOINSTYLE,
+         [](CadHeader *header) -> DwgVariant { return header->joinStyle(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setJoinStyle(values[0].convert<short>()); }},
+        {CadSystemVariables::LASTSAVEDBY,
+         [](CadHeader *header) -> DwgVariant { return header->lastSavedBy(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setLastSavedBy(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::LATITUDE,
+         [](CadHeader *header) -> DwgVariant { return header->latitude(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setLatitude(values[0].convert<double>()); }},
+        {CadSystemVariables::LENSLENGTH,
+         [](CadHeader *header) -> DwgVariant { return header->lensLength(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setLensLength(values[0].convert<double>()); }},
+        {CadSystemVariables::LIMCHECK,
+         [](CadHeader *header) -> DwgVariant { return header->limitCheckingOn(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setLimitCheckingOn(values[0].convert<bool>()); }},
+        {CadSystemVariables::LUNITS,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->linearUnitFormat()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setLinearUnitFormat(static_cast<LinearUnitFormat>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::LUPREC,
+         [](CadHeader *header) -> DwgVariant { return header->linearUnitPrecision(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setLinearUnitPrecision(values[0].convert<short>());
+         }},
+        {CadSystemVariables::LTSCALE,
+         [](CadHeader *header) -> DwgVariant { return header->lineTypeScale(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setLineTypeScale(values[0].convert<double>()); }},
+        {CadSystemVariables::LOFTNORMALS,
+         [](CadHeader *header) -> DwgVariant { return header->loftedObjectNormals(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setLoftedObjectNormals(values[0].convert<char>());
+         }},
+        {CadSystemVariables::LONGITUDE,
+         [](CadHeader *header) -> DwgVariant { return header->longitude(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setLongitude(values[0].convert<double>()); }},
+        {CadSystemVariables::ACADMAINTVER,
+         [](CadHeader *header) -> DwgVariant { return header->maintenanceVersion(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setMaintenanceVersion(values[0].convert<short>());
+         }},
+        {CadSystemVariables::MAXACTVP,
+         [](CadHeader *header) -> DwgVariant { return header->maxViewportCount(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setMaxViewportCount(values[0].convert<short>());
+         }},
+        {CadSystemVariables::MEASUREMENT,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->measurementUnits()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setMeasurementUnits(static_cast<MeasurementUnits>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::MENU,
+         [](CadHeader *header) -> DwgVariant { return header->menuFileName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setMenuFileName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::MIRRTEXT,
+         [](CadHeader *header) -> DwgVariant { return header->mirrorText(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setMirrorText(values[0].convert<bool>()); }},
+        {CadSystemVariables::EXTMAX,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceExtMax(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceExtMax(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::EXTMIN,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceExtMin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceExtMin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::INSBASE,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceInsertionBase(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceInsertionBase(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::LIMMAX,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceLimitsMax(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceLimitsMax(XY(values[0].convert<double>(), values[1].convert<double>()));
+         }},
+        {CadSystemVariables::LIMMIN,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceLimitsMin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceLimitsMin(XY(values[0].convert<double>(), values[1].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORG,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGBACK,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicBackDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicBackDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGBOTTOM,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicBottomDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicBottomDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGFRONT,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicFrontDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicFrontDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGLEFT,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicLeftDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicLeftDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGRIGHT,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicRightDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicRightDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSORGTOP,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceOrthographicTopDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceOrthographicTopDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSXDIR,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceXAxis(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceXAxis(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::UCSYDIR,
+         [](CadHeader *header) -> DwgVariant { return header->modelSpaceYAxis(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setModelSpaceYAxis(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::NORTHDIRECTION,
+         [](CadHeader *header) -> DwgVariant { return header->northDirection(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setNorthDirection(values[0].convert<double>()); }},
+        {CadSystemVariables::SPLINESEGS,
+         [](CadHeader *header) -> DwgVariant { return header->numberOfSplineSegments(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setNumberOfSplineSegments(values[0].convert<short>());
+         }},
+        {CadSystemVariables::OSMODE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned short>(header->objectSnapMode()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setObjectSnapMode(static_cast<ObjectSnapMode>(values[0].convert<unsigned short>()));
+         }},
+        {CadSystemVariables::ORTHOMODE,
+         [](CadHeader *header) -> DwgVariant { return header->orthoMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setOrthoMode(values[0].convert<bool>()); }},
+        {CadSystemVariables::PUCSBASE,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceBaseName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceBaseName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::PELEVATION,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceElevation(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceElevation(values[0].convert<double>());
+         }},
+        {CadSystemVariables::PEXTMAX,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceExtMax(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceExtMax(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PEXTMIN,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceExtMin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceExtMin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PINSBASE,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceInsertionBase(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceInsertionBase(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PLIMCHECK,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceLimitsChecking(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceLimitsChecking(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::PLIMMAX,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceLimitsMax(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceLimitsMax(XY(values[0].convert<double>(), values[1].convert<double>()));
+         }},
+        {CadSystemVariables::PLIMMIN,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceLimitsMin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceLimitsMin(XY(values[0].convert<double>(), values[1].convert<double>()));
+         }},
+        {CadSystemVariables::PSLTSCALE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->paperSpaceLineTypeScaling()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceLineTypeScaling(static_cast<SpaceLineTypeScaling>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::PUCSNAME,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::PUCSORGBACK,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicBackDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicBackDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORGBOTTOM,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicBottomDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicBottomDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORGFRONT,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicFrontDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicFrontDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORGLEFT,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicLeftDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicLeftDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORGRIGHT,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicRightDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicRightDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORGTOP,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceOrthographicTopDOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceOrthographicTopDOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSORG,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceUcsOrigin(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceUcsOrigin(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSXDIR,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceUcsXAxis(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceUcsXAxis(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PUCSYDIR,
+         [](CadHeader *header) -> DwgVariant { return header->paperSpaceUcsYAxis(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPaperSpaceUcsYAxis(XYZ(values[0].convert<double>(), values[1].convert<double>(), values[2].convert<double>()));
+         }},
+        {CadSystemVariables::PSTYLEMODE,
+         [](CadHeader *header) -> DwgVariant { return header->plotStyleMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setPlotStyleMode(values[0].convert<short>()); }},
+        {CadSystemVariables::PDMODE,
+         [](CadHeader *header) -> DwgVariant { return header->pointDisplayMode(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPointDisplayMode(values[0].convert<short>());
+         }},
+        {CadSystemVariables::PDSIZE,
+         [](CadHeader *header) -> DwgVariant { return header->pointDisplaySize(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPointDisplaySize(values[0].convert<double>());
+         }},
+        {CadSystemVariables::PLINEGEN,
+         [](CadHeader *header) -> DwgVariant { return header->polylineLineTypeGeneration(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPolylineLineTypeGeneration(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::PLINEWID,
+         [](CadHeader *header) -> DwgVariant { return header->polylineWidthDefault(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setPolylineWidthDefault(values[0].convert<double>());
+         }},
+        {CadSystemVariables::PROJECTNAME,
+         [](CadHeader *header) -> DwgVariant { return header->projectName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setProjectName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::PROXYGRAPHICS,
+         [](CadHeader *header) -> DwgVariant { return header->proxyGraphics(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setProxyGraphics(values[0].convert<bool>()); }},
+        {CadSystemVariables::QTEXTMODE,
+         [](CadHeader *header) -> DwgVariant { return header->quickTextMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setQuickTextMode(values[0].convert<bool>()); }},
+        {CadSystemVariables::REGENMODE,
+         [](CadHeader *header) -> DwgVariant { return header->regenerationMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setRegenerationMode(values[0].convert<bool>()); }},
+        {CadSystemVariables::REQUIREDVERSIONS,
+         [](CadHeader *header) -> DwgVariant { return header->requiredVersions(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setRequiredVersions(values[0].convert<long long>());
+         }},
+        {CadSystemVariables::VISRETAIN,
+         [](CadHeader *header) -> DwgVariant { return header->retainXRefDependentVisibilitySettings(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setRetainXRefDependentVisibilitySettings(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::SHADEDIF,
+         [](CadHeader *header) -> DwgVariant { return header->shadeDiffuseToAmbientPercentage(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShadeDiffuseToAmbientPercentage(values[0].convert<short>());
+         }},
+        {CadSystemVariables::SHADEDGE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->shadeEdge()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShadeEdge(static_cast<ShadeEdgeType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::CSHADOW,
+         [](CadHeader *header) -> DwgVariant { return static_cast<unsigned char>(header->shadowMode()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShadowMode(static_cast<ShadowMode>(values[0].convert<unsigned char>()));
+         }},
+        {CadSystemVariables::SHADOWPLANELOCATION,
+         [](CadHeader *header) -> DwgVariant { return header->shadowPlaneLocation(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShadowPlaneLocation(values[0].convert<double>());
+         }},
+        {CadSystemVariables::TILEMODE,
+         [](CadHeader *header) -> DwgVariant { return header->showModelSpace(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setShowModelSpace(values[0].convert<bool>()); }},
+        {CadSystemVariables::SHOWHIST,
+         [](CadHeader *header) -> DwgVariant { return header->showSolidsHistory(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShowSolidsHistory(values[0].convert<char>());
+         }},
+        {CadSystemVariables::SPLFRAME,
+         [](CadHeader *header) -> DwgVariant { return header->showSplineControlPoints(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setShowSplineControlPoints(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::SKETCHINC,
+         [](CadHeader *header) -> DwgVariant { return header->sketchIncrement(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSketchIncrement(values[0].convert<double>());
+         }},
+        {CadSystemVariables::SKPOLY,
+         [](CadHeader *header) -> DwgVariant { return header->sketchPolylines(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setSketchPolylines(values[0].convert<bool>()); }},
+        {CadSystemVariables::LOFTPARAM,
+         [](CadHeader *header) -> DwgVariant { return header->solidLoftedShape(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSolidLoftedShape(values[0].convert<short>());
+         }},
+        {CadSystemVariables::SOLIDHIST,
+         [](CadHeader *header) -> DwgVariant { return header->solidsRetainHistory(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSolidsRetainHistory(values[0].convert<char>());
+         }},
+        {CadSystemVariables::TREEDEPTH,
+         [](CadHeader *header) -> DwgVariant { return header->spatialIndexMaxTreeDepth(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSpatialIndexMaxTreeDepth(values[0].convert<short>());
+         }},
+        {CadSystemVariables::SPLINETYPE,
+         [](CadHeader *header) -> DwgVariant { return static_cast<short>(header->splineType()); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSplineType(static_cast<SplineType>(values[0].convert<short>()));
+         }},
+        {CadSystemVariables::STEPSIZE,
+         [](CadHeader *header) -> DwgVariant { return header->stepSize(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setStepSize(values[0].convert<double>()); }},
+        {CadSystemVariables::STEPSPERSEC,
+         [](CadHeader *header) -> DwgVariant { return header->stepsPerSecond(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setStepsPerSecond(values[0].convert<double>()); }},
+        {CadSystemVariables::STYLESHEET,
+         [](CadHeader *header) -> DwgVariant { return header->styleSheetName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setStyleSheetName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::SURFU,
+         [](CadHeader *header) -> DwgVariant { return header->surfaceDensityU(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setSurfaceDensityU(values[0].convert<short>()); }},
+        {CadSystemVariables::SURFV,
+         [](CadHeader *header) -> DwgVariant { return header->surfaceDensityV(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setSurfaceDensityV(values[0].convert<short>()); }},
+        {CadSystemVariables::SURFTAB1,
+         [](CadHeader *header) -> DwgVariant { return header->surfaceMeshTabulationCount1(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSurfaceMeshTabulationCount1(values[0].convert<short>());
+         }},
+        {CadSystemVariables::SURFTAB2,
+         [](CadHeader *header) -> DwgVariant { return header->surfaceMeshTabulationCount2(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSurfaceMeshTabulationCount2(values[0].convert<short>());
+         }},
+        {CadSystemVariables::SURFTYPE,
+         [](CadHeader *header) -> DwgVariant { return header->surfaceType(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setSurfaceType(values[0].convert<short>()); }},
+        {CadSystemVariables::PSOLHEIGHT,
+         [](CadHeader *header) -> DwgVariant { return header->sweptSolidHeight(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSweptSolidHeight(values[0].convert<double>());
+         }},
+        {CadSystemVariables::PSOLWIDTH,
+         [](CadHeader *header) -> DwgVariant { return header->sweptSolidWidth(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setSweptSolidWidth(values[0].convert<double>());
+         }},
+        {CadSystemVariables::TEXTSIZE,
+         [](CadHeader *header) -> DwgVariant { return header->textHeightDefault(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setTextHeightDefault(values[0].convert<double>());
+         }},
+        {CadSystemVariables::TEXTSTYLE,
+         [](CadHeader *header) -> DwgVariant { return header->textStyleName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setTextStyleName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::THICKNESS,
+         [](CadHeader *header) -> DwgVariant { return header->thicknessDefault(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setThicknessDefault(values[0].convert<double>());
+         }},
+        {CadSystemVariables::TIMEZONE,
+         [](CadHeader *header) -> DwgVariant { return header->timeZone(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setTimeZone(values[0].convert<int>()); }},
+        {CadSystemVariables::TDINDWG,
+         [](CadHeader *header) -> DwgVariant { return header->totalEditingTime(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setTotalEditingTime(Timespan(static_cast<Timespan::time_diff>(values[0].convert<double>() * MicrosecondsPerDay)));
+         }},
+        {CadSystemVariables::TRACEWID,
+         [](CadHeader *header) -> DwgVariant { return header->traceWidthDefault(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setTraceWidthDefault(values[0].convert<double>());
+         }},
+        {CadSystemVariables::UCSBASE,
+         [](CadHeader *header) -> DwgVariant { return header->ucsBaseName(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUcsBaseName(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::UCSNAME,
+         [](CadHeader *header) -> DwgVariant { return header->ucsName(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUcsName(values[0].convert<std::string>()); }},
+        {CadSystemVariables::UNITMODE,
+         [](CadHeader *header) -> DwgVariant { return header->unitMode(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUnitMode(values[0].convert<short>()); }},
+        {CadSystemVariables::TDUCREATE,
+         [](CadHeader *header) -> DwgVariant { return header->universalCreateDateTime(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUniversalCreateDateTime(CadUtils::FromJulianCalendar(values[0].convert<double>()));
+         }},
+        {CadSystemVariables::TDUUPDATE,
+         [](CadHeader *header) -> DwgVariant { return header->universalUpdateDateTime(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUniversalUpdateDateTime(CadUtils::FromJulianCalendar(values[0].convert<double>()));
+         }},
+        {CadSystemVariables::TDUPDATE,
+         [](CadHeader *header) -> DwgVariant { return header->updateDateTime(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUpdateDateTime(CadUtils::FromJulianCalendar(values[0].convert<double>()));
+         }},
+        {CadSystemVariables::DIMSHO,
+         [](CadHeader *header) -> DwgVariant { return header->updateDimensionsWhileDragging(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUpdateDimensionsWhileDragging(values[0].convert<bool>());
+         }},
+        {CadSystemVariables::USERR1,
+         [](CadHeader *header) -> DwgVariant { return header->userDouble1(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserDouble1(values[0].convert<double>()); }},
+        {CadSystemVariables::USERR2,
+         [](CadHeader *header) -> DwgVariant { return header->userDouble2(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserDouble2(values[0].convert<double>()); }},
+        {CadSystemVariables::USERR3,
+         [](CadHeader *header) -> DwgVariant { return header->userDouble3(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserDouble3(values[0].convert<double>()); }},
+        {CadSystemVariables::USERR4,
+         [](CadHeader *header) -> DwgVariant { return header->userDouble4(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserDouble4(values[0].convert<double>()); }},
+        {CadSystemVariables::USERR5,
+         [](CadHeader *header) -> DwgVariant { return header->userDouble5(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserDouble5(values[0].convert<double>()); }},
+        {CadSystemVariables::TDUSRTIMER,
+         [](CadHeader *header) -> DwgVariant { return header->userElapsedTimeSpan(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setUserElapsedTimeSpan(values[0].convert<double>());
+         }},
+        {CadSystemVariables::USERI1,
+         [](CadHeader *header) -> DwgVariant { return header->userShort1(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserShort1(values[0].convert<short>()); }},
+        {CadSystemVariables::USERI2,
+         [](CadHeader *header) -> DwgVariant { return header->userShort2(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserShort2(values[0].convert<short>()); }},
+        {CadSystemVariables::USERI3,
+         [](CadHeader *header) -> DwgVariant { return header->userShort3(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserShort3(values[0].convert<short>()); }},
+        {CadSystemVariables::USERI4,
+         [](CadHeader *header) -> DwgVariant { return header->userShort4(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserShort4(values[0].convert<short>()); }},
+        {CadSystemVariables::USERI5,
+         [](CadHeader *header) -> DwgVariant { return header->userShort5(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserShort5(values[0].convert<short>()); }},
+        {CadSystemVariables::USRTIMER,
+         [](CadHeader *header) -> DwgVariant { return header->userTimer(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setUserTimer(values[0].convert<bool>()); }},
+        {CadSystemVariables::VERSIONGUID,
+         [](CadHeader *header) -> DwgVariant { return header->versionGuid(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setVersionGuid(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::ACADVER,
+         [](CadHeader *header) -> DwgVariant { return header->versionString(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setVersionString(values[0].convert<std::string>());
+         }},
+        {CadSystemVariables::PSVPSCALE,
+         [](CadHeader *header) -> DwgVariant { return header->viewportDefaultViewScaleFactor(); },
+         [](CadHeader *header, const HeaderValues &values) {
+             header->setViewportDefaultViewScaleFactor(values[0].convert<double>());
+         }},
+        {CadSystemVariables::WORLDVIEW,
+         [](CadHeader *header) -> DwgVariant { return header->worldView(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setWorldView(values[0].convert<bool>()); }},
+        {CadSystemVariables::XEDIT,
+         [](CadHeader *header) -> DwgVariant { return header->xedit(); },
+         [](CadHeader *header, const HeaderValues &values) { header->setXEdit(values[0].convert<bool>()); }},
+};
+
+constexpr std::size_t HeaderThunkCount = sizeof(_headerThunks) / sizeof(_headerThunks[0]);
+
+/// \brief Hash and displace perfect hash over the names of the header variables.
+/// \details Every name falls in a bucket by its unseeded hash, each bucket stores the seed that places all its
+/// names in free slots, a lookup costs two hashes and one string comparison. The table is built by the compiler,
+/// a set of names without a valid seed fails the build.
+struct HeaderPerfectHash
+{
+    static constexpr std::size_t BucketCount = 128;
+    static constexpr std::size_t SlotCount = 512;
+    static constexpr std::size_t MaxBucketSize = 16;
+    static constexpr std::uint32_t MaxSeed = 0xFFFF;
+
+    std::uint32_t seeds[BucketCount] = {};
+    short slots[SlotCount] = {};
+
+    static constexpr std::uint32_t hash(std::string_view name, std::uint32_t seed)
+    {
+        std::uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+        for (char c: name)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 16;
+        h *= 0x85EBCA6Bu;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    static constexpr std::size_t bucket(std::string_view name)
+    {
+        return hash(name, 0) & (BucketCount - 1);
+    }
+
+    static constexpr std::size_t slot(std::string_view name, std::uint32_t seed)
+    {
+        return hash(name, seed) & (SlotCount - 1);
+    }
+
+    constexpr HeaderPerfectHash()
+    {
+        static_assert(HeaderThunkCount < SlotCount, "Too many header variables for the perfect hash table");
+
+        //Group the variables by bucket, members[firsts[b]..firsts[b + 1]) belong to the bucket b
+        std::size_t firsts[BucketCount + 1] = {};
+        std::size_t members[HeaderThunkCount] = {};
+        for (std::size_t i = 0; i < HeaderThunkCount; ++i)
+        {
+            ++firsts[bucket(_headerThunks[i].name) + 1];
+        }
+        for (std::size_t b = 0; b < BucketCount; ++b)
+        {
+            firsts[b + 1] += firsts[b];
+        }
+        std::size_t next[BucketCount] = {};
+        for (std::size_t i = 0; i < HeaderThunkCount; ++i)
+        {
+            std::size_t b = bucket(_headerThunks[i].name);
+            members[firsts[b] + next[b]++] = i;
+        }
+
+        //Place the largest buckets first, while the table is still empty
+        std::size_t order[BucketCount] = {};
+        for (std::size_t b = 0; b < BucketCount; ++b)
+        {
+            order[b] = b;
+        }
+        for (std::size_t i = 1; i < BucketCount; ++i)
+        {
+            for (std::size_t j = i; j > 0 && size(firsts, order[j - 1]) < size(firsts, order[j]); --j)
+            {
+                std::size_t tmp = order[j];
+                order[j] = order[j - 1];
+                order[j - 1] = tmp;
+            }
+        }
+
+        for (std::size_t i = 0; i < SlotCount; ++i)
+        {
+            slots[i] = -1;
+        }
+        for (std::size_t i = 0; i < BucketCount && size(firsts, order[i]) > 0; ++i)
+        {
+            std::size_t b = order[i];
+            std::uint32_t seed = 1;
+            while (!place(members + firsts[b], size(firsts, b), seed))
+            {
+                if (++seed > MaxSeed)
+                {
+                    throw "No seed places every header variable of the bucket";
+                }
+            }
+            seeds[b] = seed;
+        }
+    }
+
+    static constexpr std::size_t size(const std::size_t *firsts, std::size_t b)
+    {
+        return firsts[b + 1] - firsts[b];
+    }
+
+    constexpr bool place(const std::size_t *members, std::size_t count, std::uint32_t seed)
+    {
+        if (count > MaxBucketSize)
+        {
+            throw "Too many header variables in one bucket";
+        }
+
+        std::size_t taken[MaxBucketSize] = {};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t s = slot(_headerThunks[members[i]].name, seed);
+            bool free = slots[s] < 0;
+            for (std::size_t j = 0; j < i && free; ++j)
+            {
+                free = taken[j] != s;
+            }
+            if (!free)
+            {
+                return false;
+            }
+            taken[i] = s;
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            slots[taken[i]] = static_cast<short>(members[i]);
+        }
+        return true;
+    }
+
+    const HeaderVariableThunk *find(std::string_view name) const
+    {
+        short index = slots[slot(name, seeds[bucket(name)])];
+        if (index < 0 || name != _headerThunks[index].name)
+        {
+            return nullptr;
+        }
+        return &_headerThunks[index];
+    }
+};
+
+constexpr HeaderPerfectHash _headerHash;
+
+}// namespace
+
 std::vector<std::pair<std::string, std::string>> CadSystemVariables::_systemVaraible2PropertyKeyMappings = {};
 
-std::map<std::string, CadSystemVariableAttribute> CadSystemVariables::headerMap()
+const std::map<std::string, CadSystemVariableAttribute> &CadSystemVariables::headerMap()
 {
-    static std::once_flag flag;
-    std::call_once(flag, [&]() {
+    static const std::map<std::string, CadSystemVariableAttribute> _map = []() {
         _systemVaraible2PropertyKeyMappings.clear();
 
         using namespace rttr;
@@ -301,13 +1612,14 @@ std::map<std::string, CadSystemVariableAttribute> CadSystemVariables::headerMap(
             auto variable = property.get_metadata("CadSystemVariable").get_value<CadSystemVariableAttribute>();
             _systemVaraible2PropertyKeyMappings.push_back({variable.name(), std::string(name)});
         }
-    });
-  
-    std::map<std::string, CadSystemVariableAttribute> _map;
-    for (auto &&attr: _headerVariables)
-    {
-        _map.insert({attr.name(), attr});
-    }
+
+        std::map<std::string, CadSystemVariableAttribute> map;
+        for (auto &&attr: _headerVariables)
+        {
+            map.insert({attr.name(), attr});
+        }
+        return map;
+    }();
     return _map;
 }
 
@@ -315,1009 +1627,46 @@ DwgVariant CadSystemVariables::value(const std::string &key, const DxfCode &code
 {
     assert(header);
     DwgVariant var = CadSystemVariables::value(key, header);
+
+    //Coordinates are written one component per value code
+    int c = (int) code;
+    if (c >= 10 && c < 40)
+    {
+        std::size_t index = c / 10 - 1;
+        if (var.type() == typeid(XYZ))
+        {
+            const XYZ &xyz = var.extract<XYZ>();
+            return index == 0 ? xyz.X : index == 1 ? xyz.Y : xyz.Z;
+        }
+        if (var.type() == typeid(XY) && index < 2)
+        {
+            const XY &xy = var.extract<XY>();
+            return index == 0 ? xy.X : xy.Y;
+        }
+    }
     return var;
 }
 
 DwgVariant CadSystemVariables::value(const std::string &key, CadHeader *header)
 {
     assert(header);
-    if (key == CadSystemVariables::ANGBASE)
-    {
-        return header->angleBase();
-    }
-    if (key == CadSystemVariables::ANGDIR)
-    {
-        return static_cast<short>(header->angularDirection());
-    }
-    if (key == CadSystemVariables::AUNITS)
-    {
-        return static_cast<short>(header->angularUnit());
-    }
-    if (key == CadSystemVariables::AUPREC)
-    {
-        return header->angularUnitPrecision();
-    }
-    if (key == CadSystemVariables::DIMLDRBLK)
-    {
-        return header->arrowBlockName();
-    }
-    if (key == CadSystemVariables::DIMASO)
-    {
-        return header->associatedDimensions();
-    }
-    if (key == CadSystemVariables::ATTMODE)
-    {
-        return static_cast<int>(header->attributeVisibility());
-    }
-    if (key == CadSystemVariables::BLIPMODE)
-    {
-        return header->blipMode();
-    }
-    if (key == CadSystemVariables::CAMERADISPLAY)
-    {
-        return header->cameraDisplayObjects();
-    }
-    if (key == CadSystemVariables::CAMERAHEIGHT)
-    {
-        return header->cameraHeight();
-    }
-    if (key == CadSystemVariables::CHAMFERD)
-    {
-        return header->chamferAngle();
-    }
-    if (key == CadSystemVariables::CHAMFERA)
-    {
-        return header->chamferDistance1();
-    }
-    if (key == CadSystemVariables::CHAMFERB)
-    {
-        return header->chamferDistance2();
-    }
-    if (key == CadSystemVariables::CHAMFERC)
-    {
-        return header->chamferLength();
-    }
-    if (key == CadSystemVariables::DWGCODEPAGE)
-    {
-        return header->codePage();
-    }
-    if (key == CadSystemVariables::TDCREATE)
-    {
-        return header->createDateTime();
-    }
-    if (key == CadSystemVariables::PELLIPSE)
-    {
-        return header->createEllipseAsPolyline();
-    }
-    if (key == CadSystemVariables::CECOLOR)
-    {
-        return header->currentEntityColor();
-    }
-    if (key == CadSystemVariables::CELTSCALE)
-    {
-        return header->currentEntityLinetypeScale();
-    }
-    if (key == CadSystemVariables::CELWEIGHT)
-    {
-        return static_cast<short>(header->currentEntityLineWeight());
-    }
-    if (key == CadSystemVariables::CEPSNTYPE)
-    {
-        return static_cast<short>(header->currentEntityPlotStyle());
-    }
-    if (key == CadSystemVariables::CLAYER)
-    {
-        return header->currentLayerName();
-    }
-    if (key == CadSystemVariables::CELTYPE)
-    {
-        return header->currentLineTypeName();
-    }
-    if (key == CadSystemVariables::CMLJUST)
-    {
-        return static_cast<short>(header->currentMultilineJustification());
-    }
-    if (key == CadSystemVariables::CMLSCALE)
-    {
-        return header->currentMultilineScale();
-    }
-    if (key == CadSystemVariables::CMLSTYLE)
-    {
-        return header->currentMultiLineStyleName();
-    }
-    if (key == CadSystemVariables::DGNFRAME)
-    {
-        return header->dgnUnderlayFramesVisibility();
-    }
-    if (key == CadSystemVariables::DIMAPOST)
-    {
-        return header->dimensionAlternateDimensioningSuffix();
-    }
-    if (key == CadSystemVariables::DIMALTD)
-    {
-        return header->dimensionAlternateUnitDecimalPlaces();
-    }
-    if (key == CadSystemVariables::DIMALT)
-    {
-        return header->dimensionAlternateUnitDimensioning();
-    }
-    if (key == CadSystemVariables::DIMALTU)
-    {
-        return static_cast<short>(header->dimensionAlternateUnitFormat());
-    }
-    if (key == CadSystemVariables::DIMALTRND)
-    {
-        return header->dimensionAlternateUnitRounding();
-    }
-    if (key == CadSystemVariables::DIMALTF)
-    {
-        return header->dimensionAlternateUnitScaleFactor();
-    }
-    if (key == CadSystemVariables::DIMALTTD)
-    {
-        return header->dimensionAlternateUnitToleranceDecimalPlaces();
-    }
-    if (key == CadSystemVariables::DIMALTTZ)
-    {
-        return static_cast<unsigned char>(header->dimensionAlternateUnitToleranceZeroHandling());
-    }
-    if (key == CadSystemVariables::DIMALTZ)
-    {
-        return static_cast<unsigned char>(header->dimensionAlternateUnitZeroHandling());
-    }
-    if (key == CadSystemVariables::DIMALTMZF)
-    {
-        return header->dimensionAltMzf();
-    }
-    if (key == CadSystemVariables::DIMALTMZS)
-    {
-        return header->dimensionAltMzs();
-    }
-    if (key == CadSystemVariables::DIMADEC)
-    {
-        return header->dimensionAngularDimensionDecimalPlaces();
-    }
-    if (key == CadSystemVariables::DIMAUNIT)
-    {
-        return static_cast<short>(header->dimensionAngularUnit());
-    }
-    if (key == CadSystemVariables::DIMAZIN)
-    {
-        return static_cast<unsigned char>(header->dimensionAngularZeroHandling());
-    }
-    if (key == CadSystemVariables::DIMARCSYM)
-    {
-        return static_cast<short>(header->dimensionArcLengthSymbolPosition());
-    }
-    if (key == CadSystemVariables::DIMASZ)
-    {
-        return header->dimensionArrowSize();
-    }
-    if (key == CadSystemVariables::DIMASSOC)
-    {
-        return static_cast<short>(header->dimensionAssociativity());
-    }
-    if (key == CadSystemVariables::DIMBLK)
-    {
-        return header->dimensionBlockName();
-    }
-    if (key == CadSystemVariables::DIMBLK1)
-    {
-        return header->dimensionBlockNameFirst();
-    }
-    if (key == CadSystemVariables::DIMBLK2)
-    {
-        return header->dimensionBlockNameSecond();
-    }
-    if (key == CadSystemVariables::DIMCEN)
-    {
-        return header->dimensionCenterMarkSize();
-    }
-    if (key == CadSystemVariables::DIMUPT)
-    {
-        return header->dimensionCursorUpdate();
-    }
-    if (key == CadSystemVariables::DIMDEC)
-    {
-        return header->dimensionDecimalPlaces();
-    }
-    if (key == CadSystemVariables::DIMDSEP)
-    {
-        return header->dimensionDecimalSeparator();
-    }
-    if (key == CadSystemVariables::DIMATFIT)
-    {
-        return static_cast<unsigned char>(header->dimensionDimensionTextArrowFit());
-    }
-    if (key == CadSystemVariables::DIMCLRE)
-    {
-        return header->dimensionExtensionLineColor();
-    }
-    if (key == CadSystemVariables::DIMEXE)
-    {
-        return header->dimensionExtensionLineExtension();
-    }
-    if (key == CadSystemVariables::DIMEXO)
-    {
-        return header->dimensionExtensionLineOffset();
-    }
-    if (key == CadSystemVariables::DIMFIT)
-    {
-        return header->dimensionFit();
-    }
-    if (key == CadSystemVariables::DIMFXL)
-    {
-        return header->dimensionFixedExtensionLineLength();
-    }
-    if (key == CadSystemVariables::DIMFRAC)
-    {
-        return static_cast<short>(header->dimensionFractionFormat());
-    }
-    if (key == CadSystemVariables::DIMTOL)
-    {
-        return header->dimensionGenerateTolerances();
-    }
-    if (key == CadSystemVariables::DIMFXLON)
-    {
-        return header->dimensionIsExtensionLineLengthFixed();
-    }
-    if (key == CadSystemVariables::DIMJOGANG)
-    {
-        return header->dimensionJoggedRadiusDimensionTransverseSegmentAngle();
-    }
-    if (key == CadSystemVariables::DIMLIM)
-    {
-        return header->dimensionLimitsGeneration();
-    }
-    if (key == CadSystemVariables::DIMLFAC)
-    {
-        return header->dimensionLinearScaleFactor();
-    }
-    if (key == CadSystemVariables::DIMLUNIT)
-    {
-        return static_cast<short>(header->dimensionLinearUnitFormat());
-    }
-    if (key == CadSystemVariables::DIMCLRD)
-    {
-        return header->dimensionLineColor();
-    }
-    if (key == CadSystemVariables::DIMDLE)
-    {
-        return header->dimensionLineExtension();
-    }
-    if (key == CadSystemVariables::DIMGAP)
-    {
-        return header->dimensionLineGap();
-    }
-    if (key == CadSystemVariables::DIMDLI)
-    {
-        return header->dimensionLineIncrement();
-    }
-    if (key == CadSystemVariables::DIMLTYPE)
-    {
-        return header->dimensionLineType();
-    }
-    if (key == CadSystemVariables::DIMLWD)
-    {
-        return static_cast<short>(header->dimensionLineWeight());
-    }
-    if (key == CadSystemVariables::DIMTM)
-    {
-        return header->dimensionMinusTolerance();
-    }
-    if (key == CadSystemVariables::DIMMZF)
-    {
-        return header->dimensionMzf();
-    }
-    if (key == CadSystemVariables::DIMMZS)
-    {
-        return header->dimensionMzs();
-    }
-    if (key == CadSystemVariables::DIMTP)
-    {
-        return header->dimensionPlusTolerance();
-    }
-    if (key == CadSystemVariables::DIMPOST)
-    {
-        return header->dimensionPostFix();
-    }
-    if (key == CadSystemVariables::DIMRND)
-    {
-        return header->dimensionRounding();
-    }
-    if (key == CadSystemVariables::DIMSCALE)
-    {
-        return header->dimensionScaleFactor();
-    }
-    if (key == CadSystemVariables::DIMSAH)
-    {
-        return header->dimensionSeparateArrowBlocks();
-    }
-    if (key == CadSystemVariables::DIMSTYLE)
-    {
-        return header->currentDimensionStyleName();
-    }
-    if (key == CadSystemVariables::DIMSD1)
-    {
-        return header->dimensionSuppressFirstDimensionLine();
-    }
-    if (key == CadSystemVariables::DIMSE1)
-    {
-        return header->dimensionSuppressFirstExtensionLine();
-    }
-    if (key == CadSystemVariables::DIMSOXD)
-    {
-        return header->dimensionSuppressOutsideExtensions();
-    }
-    if (key == CadSystemVariables::DIMSD2)
-    {
-        return header->dimensionSuppressSecondDimensionLine();
-    }
-    if (key == CadSystemVariables::DIMSE2)
-    {
-        return header->dimensionSuppressSecondExtensionLine();
-    }
-    if (key == CadSystemVariables::DIMLTEX1)
-    {
-        return header->dimensionTex1();
-    }
-    if (key == CadSystemVariables::DIMLTEX2)
-    {
-        return header->dimensionTex2();
-    }
-    if (key == CadSystemVariables::DIMTFILLCLR)
-    {
-        return header->dimensionTextBackgroundColor();
-    }
-    if (key == CadSystemVariables::DIMTFILL)
+    const HeaderVariableThunk *thunk = _headerHash.find(key);
+    if (!thunk)
     {
-        return static_cast<short>(header->dimensionTextBackgroundFillMode());
+        return DwgVariant();
     }
-    if (key == CadSystemVariables::DIMCLRT)
+    return thunk->get(header);
+}
+
+void CadSystemVariables::setValue(CadHeader *header, const std::string &key, const std::vector<DwgVariant> &parameters)
+{
+    assert(header);
+    const HeaderVariableThunk *thunk = _headerHash.find(key);
+    if (!thunk)
     {
-        return header->dimensionTextColor();
+        return;
     }
-    if (key == CadSystemVariables::DIMTXTDIRECTION)
-    {
-        return static_cast<unsigned char>(header->dimensionTextDirection());
-    }
-    if (key == CadSystemVariables::DIMTXT)
-    {
-        return header->dimensionTextHeight();
-    }
-    if (key == CadSystemVariables::DIMJUST)
-    {
-        return static_cast<unsigned char>(header->dimensionTextHorizontalAlignment());
-    }
-    if (key == CadSystemVariables::DIMTIX)
-    {
-        return header->dimensionTextInsideExtensions();
-    }
-    if (key == CadSystemVariables::DIMTIH)
-    {
-        return header->dimensionTextInsideHorizontal();
-    }
-    if (key == CadSystemVariables::DIMTMOVE)
-    {
-        return static_cast<short>(header->dimensionTextMovement());
-    }
-    if (key == CadSystemVariables::DIMTOFL)
-    {
-        return header->dimensionTextOutsideExtensions();
-    }
-    if (key == CadSystemVariables::DIMTOH)
-    {
-        return header->dimensionTextOutsideHorizontal();
-    }
-    if (key == CadSystemVariables::DIMTXSTY)
-    {
-        return header->dimensionTextStyleName();
-    }
-    if (key == CadSystemVariables::DIMTAD)
-    {
-        return static_cast<int>(header->dimensionTextVerticalAlignment());
-    }
-    if (key == CadSystemVariables::DIMTVP)
-    {
-        return header->dimensionTextVerticalPosition();
-    }
-    if (key == CadSystemVariables::DIMTSZ)
-    {
-        return header->dimensionTickSize();
-    }
-    if (key == CadSystemVariables::DIMTOLJ)
-    {
-        return static_cast<unsigned char>(header->dimensionToleranceAlignment());
-    }
-    if (key == CadSystemVariables::DIMTDEC)
-    {
-        return header->dimensionToleranceDecimalPlaces();
-    }
-    if (key == CadSystemVariables::DIMTFAC)
-    {
-        return header->dimensionToleranceScaleFactor();
-    }
-    if (key == CadSystemVariables::DIMTZIN)
-    {
-        return static_cast<unsigned char>(header->dimensionToleranceZeroHandling());
-    }
-    if (key == CadSystemVariables::DIMUNIT)
-    {
-        return header->dimensionUnit();
-    }
-    if (key == CadSystemVariables::DIMZIN)
-    {
-        return static_cast<unsigned char>(header->dimensionZeroHandling());
-    }
-    if (key == CadSystemVariables::LIGHTGLYPHDISPLAY)
-    {
-        return header->displayLightGlyphs();
-    }
-    if (key == CadSystemVariables::LWDISPLAY)
-    {
-        return header->displayLineWeight();
-    }
-    if (key == CadSystemVariables::DISPSILH)
-    {
-        return header->displaySilhouetteCurves();
-    }
-    if (key == CadSystemVariables::LOFTANG1)
-    {
-        return header->draftAngleFirstCrossSection();
-    }
-    if (key == CadSystemVariables::LOFTANG2)
-    {
-        return header->draftAngleSecondCrossSection();
-    }
-    if (key == CadSystemVariables::LOFTMAG1)
-    {
-        return header->draftMagnitudeFirstCrossSection();
-    }
-    if (key == CadSystemVariables::LOFTMAG2)
-    {
-        return header->draftMagnitudeSecondCrossSection();
-    }
-    if (key == CadSystemVariables::_3DDWFPREC)
-    {
-        return header->dw3DPrecision();
-    }
-    if (key == CadSystemVariables::DWFFRAME)
-    {
-        return header->dwgUnderlayFramesVisibility();
-    }
-    if (key == CadSystemVariables::ELEVATION)
-    {
-        return header->elevation();
-    }
-    if (key == CadSystemVariables::ENDCAPS)
-    {
-        return header->endCaps();
-    }
-    if (key == CadSystemVariables::SORTENTS)
-    {
-        return static_cast<unsigned char>(header->entitySortingFlags());
-    }
-    if (key == CadSystemVariables::EXTNAMES)
-    {
-        return header->extendedNames();
-    }
-    if (key == CadSystemVariables::DIMLWE)
-    {
-        return static_cast<short>(header->extensionLineWeight());
-    }
-    if (key == CadSystemVariables::XCLIPFRAME)
-    {
-        return header->externalReferenceClippingBoundaryType();
-    }
-    if (key == CadSystemVariables::FACETRES)
-    {
-        return header->facetResolution();
-    }
-    if (key == CadSystemVariables::FILLETRAD)
-    {
-        return header->filletRadius();
-    }
-    if (key == CadSystemVariables::FILLMODE)
-    {
-        return header->fillMode();
-    }
-    if (key == CadSystemVariables::FINGERPRINTGUID)
-    {
-        return header->fingerPrintGuid();
-    }
-    if (key == CadSystemVariables::HALOGAP)
-    {
-        return header->haloGapPercentage();
-    }
-    if (key == CadSystemVariables::HANDSEED)
-    {
-        return header->handleSeed();
-    }
-    if (key == CadSystemVariables::HIDETEXT)
-    {
-        return header->hideText();
-    }
-    if (key == CadSystemVariables::INDEXCTL)
-    {
-        return static_cast<unsigned char>(header->indexCreationFlags());
-    }
-    if (key == CadSystemVariables::INSUNITS)
-    {
-        return static_cast<short>(header->insUnits());
-    }
-    if (key == CadSystemVariables::INTERFERECOLOR)
-    {
-        return header->interfereColor();
-    }
-    if (key == CadSystemVariables::JOINSTYLE)
-    {
-        return header->joinStyle();
-    }
-    if (key == CadSystemVariables::LASTSAVEDBY)
-    {
-        return header->lastSavedBy();
-    }
-    if (key == CadSystemVariables::LATITUDE)
-    {
-        return header->latitude();
-    }
-    if (key == CadSystemVariables::LENSLENGTH)
-    {
-        return header->lensLength();
-    }
-    if (key == CadSystemVariables::LIMCHECK)
-    {
-        return header->limitCheckingOn();
-    }
-    if (key == CadSystemVariables::LUNITS)
-    {
-        return static_cast<short>(header->linearUnitFormat());
-    }
-    if (key == CadSystemVariables::LUPREC)
-    {
-        return header->linearUnitPrecision();
-    }
-    if (key == CadSystemVariables::LTSCALE)
-    {
-        return header->lineTypeScale();
-    }
-    if (key == CadSystemVariables::LOFTNORMALS)
-    {
-        return header->loftedObjectNormals();
-    }
-    if (key == CadSystemVariables::LONGITUDE)
-    {
-        return header->longitude();
-    }
-    if (key == CadSystemVariables::ACADMAINTVER)
-    {
-        return header->maintenanceVersion();
-    }
-    if (key == CadSystemVariables::MAXACTVP)
-    {
-        return header->maxViewportCount();
-    }
-    if (key == CadSystemVariables::MEASUREMENT)
-    {
-        return static_cast<short>(header->measurementUnits());
-    }
-    if (key == CadSystemVariables::MENU)
-    {
-        return header->menuFileName();
-    }
-    if (key == CadSystemVariables::MIRRTEXT)
-    {
-        return header->mirrorText();
-    }
-    if (key == CadSystemVariables::EXTMAX)
-    {
-        return header->modelSpaceExtMax();
-    }
-    if (key == CadSystemVariables::EXTMIN)
-    {
-        return header->modelSpaceExtMin();
-    }
-    if (key == CadSystemVariables::INSBASE)
-    {
-        return header->modelSpaceInsertionBase();
-    }
-    if (key == CadSystemVariables::LIMMAX)
-    {
-        return header->modelSpaceLimitsMax();
-    }
-    if (key == CadSystemVariables::LIMMIN)
-    {
-        return header->modelSpaceLimitsMin();
-    }
-    if (key == CadSystemVariables::UCSORG)
-    {
-        return header->modelSpaceOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGBACK)
-    {
-        return header->modelSpaceOrthographicBackDOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGBOTTOM)
-    {
-        return header->modelSpaceOrthographicBottomDOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGFRONT)
-    {
-        return header->modelSpaceOrthographicFrontDOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGLEFT)
-    {
-        return header->modelSpaceOrthographicLeftDOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGRIGHT)
-    {
-        return header->modelSpaceOrthographicRightDOrigin();
-    }
-    if (key == CadSystemVariables::UCSORGTOP)
-    {
-        return header->modelSpaceOrthographicTopDOrigin();
-    }
-    if (key == CadSystemVariables::UCSXDIR)
-    {
-        return header->modelSpaceXAxis();
-    }
-    if (key == CadSystemVariables::UCSYDIR)
-    {
-        return header->modelSpaceYAxis();
-    }
-    if (key == CadSystemVariables::NORTHDIRECTION)
-    {
-        return header->northDirection();
-    }
-    if (key == CadSystemVariables::SPLINESEGS)
-    {
-        return header->numberOfSplineSegments();
-    }
-    if (key == CadSystemVariables::OSMODE)
-    {
-        return static_cast<unsigned short>(header->objectSnapMode());
-    }
-    if (key == CadSystemVariables::ORTHOMODE)
-    {
-        return header->orthoMode();
-    }
-    if (key == CadSystemVariables::PUCSBASE)
-    {
-        return header->paperSpaceBaseName();
-    }
-    if (key == CadSystemVariables::PELEVATION)
-    {
-        return header->paperSpaceElevation();
-    }
-    if (key == CadSystemVariables::PEXTMAX)
-    {
-        return header->paperSpaceExtMax();
-    }
-    if (key == CadSystemVariables::PEXTMIN)
-    {
-        return header->paperSpaceExtMin();
-    }
-    if (key == CadSystemVariables::PINSBASE)
-    {
-        return header->paperSpaceInsertionBase();
-    }
-    if (key == CadSystemVariables::PLIMCHECK)
-    {
-        return header->paperSpaceLimitsChecking();
-    }
-    if (key == CadSystemVariables::PLIMMAX)
-    {
-        return header->paperSpaceLimitsMax();
-    }
-    if (key == CadSystemVariables::PLIMMIN)
-    {
-        return header->paperSpaceLimitsMin();
-    }
-    if (key == CadSystemVariables::PSLTSCALE)
-    {
-        return static_cast<short>(header->paperSpaceLineTypeScaling());
-    }
-    if (key == CadSystemVariables::PUCSNAME)
-    {
-        return header->paperSpaceName();
-    }
-    if (key == CadSystemVariables::PUCSORGBACK)
-    {
-        return header->paperSpaceOrthographicBackDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORGBOTTOM)
-    {
-        return header->paperSpaceOrthographicBottomDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORGFRONT)
-    {
-        return header->paperSpaceOrthographicFrontDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORGLEFT)
-    {
-        return header->paperSpaceOrthographicLeftDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORGRIGHT)
-    {
-        return header->paperSpaceOrthographicRightDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORGTOP)
-    {
-        return header->paperSpaceOrthographicTopDOrigin();
-    }
-    if (key == CadSystemVariables::PUCSORG)
-    {
-        return header->paperSpaceUcsOrigin();
-    }
-    if (key == CadSystemVariables::PUCSXDIR)
-    {
-        return header->paperSpaceUcsXAxis();
-    }
-    if (key == CadSystemVariables::PUCSYDIR)
-    {
-        return header->paperSpaceUcsYAxis();
-    }
-    if (key == CadSystemVariables::PSTYLEMODE)
-    {
-        return header->plotStyleMode();
-    }
-    if (key == CadSystemVariables::PDMODE)
-    {
-        return header->pointDisplayMode();
-    }
-    if (key == CadSystemVariables::PDSIZE)
-    {
-        return header->pointDisplaySize();
-    }
-    if (key == CadSystemVariables::PLINEGEN)
-    {
-        return header->polylineLineTypeGeneration();
-    }
-    if (key == CadSystemVariables::PLINEWID)
-    {
-        return header->polylineWidthDefault();
-    }
-    if (key == CadSystemVariables::PROJECTNAME)
-    {
-        return header->projectName();
-    }
-    if (key == CadSystemVariables::PROXYGRAPHICS)
-    {
-        return header->proxyGraphics();
-    }
-    if (key == CadSystemVariables::QTEXTMODE)
-    {
-        return header->quickTextMode();
-    }
-    if (key == CadSystemVariables::REGENMODE)
-    {
-        return header->regenerationMode();
-    }
-    if (key == CadSystemVariables::REQUIREDVERSIONS)
-    {
-        return header->requiredVersions();
-    }
-    if (key == CadSystemVariables::VISRETAIN)
-    {
-        return header->retainXRefDependentVisibilitySettings();
-    }
-    if (key == CadSystemVariables::SHADEDIF)
-    {
-        return header->shadeDiffuseToAmbientPercentage();
-    }
-    if (key == CadSystemVariables::SHADEDGE)
-    {
-        return static_cast<short>(header->shadeEdge());
-    }
-    if (key == CadSystemVariables::CSHADOW)
-    {
-        return static_cast<unsigned char>(header->shadowMode());
-    }
-    if (key == CadSystemVariables::SHADOWPLANELOCATION)
-    {
-        return header->shadowPlaneLocation();
-    }
-    if (key == CadSystemVariables::TILEMODE)
-    {
-        return header->showModelSpace();
-    }
-    if (key == CadSystemVariables::SHOWHIST)
-    {
-        return header->showSolidsHistory();
-    }
-    if (key == CadSystemVariables::SPLFRAME)
-    {
-        return header->showSplineControlPoints();
-    }
-    if (key == CadSystemVariables::SKETCHINC)
-    {
-        return header->sketchIncrement();
-    }
-    if (key == CadSystemVariables::SKPOLY)
-    {
-        return header->sketchPolylines();
-    }
-    if (key == CadSystemVariables::LOFTPARAM)
-    {
-        return header->solidLoftedShape();
-    }
-    if (key == CadSystemVariables::SOLIDHIST)
-    {
-        return header->solidsRetainHistory();
-    }
-    if (key == CadSystemVariables::TREEDEPTH)
-    {
-        return header->spatialIndexMaxTreeDepth();
-    }
-    if (key == CadSystemVariables::SPLINETYPE)
-    {
-        return static_cast<short>(header->splineType());
-    }
-    if (key == CadSystemVariables::STEPSIZE)
-    {
-        return header->stepSize();
-    }
-    if (key == CadSystemVariables::STEPSPERSEC)
-    {
-        return header->stepsPerSecond();
-    }
-    if (key == CadSystemVariables::STYLESHEET)
-    {
-        return header->styleSheetName();
-    }
-    if (key == CadSystemVariables::SURFU)
-    {
-        return header->surfaceDensityU();
-    }
-    if (key == CadSystemVariables::SURFV)
-    {
-        return header->surfaceDensityV();
-    }
-    if (key == CadSystemVariables::SURFTAB1)
-    {
-        return header->surfaceMeshTabulationCount1();
-    }
-    if (key == CadSystemVariables::SURFTAB2)
-    {
-        return header->surfaceMeshTabulationCount2();
-    }
-    if (key == CadSystemVariables::SURFTYPE)
-    {
-        return header->surfaceType();
-    }
-    if (key == CadSystemVariables::PSOLHEIGHT)
-    {
-        return header->sweptSolidHeight();
-    }
-    if (key == CadSystemVariables::PSOLWIDTH)
-    {
-        return header->sweptSolidWidth();
-    }
-    if (key == CadSystemVariables::TEXTSIZE)
-    {
-        return header->textHeightDefault();
-    }
-    if (key == CadSystemVariables::TEXTSTYLE)
-    {
-        return header->textStyleName();
-    }
-    if (key == CadSystemVariables::THICKNESS)
-    {
-        return header->thicknessDefault();
-    }
-    if (key == CadSystemVariables::TIMEZONE)
-    {
-        return header->timeZone();
-    }
-    if (key == CadSystemVariables::TDINDWG)
-    {
-        return header->totalEditingTime();
-    }
-    if (key == CadSystemVariables::TRACEWID)
-    {
-        return header->traceWidthDefault();
-    }
-    if (key == CadSystemVariables::UCSBASE)
-    {
-        return header->ucsBaseName();
-    }
-    if (key == CadSystemVariables::UCSNAME)
-    {
-        return header->ucsName();
-    }
-    if (key == CadSystemVariables::UNITMODE)
-    {
-        return header->unitMode();
-    }
-    if (key == CadSystemVariables::TDUCREATE)
-    {
-        return header->universalCreateDateTime();
-    }
-    if (key == CadSystemVariables::TDUUPDATE)
-    {
-        return header->universalUpdateDateTime();
-    }
-    if (key == CadSystemVariables::TDUPDATE)
-    {
-        return header->updateDateTime();
-    }
-    if (key == CadSystemVariables::DIMSHO)
-    {
-        return header->updateDimensionsWhileDragging();
-    }
-    if (key == CadSystemVariables::USERR1)
-    {
-        return header->userDouble1();
-    }
-    if (key == CadSystemVariables::USERR2)
-    {
-        return header->userDouble2();
-    }
-    if (key == CadSystemVariables::USERR3)
-    {
-        return header->userDouble3();
-    }
-    if (key == CadSystemVariables::USERR4)
-    {
-        return header->userDouble4();
-    }
-    if (key == CadSystemVariables::USERR5)
-    {
-        return header->userDouble5();
-    }
-    if (key == CadSystemVariables::TDUSRTIMER)
-    {
-        return header->userElapsedTimeSpan();
-    }
-    if (key == CadSystemVariables::USERI1)
-    {
-        return header->userShort1();
-    }
-    if (key == CadSystemVariables::USERI2)
-    {
-        return header->userShort2();
-    }
-    if (key == CadSystemVariables::USERI3)
-    {
-        return header->userShort3();
-    }
-    if (key == CadSystemVariables::USERI4)
-    {
-        return header->userShort4();
-    }
-    if (key == CadSystemVariables::USERI5)
-    {
-        return header->userShort5();
-    }
-    if (key == CadSystemVariables::USRTIMER)
-    {
-        return header->userTimer();
-    }
-    if (key == CadSystemVariables::VERSIONGUID)
-    {
-        return header->versionGuid();
-    }
-    if (key == CadSystemVariables::ACADVER)
-    {
-        return header->versionString();
-    }
-    if (key == CadSystemVariables::PSVPSCALE)
-    {
-        return header->viewportDefaultViewScaleFactor();
-    }
-    if (key == CadSystemVariables::WORLDVIEW)
-    {
-        return header->worldView();
-    }
-    if (key == CadSystemVariables::XEDIT)
-    {
-        return header->xedit();
-    }
-    return DwgVariant();
-}
-
-void CadSystemVariables::setValue(CadHeader *header, const std::string &key, const std::vector<DwgVariant> &parameters)
-{
+    thunk->set(header, parameters);
 }
 
-}// namespace dwg
\ No newline at end of file
+}// namespace dwg
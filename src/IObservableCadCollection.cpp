@@ -0,0 +1,81 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/IObservableCadCollection.h>
+
+namespace dwg {
+
+void IObservableCadCollection::suspendNotifications()
+{
+    ++_suspendCount;
+}
+
+void IObservableCadCollection::resumeNotifications()
+{
+    if (_suspendCount == 0 || --_suspendCount > 0)
+        return;
+
+    flushAdded();
+}
+
+bool IObservableCadCollection::notificationsSuspended() const
+{
+    return _suspendCount > 0;
+}
+
+void IObservableCadCollection::notifyAdded(CadObject *item)
+{
+    if (_suspendCount > 0)
+    {
+        _pendingAdded.emplace_back(item);
+        return;
+    }
+    OnAdd(item);
+}
+
+void IObservableCadCollection::notifyAdded(const std::vector<CadObject *> &items)
+{
+    if (_suspendCount > 0)
+    {
+        _pendingAdded.insert(_pendingAdded.end(), items.begin(), items.end());
+        return;
+    }
+    OnAddRange(items);
+}
+
+void IObservableCadCollection::notifyRemoved(CadObject *item)
+{
+    flushAdded();
+    OnRemove(item);
+}
+
+void IObservableCadCollection::flushAdded()
+{
+    if (_pendingAdded.empty())
+        return;
+
+    std::vector<CadObject *> items;
+    items.swap(_pendingAdded);
+    OnAddRange(items);
+}
+
+}// namespace dwg
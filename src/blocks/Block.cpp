@@ -41,12 +41,12 @@ ObjectType Block::objectType() const
     return ObjectType::BLOCK;
 }
 
-std::string Block::objectName() const
+std::string_view Block::objectName() const
 {
     return DxfFileToken::Block;
 }
 
-std::string Block::subclassMarker() const
+std::string_view Block::subclassMarker() const
 {
     return DxfSubclassMarker::BlockBegin;
 }
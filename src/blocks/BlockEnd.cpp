@@ -32,7 +32,7 @@ BlockEnd::BlockEnd(BlockRecord *record)
     _owner = record;
 }
 
-std::string BlockEnd::objectName() const
+std::string_view BlockEnd::objectName() const
 {
     return DxfFileToken::EndBlock;
 }
@@ -42,7 +42,7 @@ ObjectType BlockEnd::objectType() const
     return ObjectType::ENDBLK;
 }
 
-std::string BlockEnd::subclassMarker() const
+std::string_view BlockEnd::subclassMarker() const
 {
     return DxfSubclassMarker::BlockEnd;
 }
@@ -55,7 +55,7 @@ DxfClass::DxfClass(const std::string &applicationName, const std::string &cppCla
     _wasZombie = wasZombie;
 }
 
-std::string DxfClass::dxfName() const
+const std::string &DxfClass::dxfName() const
 {
     return _dxfName;
 }
@@ -65,7 +65,7 @@ void DxfClass::setDxfName(const std::string &dxfName)
     _dxfName = dxfName;
 }
 
-std::string DxfClass::cppClassName() const
+const std::string &DxfClass::cppClassName() const
 {
     return _cppClassName;
 }
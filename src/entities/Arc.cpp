@@ -38,12 +38,12 @@ ObjectType Arc::objectType() const
     return ObjectType::ARC;
 }
 
-std::string Arc::objectName() const
+std::string_view Arc::objectName() const
 {
     return DxfFileToken::EntityArc;
 }
 
-std::string Arc::subclassMarker() const
+std::string_view Arc::subclassMarker() const
 {
     return DxfSubclassMarker::Arc;
 }
@@ -41,12 +41,12 @@ ObjectType AttributeDefinition::objectType() const
     return ObjectType::ATTDEF;
 }
 
-std::string AttributeDefinition::objectName() const
+std::string_view AttributeDefinition::objectName() const
 {
     return DxfFileToken::EntityAttributeDefinition;
 }
 
-std::string AttributeDefinition::subclassMarker() const
+std::string_view AttributeDefinition::subclassMarker() const
 {
     return DxfSubclassMarker::AttributeDefinition;
 }
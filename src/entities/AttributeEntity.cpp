@@ -41,12 +41,12 @@ ObjectType AttributeEntity::objectType() const
     return ObjectType::ATTRIB;
 }
 
-std::string AttributeEntity::objectName() const
+std::string_view AttributeEntity::objectName() const
 {
     return DxfFileToken::EntityAttribute;
 }
 
-std::string AttributeEntity::subclassMarker() const
+std::string_view AttributeEntity::subclassMarker() const
 {
     return DxfSubclassMarker::Attribute;
 }
@@ -38,12 +38,12 @@ ObjectType Circle::objectType() const
     return ObjectType::CIRCLE;
 }
 
-std::string Circle::objectName() const
+std::string_view Circle::objectName() const
 {
     return DxfFileToken::EntityCircle;
 }
 
-std::string Circle::subclassMarker() const
+std::string_view Circle::subclassMarker() const
 {
     return DxfSubclassMarker::Circle;
 }
@@ -40,7 +40,7 @@ Dimension::Dimension(DimensionType type)
 
 Dimension::~Dimension() {}
 
-std::string Dimension::subclassMarker() const
+std::string_view Dimension::subclassMarker() const
 {
     return DxfSubclassMarker::Dimension;
 }
@@ -39,12 +39,12 @@ ObjectType DimensionAligned::objectType() const
     return ObjectType::DIMENSION_ALIGNED;
 }
 
-std::string DimensionAligned::objectName() const
+std::string_view DimensionAligned::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionAligned::subclassMarker() const
+std::string_view DimensionAligned::subclassMarker() const
 {
     return DxfSubclassMarker::AlignedDimension;
 }
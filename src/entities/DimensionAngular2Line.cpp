@@ -37,12 +37,12 @@ ObjectType DimensionAngular2Line::objectType() const
     return ObjectType::DIMENSION_ANG_2_Ln;
 }
 
-std::string DimensionAngular2Line::objectName() const
+std::string_view DimensionAngular2Line::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionAngular2Line::subclassMarker() const
+std::string_view DimensionAngular2Line::subclassMarker() const
 {
     return DxfSubclassMarker::Angular2LineDimension;
 }
@@ -37,12 +37,12 @@ ObjectType DimensionAngular3Pt::objectType() const
     return ObjectType::DIMENSION_ANG_3_Pt;
 }
 
-std::string DimensionAngular3Pt::objectName() const
+std::string_view DimensionAngular3Pt::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionAngular3Pt::subclassMarker() const
+std::string_view DimensionAngular3Pt::subclassMarker() const
 {
     return DxfSubclassMarker::Angular3PointDimension;
 }
@@ -37,12 +37,12 @@ ObjectType DimensionDiameter::objectType() const
     return ObjectType::DIMENSION_DIAMETER;
 }
 
-std::string DimensionDiameter::objectName() const
+std::string_view DimensionDiameter::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionDiameter::subclassMarker() const
+std::string_view DimensionDiameter::subclassMarker() const
 {
     return DxfSubclassMarker::DiametricDimension;
 }
@@ -37,12 +37,12 @@ ObjectType DimensionLinear::objectType() const
     return ObjectType::DIMENSION_LINEAR;
 }
 
-std::string DimensionLinear::objectName() const
+std::string_view DimensionLinear::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionLinear::subclassMarker() const
+std::string_view DimensionLinear::subclassMarker() const
 {
     return DxfSubclassMarker::LinearDimension;
 }
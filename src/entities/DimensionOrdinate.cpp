@@ -37,12 +37,12 @@ ObjectType DimensionOrdinate::objectType() const
     return ObjectType::DIMENSION_ORDINATE;
 }
 
-std::string DimensionOrdinate::objectName() const
+std::string_view DimensionOrdinate::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionOrdinate::subclassMarker() const
+std::string_view DimensionOrdinate::subclassMarker() const
 {
     return DxfSubclassMarker::OrdinateDimension;
 }
@@ -37,12 +37,12 @@ ObjectType DimensionRadius::objectType() const
     return ObjectType::DIMENSION_RADIUS;
 }
 
-std::string DimensionRadius::objectName() const
+std::string_view DimensionRadius::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
 
-std::string DimensionRadius::subclassMarker() const
+std::string_view DimensionRadius::subclassMarker() const
 {
     return DxfSubclassMarker::RadialDimension;
 }
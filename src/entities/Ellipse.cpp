@@ -41,12 +41,12 @@ ObjectType Ellipse::objectType() const
     return ObjectType::ELLIPSE;
 }
 
-std::string Ellipse::objectName() const
+std::string_view Ellipse::objectName() const
 {
     return DxfFileToken::EntityEllipse;
 }
 
-std::string Ellipse::subclassMarker() const
+std::string_view Ellipse::subclassMarker() const
 {
     return DxfSubclassMarker::Ellipse;
 }
@@ -21,6 +21,7 @@
  */
 
 #include <dwg/CadDocument.h>
+#include <dwg/CadObjectExtension_p.h>
 #include <dwg/DxfSubclassMarker_p.h>
 #include <dwg/attributes/DxfCodeValueAttribute_p.h>
 #include <dwg/attributes/DxfSubClassAttribute_p.h>
@@ -33,15 +34,14 @@
 namespace dwg {
 
 Entity::Entity()
-    : _layer(Layer::Default()), _color(Color::ByLayer), _lineweight(LineweightType::ByLayer), _linetypeScale(1.0),
-      _isInvisible(false), _transparency(Transparency::ByLayer), _linetype(LineType::ByLayer()), _material(nullptr),
-      _bookColor(nullptr)
+    : _layer(Layer::Default()), _linetype(LineType::ByLayer()), _linetypeScale(1.0), _color(Color::ByLayer),
+      _transparency(Transparency::ByLayer), _lineweight(LineweightType::ByLayer), _isInvisible(false)
 {
 }
 
 Entity::~Entity() {}
 
-std::string Entity::subclassMarker() const
+std::string_view Entity::subclassMarker() const
 {
     return DxfSubclassMarker::Entity;
 }
@@ -118,28 +118,32 @@ void Entity::setLineType(LineType *value)
 
 Material *Entity::material() const
 {
-    return _material;
+    return _extension ? _extension->material : nullptr;
 }
 
 void Entity::setMaterial(Material *value)
 {
-    _material = value;
+    if (_extension || value)
+    {
+        extension()->material = value;
+    }
 }
 
 BookColor *Entity::bookColor() const
 {
-    return _bookColor;
+    return _extension ? _extension->bookColor : nullptr;
 }
 
 void Entity::setBookColor(BookColor *value)
 {
     if (_document)
     {
-        _bookColor = updateCollectionT<BookColor *>(value, _document->colors());
+        value = updateCollectionT<BookColor *>(value, _document->colors());
     }
-    else
+
+    if (_extension || value)
     {
-        _bookColor = value;
+        extension()->bookColor = value;
     }
 }
 
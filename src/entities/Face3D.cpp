@@ -41,12 +41,12 @@ ObjectType Face3D::objectType() const
     return ObjectType::FACE3D;
 }
 
-std::string Face3D::objectName() const
+std::string_view Face3D::objectName() const
 {
     return DxfFileToken::Entity3DFace;
 }
 
-std::string Face3D::subclassMarker() const
+std::string_view Face3D::subclassMarker() const
 {
     return DxfSubclassMarker::Face3d;
 }
@@ -37,12 +37,12 @@ ObjectType Hatch::objectType() const
     return ObjectType::HATCH;
 }
 
-std::string Hatch::objectName() const
+std::string_view Hatch::objectName() const
 {
     return DxfFileToken::EntityHatch;
 }
 
-std::string Hatch::subclassMarker() const
+std::string_view Hatch::subclassMarker() const
 {
     return DxfSubclassMarker::Hatch;
 }
@@ -27,23 +27,26 @@
 
 namespace dwg {
 
-Insert::Insert() {}
+Insert::Insert() : Insert(nullptr) {}
 
-Insert::Insert(BlockRecord *) {}
+Insert::Insert(BlockRecord *block) : _block(block), _attributes(new AttributeEntitySeqendCollection(this)) {}
 
-Insert::~Insert() {}
+Insert::~Insert()
+{
+    delete _attributes;
+}
 
 ObjectType Insert::objectType() const
 {
     return isMultiple() ? ObjectType::MINSERT : ObjectType::INSERT;
 }
 
-std::string Insert::objectName() const
+std::string_view Insert::objectName() const
 {
     return DxfFileToken::EntityInsert;
 }
 
-std::string Insert::subclassMarker() const
+std::string_view Insert::subclassMarker() const
 {
     return isMultiple() ? DxfSubclassMarker::MInsert : DxfSubclassMarker::Insert;
 }
@@ -160,7 +163,7 @@ void Insert::setRowSpacing(double spacing)
 
 bool Insert::hasAttributes() const
 {
-    return false;
+    return !_attributes->empty();
 }
 
 bool Insert::hasDynamicSubclass() const
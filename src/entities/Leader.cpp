@@ -43,12 +43,12 @@ ObjectType Leader::objectType() const
     return ObjectType::LEADER;
 }
 
-std::string Leader::objectName() const
+std::string_view Leader::objectName() const
 {
     return DxfFileToken::EntityLeader;
 }
 
-std::string Leader::subclassMarker() const
+std::string_view Leader::subclassMarker() const
 {
     return DxfSubclassMarker::Leader;
 }
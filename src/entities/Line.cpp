@@ -26,6 +26,8 @@
 
 namespace dwg {
 
+static_assert(sizeof(void *) != 8 || sizeof(Line) <= 160, "Line grew past its 160 bytes footprint");
+
 Line::Line() : _normal(XYZ::AxisZ), _startPoint(XYZ::Zero), _endPoint(XYZ::Zero), _thickness(0.0) {}
 
 Line::~Line() {}
@@ -35,12 +37,12 @@ ObjectType Line::objectType() const
     return ObjectType::LINE;
 }
 
-std::string Line::objectName() const
+std::string_view Line::objectName() const
 {
     return DxfFileToken::EntityLine;
 }
 
-std::string Line::subclassMarker() const
+std::string_view Line::subclassMarker() const
 {
     return DxfSubclassMarker::Line;
 }
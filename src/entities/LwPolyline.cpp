@@ -35,12 +35,12 @@ ObjectType LwPolyline::objectType() const
     return ObjectType::LWPOLYLINE;
 }
 
-std::string LwPolyline::objectName() const
+std::string_view LwPolyline::objectName() const
 {
     return DxfFileToken::EntityLwPolyline;
 }
 
-std::string LwPolyline::subclassMarker() const
+std::string_view LwPolyline::subclassMarker() const
 {
     return DxfSubclassMarker::LwPolyline;
 }
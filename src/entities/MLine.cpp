@@ -38,12 +38,12 @@ ObjectType MLine::objectType() const
     return ObjectType::MLINE;
 }
 
-std::string MLine::objectName() const
+std::string_view MLine::objectName() const
 {
     return DxfFileToken::EntityMLine;
 }
 
-std::string MLine::subclassMarker() const
+std::string_view MLine::subclassMarker() const
 {
     return DxfSubclassMarker::MLine;
 }
@@ -37,12 +37,12 @@ ObjectType MText::objectType() const
     return ObjectType::MTEXT;
 }
 
-std::string MText::objectName() const
+std::string_view MText::objectName() const
 {
     return DxfFileToken::EntityMText;
 }
 
-std::string MText::subclassMarker() const
+std::string_view MText::subclassMarker() const
 {
     return DxfSubclassMarker::MText;
 }
@@ -41,12 +41,12 @@ ObjectType Mesh::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string Mesh::objectName() const
+std::string_view Mesh::objectName() const
 {
     return DxfFileToken::EntityMesh;
 }
 
-std::string Mesh::subclassMarker() const
+std::string_view Mesh::subclassMarker() const
 {
     return DxfSubclassMarker::Mesh;
 }
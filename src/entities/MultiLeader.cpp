@@ -50,12 +50,12 @@ ObjectType MultiLeader::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string MultiLeader::objectName() const
+std::string_view MultiLeader::objectName() const
 {
     return DxfFileToken::EntityMultiLeader;
 }
 
-std::string MultiLeader::subclassMarker() const
+std::string_view MultiLeader::subclassMarker() const
 {
     return DxfSubclassMarker::MultiLeader;
 }
@@ -34,7 +34,7 @@ ObjectType PdfUnderlay::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string PdfUnderlay::objectName() const
+std::string_view PdfUnderlay::objectName() const
 {
     return DxfFileToken::EntityPdfUnderlay;
 }
@@ -35,12 +35,12 @@ ObjectType Point::objectType() const
     return ObjectType::POINT;
 }
 
-std::string Point::objectName() const
+std::string_view Point::objectName() const
 {
     return DxfFileToken::EntityPoint;
 }
 
-std::string Point::subclassMarker() const
+std::string_view Point::subclassMarker() const
 {
     return DxfSubclassMarker::Point;
 }
@@ -27,11 +27,14 @@
 
 namespace dwg {
 /* -------------------------------- Polyline -------------------------------- */
-Polyline::Polyline() {}
+Polyline::Polyline() : _vertices(new VertexSeqendCollection(this)) {}
 
-Polyline::~Polyline() {}
+Polyline::~Polyline()
+{
+    delete _vertices;
+}
 
-std::string Polyline::objectName() const
+std::string_view Polyline::objectName() const
 {
     return DxfFileToken::EntityPolyline;
 }
@@ -138,7 +141,7 @@ ObjectType Polyline2D::objectType() const
     return ObjectType::POLYLINE_2D;
 }
 
-std::string Polyline2D::subclassMarker() const
+std::string_view Polyline2D::subclassMarker() const
 {
     return DxfSubclassMarker::Polyline;
 }
@@ -157,7 +160,7 @@ ObjectType Polyline3D::objectType() const
     return ObjectType::POLYLINE_3D;
 }
 
-std::string Polyline3D::subclassMarker() const
+std::string_view Polyline3D::subclassMarker() const
 {
     return DxfSubclassMarker::Polyline3d;
 }
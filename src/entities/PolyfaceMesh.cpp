@@ -36,12 +36,12 @@ ObjectType PolyfaceMesh::objectType() const
     return ObjectType::POLYLINE_PFACE;
 }
 
-std::string PolyfaceMesh::objectName() const
+std::string_view PolyfaceMesh::objectName() const
 {
     return DxfFileToken::EntityPolyline;
 }
 
-std::string PolyfaceMesh::subclassMarker() const
+std::string_view PolyfaceMesh::subclassMarker() const
 {
     return DxfSubclassMarker::PolyfaceMesh;
 }
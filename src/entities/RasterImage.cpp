@@ -40,12 +40,12 @@ ObjectType RasterImage::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string RasterImage::objectName() const
+std::string_view RasterImage::objectName() const
 {
     return DxfFileToken::EntityImage;
 }
 
-std::string RasterImage::subclassMarker() const
+std::string_view RasterImage::subclassMarker() const
 {
     return DxfSubclassMarker::RasterImage;
 }
@@ -35,12 +35,12 @@ ObjectType Ray::objectType() const
     return ObjectType::RAY;
 }
 
-std::string Ray::objectName() const
+std::string_view Ray::objectName() const
 {
     return DxfFileToken::EntityRay;
 }
 
-std::string Ray::subclassMarker() const
+std::string_view Ray::subclassMarker() const
 {
     return DxfSubclassMarker::Ray;
 }
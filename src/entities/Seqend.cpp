@@ -34,7 +34,7 @@ ObjectType Seqend::objectType() const
     return ObjectType::SEQEND;
 }
 
-std::string Seqend::objectName() const
+std::string_view Seqend::objectName() const
 {
     return DxfFileToken::EntitySeqend;
 }
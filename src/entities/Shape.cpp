@@ -37,12 +37,12 @@ ObjectType Shape::objectType() const
     return ObjectType::SHAPE;
 }
 
-std::string Shape::objectName() const
+std::string_view Shape::objectName() const
 {
     return DxfFileToken::EntityShape;
 }
 
-std::string Shape::subclassMarker() const
+std::string_view Shape::subclassMarker() const
 {
     return DxfSubclassMarker::Shape;
 }
@@ -35,12 +35,12 @@ ObjectType Solid::objectType() const
     return ObjectType::SOLID;
 }
 
-std::string Solid::objectName() const
+std::string_view Solid::objectName() const
 {
     return DxfFileToken::EntitySolid;
 }
 
-std::string Solid::subclassMarker() const
+std::string_view Solid::subclassMarker() const
 {
     return DxfSubclassMarker::Solid;
 }
@@ -35,12 +35,12 @@ ObjectType Solid3D::objectType() const
     return ObjectType::SOLID3D;
 }
 
-std::string Solid3D::objectName() const
+std::string_view Solid3D::objectName() const
 {
     return DxfFileToken::Entity3DSolid;
 }
 
-std::string Solid3D::subclassMarker() const
+std::string_view Solid3D::subclassMarker() const
 {
     return DxfSubclassMarker::ModelerGeometry;
 }
@@ -35,12 +35,12 @@ ObjectType Spline::objectType() const
     return ObjectType::SPLINE;
 }
 
-std::string Spline::objectName() const
+std::string_view Spline::objectName() const
 {
     return DxfFileToken::EntitySpline;
 }
 
-std::string Spline::subclassMarker() const
+std::string_view Spline::subclassMarker() const
 {
     return DxfSubclassMarker::Spline;
 }
@@ -50,12 +50,12 @@ ObjectType TableEntity::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string TableEntity::objectName() const
+std::string_view TableEntity::objectName() const
 {
     return DxfFileToken::EntityTable;
 }
 
-std::string TableEntity::subclassMarker() const
+std::string_view TableEntity::subclassMarker() const
 {
     return DxfSubclassMarker::TableEntity;
 }
@@ -35,12 +35,12 @@ ObjectType TextEntity::objectType() const
     return ObjectType::TEXT;
 }
 
-std::string TextEntity::objectName() const
+std::string_view TextEntity::objectName() const
 {
     return DxfFileToken::EntityText;
 }
 
-std::string TextEntity::subclassMarker() const
+std::string_view TextEntity::subclassMarker() const
 {
     return DxfSubclassMarker::Text;
 }
@@ -104,7 +104,10 @@ TextStyle *TextEntity::style() const
     return _style;
 }
 
-void TextEntity::setStyle(TextStyle *) {}
+void TextEntity::setStyle(TextStyle *value)
+{
+    _style = value;
+}
 
 TextMirrorFlag TextEntity::mirror() const
 {
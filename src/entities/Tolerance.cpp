@@ -38,12 +38,12 @@ ObjectType Tolerance::objectType() const
     return ObjectType::TOLERANCE;
 }
 
-std::string Tolerance::objectName() const
+std::string_view Tolerance::objectName() const
 {
     return DxfFileToken::EntityTolerance;
 }
 
-std::string Tolerance::subclassMarker() const
+std::string_view Tolerance::subclassMarker() const
 {
     return DxfSubclassMarker::Tolerance;
 }
@@ -34,7 +34,7 @@ UnderlayEntity::UnderlayEntity()
 
 UnderlayEntity::~UnderlayEntity() {}
 
-std::string UnderlayEntity::subclassMarker() const
+std::string_view UnderlayEntity::subclassMarker() const
 {
     return DxfSubclassMarker::Underlay;
 }
@@ -36,7 +36,7 @@ ObjectType UnknownEntity::objectType() const
     return ObjectType::UNDEFINED;
 }
 
-std::string UnknownEntity::objectName() const
+std::string_view UnknownEntity::objectName() const
 {
     if (!_dxfclass)
         return "UNKNOWN";
@@ -44,7 +44,7 @@ std::string UnknownEntity::objectName() const
         return _dxfclass->dxfName();
 }
 
-std::string UnknownEntity::subclassMarker() const
+std::string_view UnknownEntity::subclassMarker() const
 {
     if (!_dxfclass)
         return DxfSubclassMarker::Entity;
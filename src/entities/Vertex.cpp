@@ -33,7 +33,7 @@ Vertex::Vertex(const XYZ &v) {}
 
 Vertex::~Vertex() {}
 
-std::string Vertex::objectName() const
+std::string_view Vertex::objectName() const
 {
     return DxfFileToken::EntityVertex;
 }
@@ -121,7 +121,7 @@ ObjectType Vertex2D::objectType() const
     return ObjectType::VERTEX_2D;
 }
 
-std::string Vertex2D::subclassMarker() const
+std::string_view Vertex2D::subclassMarker() const
 {
     return DxfSubclassMarker::PolylineVertex;
 }
@@ -135,7 +135,7 @@ ObjectType Vertex3D::objectType() const
     return ObjectType::VERTEX_3D;
 }
 
-std::string Vertex3D::subclassMarker() const
+std::string_view Vertex3D::subclassMarker() const
 {
     return DxfSubclassMarker::Polyline3dVertex;
 }
@@ -151,7 +151,7 @@ ObjectType VertexFaceMesh::objectType() const
     return ObjectType::VERTEX_PFACE;
 }
 
-std::string VertexFaceMesh::subclassMarker() const
+std::string_view VertexFaceMesh::subclassMarker() const
 {
     return DxfSubclassMarker::PolyfaceMeshVertex;
 }
@@ -167,7 +167,7 @@ ObjectType VertexFaceRecord::objectType() const
     return ObjectType::VERTEX_PFACE_FACE;
 }
 
-std::string VertexFaceRecord::subclassMarker() const
+std::string_view VertexFaceRecord::subclassMarker() const
 {
     return DxfSubclassMarker::PolyfaceMeshFace;
 }
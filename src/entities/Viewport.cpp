@@ -39,12 +39,12 @@ ObjectType Viewport::objectType() const
     return ObjectType::VIEWPORT;
 }
 
-std::string Viewport::objectName() const
+std::string_view Viewport::objectName() const
 {
     return DxfFileToken::EntityViewport;
 }
 
-std::string Viewport::subclassMarker() const
+std::string_view Viewport::subclassMarker() const
 {
     return DxfSubclassMarker::Viewport;
 }
@@ -37,12 +37,12 @@ ObjectType Wipeout::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string Wipeout::objectName() const
+std::string_view Wipeout::objectName() const
 {
     return DxfFileToken::EntityWipeout;
 }
 
-std::string Wipeout::subclassMarker() const
+std::string_view Wipeout::subclassMarker() const
 {
     return DxfSubclassMarker::Wipeout;
 }
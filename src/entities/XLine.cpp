@@ -37,12 +37,12 @@ ObjectType XLine::objectType() const
     return ObjectType::XLINE;
 }
 
-std::string XLine::objectName() const
+std::string_view XLine::objectName() const
 {
     return DxfFileToken::EntityXline;
 }
 
-std::string XLine::subclassMarker() const
+std::string_view XLine::subclassMarker() const
 {
     return DxfSubclassMarker::XLine;
 }
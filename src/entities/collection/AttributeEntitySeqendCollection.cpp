@@ -20,6 +20,8 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <algorithm>
+#include <dwg/entities/AttributeEntity.h>
 #include <dwg/entities/Seqend.h>
 #include <dwg/entities/collection/AttributeEntitySeqendCollection.h>
 
@@ -28,9 +30,18 @@ namespace dwg {
 AttributeEntitySeqendCollection::AttributeEntitySeqendCollection(CadObject *owner) : _owner(owner)
 {
     _seqend = new Seqend();
+    _seqend->setOwner(_owner);
 }
 
-AttributeEntitySeqendCollection::~AttributeEntitySeqendCollection() {}
+AttributeEntitySeqendCollection::~AttributeEntitySeqendCollection()
+{
+    delete _seqend;
+}
+
+std::vector<CadObject *> AttributeEntitySeqendCollection::rawCadObjects() const
+{
+    return std::vector<CadObject *>(_entities.begin(), _entities.end());
+}
 
 CadObject *AttributeEntitySeqendCollection::owner() const
 {
@@ -44,7 +55,11 @@ Seqend *AttributeEntitySeqendCollection::seqend() const
 
 void AttributeEntitySeqendCollection::setSeqend(Seqend *value)
 {
-    _seqend = value;
+    if (value != _seqend)
+    {
+        delete _seqend;
+        _seqend = value;
+    }
 }
 
 size_t AttributeEntitySeqendCollection::size() const
@@ -62,15 +77,41 @@ AttributeEntity *AttributeEntitySeqendCollection::operator[](size_t index)
     return _entities.operator[](index);
 }
 
-void AttributeEntitySeqendCollection::add(AttributeEntity *entity) {}
+void AttributeEntitySeqendCollection::add(AttributeEntity *entity)
+{
+    if (!entity)
+        return;
 
-void AttributeEntitySeqendCollection::add(const std::initializer_list<AttributeEntity *> &entities) {}
+    entity->setOwner(_owner);
+    _entities.push_back(entity);
+}
+
+void AttributeEntitySeqendCollection::add(const std::initializer_list<AttributeEntity *> &entities)
+{
+    for (auto &&entity: entities)
+    {
+        add(entity);
+    }
+}
 
 AttributeEntity *AttributeEntitySeqendCollection::remove(AttributeEntity *entity)
 {
+    auto it = std::find(_entities.begin(), _entities.end(), entity);
+    if (it == _entities.end())
+        return nullptr;
+
+    _entities.erase(it);
+    entity->setOwner(nullptr);
     return entity;
 }
 
-void AttributeEntitySeqendCollection::clear() {}
+void AttributeEntitySeqendCollection::clear()
+{
+    for (auto &&entity: _entities)
+    {
+        entity->setOwner(nullptr);
+    }
+    _entities.clear();
+}
 
 }// namespace dwg
\ No newline at end of file
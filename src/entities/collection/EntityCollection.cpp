@@ -65,38 +65,67 @@ void EntityCollection::add(Entity *entity)
 {
     assert(entity);
 
+    //An entity of this collection is owned by it, the owner check also rejects duplicates
+    if (entity->owner() == _owner)
+        throw std::runtime_error("Item is already in the collection");
     if (entity->owner() != nullptr)
         throw std::runtime_error("Item already has an owner");
 
-    auto filter = [entity](Entity *ent) { return ent == entity; };
-    auto itFind = std::find_if(_entities.begin(), _entities.end(), filter);
-    if (itFind != _entities.end())
-        throw std::runtime_error("Item is already in the collection");
-
     _entities.emplace_back(entity);
     entity->setOwner(_owner);
-    OnAdd(entity);
+    notifyAdded(entity);
 }
 
 void EntityCollection::add(const std::initializer_list<Entity *> &entities)
 {
+    addRange(entities);
+}
+
+void EntityCollection::addRange(const std::vector<Entity *> &entities)
+{
+    if (entities.empty())
+        return;
+
+    const size_t count = _entities.size();
+    _entities.reserve(count + entities.size());
     for (auto &&entity: entities)
     {
-        add(entity);
+        assert(entity);
+
+        //Owners are set while appending, so a repeated entity in the range is caught as well
+        if (entity->owner() != nullptr)
+        {
+            const bool duplicate = entity->owner() == _owner;
+            for (size_t i = count; i < _entities.size(); ++i)
+            {
+                _entities[i]->setOwner(nullptr);
+            }
+            _entities.resize(count);
+
+            if (duplicate)
+                throw std::runtime_error("Item is already in the collection");
+            throw std::runtime_error("Item already has an owner");
+        }
+
+        _entities.emplace_back(entity);
+        entity->setOwner(_owner);
     }
+
+    notifyAdded(std::vector<CadObject *>(_entities.begin() + count, _entities.end()));
 }
 
 Entity *EntityCollection::remove(Entity *entity)
 {
-    auto filter = [entity](Entity *ent) { return ent == entity; };
-    auto itFind = std::find_if(_entities.begin(), _entities.end(), filter);
+    if (!entity || entity->owner() != _owner)
+        return nullptr;
+
+    auto itFind = std::find(_entities.begin(), _entities.end(), entity);
     if (itFind == _entities.end())
         return nullptr;
 
     _entities.erase(itFind);
-    auto item = *itFind;
-    item->setOwner(nullptr);
-    OnRemove(item);
+    entity->setOwner(nullptr);
+    notifyRemoved(entity);
     return entity;
 }
 
@@ -20,7 +20,9 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <algorithm>
 #include <dwg/entities/Seqend.h>
+#include <dwg/entities/Vertex.h>
 #include <dwg/entities/collection/VertexSeqendCollection.h>
 
 namespace dwg {
@@ -28,9 +30,18 @@ namespace dwg {
 VertexSeqendCollection::VertexSeqendCollection(CadObject *owner) : _owner(owner)
 {
     _seqend = new Seqend();
+    _seqend->setOwner(_owner);
 }
 
-VertexSeqendCollection::~VertexSeqendCollection() {}
+VertexSeqendCollection::~VertexSeqendCollection()
+{
+    delete _seqend;
+}
+
+std::vector<CadObject *> VertexSeqendCollection::rawCadObjects() const
+{
+    return std::vector<CadObject *>(_entities.begin(), _entities.end());
+}
 
 CadObject *VertexSeqendCollection::owner() const
 {
@@ -44,7 +55,11 @@ Seqend *VertexSeqendCollection::seqend() const
 
 void VertexSeqendCollection::setSeqend(Seqend *value)
 {
-    _seqend = value;
+    if (value != _seqend)
+    {
+        delete _seqend;
+        _seqend = value;
+    }
 }
 
 size_t VertexSeqendCollection::size() const
@@ -62,15 +77,41 @@ Vertex *VertexSeqendCollection::operator[](size_t index)
     return _entities.operator[](index);
 }
 
-void VertexSeqendCollection::add(Vertex *entity) {}
+void VertexSeqendCollection::add(Vertex *entity)
+{
+    if (!entity)
+        return;
 
-void VertexSeqendCollection::add(const std::initializer_list<Vertex *> &entities) {}
+    entity->setOwner(_owner);
+    _entities.push_back(entity);
+}
+
+void VertexSeqendCollection::add(const std::initializer_list<Vertex *> &entities)
+{
+    for (auto &&entity: entities)
+    {
+        add(entity);
+    }
+}
 
 Vertex *VertexSeqendCollection::remove(Vertex *entity)
 {
+    auto it = std::find(_entities.begin(), _entities.end(), entity);
+    if (it == _entities.end())
+        return nullptr;
+
+    _entities.erase(it);
+    entity->setOwner(nullptr);
     return entity;
 }
 
-void VertexSeqendCollection::clear() {}
+void VertexSeqendCollection::clear()
+{
+    for (auto &&entity: _entities)
+    {
+        entity->setOwner(nullptr);
+    }
+    _entities.clear();
+}
 
 }// namespace dwg
\ No newline at end of file
@@ -47,6 +47,9 @@
 
 namespace dwg {
 
+//Name returned while the header has no UCS
+static const std::string EmptyName;
+
 CadHeader::CadHeader() : CadHeader(ACadVersion::AC1032) {}
 
 CadHeader::CadHeader(CadDocument *document) : CadHeader(ACadVersion::AC1032)
@@ -61,7 +64,9 @@ CadDocument *CadHeader::document()
 
 void CadHeader::setDocument(CadDocument *document) {}
 
-CadHeader::CadHeader(ACadVersion version) : _version(version)
+CadHeader::CadHeader(ACadVersion version)
+    : _version(version), _modelSpaceUcs(nullptr), _modelSpaceUcsBase(nullptr), _paperSpaceUcs(nullptr),
+      _paperSpaceUcsBase(nullptr)
 {
     setVersion(version);
 #ifdef _WIN32
@@ -92,7 +97,7 @@ CadHeader::CadHeader(ACadVersion version) : _version(version)
     _dimensionTextStyle = TextStyle::Default();
 }
 
-const std::string &CadHeader::versionString() const
+std::string CadHeader::versionString() const
 {
     return CadUtils::GetNameFromVersion(_version);
 }
@@ -702,27 +707,33 @@ void CadHeader::setTextHeightDefault(double value)
 
 const std::string &CadHeader::textStyleName() const
 {
-    return std::string();
+    return _currentTextStyle->name();
 }
 
 void CadHeader::setTextStyleName(const std::string &value)
 {
-    // TODO
+    _currentTextStyle->setName(value);
 }
 
 const std::string &CadHeader::currentLayerName() const
 {
-    return std::string();
+    return _currentLayer->name();
 }
 
-void CadHeader::setCurrentLayerName(const std::string &value) {}
+void CadHeader::setCurrentLayerName(const std::string &value)
+{
+    _currentLayer->setName(value);
+}
 
 const std::string &CadHeader::currentLineTypeName() const
 {
-    return std::string();
+    return _currentLineType->name();
 }
 
-void CadHeader::setCurrentLineTypeName(const std::string &value) {}
+void CadHeader::setCurrentLineTypeName(const std::string &value)
+{
+    _currentLineType->setName(value);
+}
 
 double CadHeader::traceWidthDefault() const
 {
@@ -908,17 +919,23 @@ void CadHeader::setCurrentMultilineScale(double value)
 
 const std::string &CadHeader::currentMultiLineStyleName() const
 {
-    return std::string();
+    return _currentMLineStyle->name();
 }
 
-void CadHeader::setCurrentMultiLineStyleName(const std::string &value) {}
+void CadHeader::setCurrentMultiLineStyleName(const std::string &value)
+{
+    _currentMLineStyle->setName(value);
+}
 
 const std::string &CadHeader::currentDimensionStyleName() const
 {
-    return std::string();
+    return _currentDimensionStyle->name();
 }
 
-void CadHeader::setCurrentDimensionStyleName(const std::string &value) {}
+void CadHeader::setCurrentDimensionStyleName(const std::string &value)
+{
+    _currentDimensionStyle->setName(value);
+}
 
 long long CadHeader::requiredVersions() const
 {
@@ -1110,7 +1127,7 @@ const std::string &CadHeader::paperSpaceBaseName() const
     {
         return _paperSpaceUcsBase->name();
     }
-    return std::string();
+    return EmptyName;
 }
 
 void CadHeader::setPaperSpaceBaseName(const std::string &value)
@@ -1127,7 +1144,7 @@ const std::string &CadHeader::paperSpaceName() const
     {
         return _paperSpaceUcs->name();
     }
-    return std::string();
+    return EmptyName;
 }
 
 void CadHeader::setPaperSpaceName(const std::string &value)
@@ -1138,7 +1155,7 @@ void CadHeader::setPaperSpaceName(const std::string &value)
     }
 }
 
-const XYZ &CadHeader::paperSpaceUcsOrigin() const
+XYZ CadHeader::paperSpaceUcsOrigin() const
 {
     if (_paperSpaceUcs)
     {
@@ -1155,7 +1172,7 @@ void CadHeader::setPaperSpaceUcsOrigin(const XYZ &value)
     }
 }
 
-const XYZ &CadHeader::paperSpaceUcsXAxis() const
+XYZ CadHeader::paperSpaceUcsXAxis() const
 {
     if (_paperSpaceUcs)
     {
@@ -1172,7 +1189,7 @@ void CadHeader::setPaperSpaceUcsXAxis(const XYZ &value)
     }
 }
 
-const XYZ &CadHeader::paperSpaceUcsYAxis() const
+XYZ CadHeader::paperSpaceUcsYAxis() const
 {
     if (_paperSpaceUcs)
     {
@@ -1365,7 +1382,7 @@ const std::string &CadHeader::ucsBaseName() const
     {
         return _modelSpaceUcsBase->name();
     }
-    return std::string();
+    return EmptyName;
 }
 
 void CadHeader::setUcsBaseName(const std::string &value)
@@ -1382,7 +1399,7 @@ const std::string &CadHeader::ucsName() const
     {
         return _modelSpaceUcs->name();
     }
-    return std::string();
+    return EmptyName;
 }
 
 void CadHeader::setUcsName(const std::string &value)
@@ -1410,7 +1427,7 @@ void CadHeader::setElevation(double value)
     }
 }
 
-const XYZ &CadHeader::modelSpaceOrigin() const
+XYZ CadHeader::modelSpaceOrigin() const
 {
     if (_modelSpaceUcs)
     {
@@ -1427,7 +1444,7 @@ void CadHeader::setModelSpaceOrigin(const XYZ &value)
     }
 }
 
-const XYZ &CadHeader::modelSpaceXAxis() const
+XYZ CadHeader::modelSpaceXAxis() const
 {
     if (_modelSpaceUcs)
     {
@@ -1444,7 +1461,7 @@ void CadHeader::setModelSpaceXAxis(const XYZ &value)
     }
 }
 
-const XYZ &CadHeader::modelSpaceYAxis() const
+XYZ CadHeader::modelSpaceYAxis() const
 {
     if (_modelSpaceUcs)
     {
@@ -2321,7 +2338,7 @@ void CadHeader::setDimensionAlternateUnitRounding(double value)
     _dimensionStyleOverrides->setAlternateUnitRounding(value);
 }
 
-const std::string &CadHeader::dimensionAlternateDimensioningSuffix() const
+std::string CadHeader::dimensionAlternateDimensioningSuffix() const
 {
     return _dimensionStyleOverrides->alternateDimensioningSuffix();
 }
@@ -2391,7 +2408,7 @@ void CadHeader::setDimensionTickSize(double value)
     _dimensionStyleOverrides->setTickSize(value);
 }
 
-const Color &CadHeader::dimensionLineColor() const
+Color CadHeader::dimensionLineColor() const
 {
     return _dimensionStyleOverrides->dimensionLineColor();
 }
@@ -2401,7 +2418,7 @@ void CadHeader::setDimensionLineColor(const Color &value)
     _dimensionStyleOverrides->setDimensionLineColor(value);
 }
 
-const Color &CadHeader::dimensionExtensionLineColor() const
+Color CadHeader::dimensionExtensionLineColor() const
 {
     return _dimensionStyleOverrides->extensionLineColor();
 }
@@ -2411,7 +2428,7 @@ void CadHeader::setDimensionExtensionLineColor(const Color &value)
     _dimensionStyleOverrides->setExtensionLineColor(value);
 }
 
-const Color &CadHeader::dimensionTextColor() const
+Color CadHeader::dimensionTextColor() const
 {
     return _dimensionStyleOverrides->textColor();
 }
@@ -2491,7 +2508,7 @@ void CadHeader::setDimensionTextBackgroundFillMode(DimensionTextBackgroundFillMo
     _dimensionStyleOverrides->setTextBackgroundFillMode(value);
 }
 
-const Color &CadHeader::dimensionTextBackgroundColor() const
+Color CadHeader::dimensionTextBackgroundColor() const
 {
     return _dimensionStyleOverrides->textBackgroundColor();
 }
@@ -2551,7 +2568,7 @@ void CadHeader::setExtensionLineWeight(LineweightType value)
     _dimensionStyleOverrides->setExtensionLineWeight(value);
 }
 
-const std::string &CadHeader::dimensionPostFix() const
+std::string CadHeader::dimensionPostFix() const
 {
     return _dimensionStyleOverrides->postFix();
 }
@@ -2731,7 +2748,7 @@ void CadHeader::setDimensionAltMzf(double value)
     _dimensionStyleOverrides->setAltMzf(value);
 }
 
-const std::string &CadHeader::dimensionAltMzs() const
+std::string CadHeader::dimensionAltMzs() const
 {
     return _dimensionStyleOverrides->altMzs();
 }
@@ -2751,7 +2768,7 @@ void CadHeader::setDimensionMzf(double value)
     _dimensionStyleOverrides->setMzf(value);
 }
 
-const std::string &CadHeader::dimensionMzs() const
+std::string CadHeader::dimensionMzs() const
 {
     return _dimensionStyleOverrides->mzs();
 }
@@ -61,4 +61,14 @@ void CadReaderConfiguration::setKeepUnknownNonGraphicalObjects(bool value)
     _keepUnknownNonGraphicalObjects = value;
 }
 
+std::shared_ptr<std::pmr::memory_resource> CadReaderConfiguration::memoryResource() const
+{
+    return _memoryResource;
+}
+
+void CadReaderConfiguration::setMemoryResource(const std::shared_ptr<std::pmr::memory_resource> &value)
+{
+    _memoryResource = value;
+}
+
 }// namespace dwg
\ No newline at end of file
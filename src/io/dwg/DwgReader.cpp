@@ -21,6 +21,7 @@
  */
 
 #include <dwg/CadDocument.h>
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/CadSummaryInfo.h>
 #include <dwg/CadUtils.h>
 #include <dwg/header/CadHeader.h>
@@ -66,6 +67,13 @@ DwgReader::~DwgReader() {}
 CadDocument *DwgReader::read()
 {
     _document = new CadDocument(false);
+    //The configured resource only feeds the pool of the document, see CadMemoryScope
+    _document->setMemoryResource(CadMemoryScope::createPool(memoryResource()));
+    if (!_templateResource)
+    {
+        _templateResource = CadMemoryScope::createPool();
+    }
+    CadMemoryScope scope(_document->memoryResource().get(), _templateResource.get());
 
     //Read the file header
     _fileHeader = readFileHeader();
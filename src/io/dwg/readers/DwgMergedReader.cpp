@@ -21,7 +21,442 @@
  */
 
 #include <dwg/io/dwg/readers/DwgMergedReader_p.h>
+#include <dwg/io/dwg/readers/DwgStreamReaderBase_p.h>
+#include <stdexcept>
 
 namespace dwg {
 
-}
\ No newline at end of file
+DwgObjectBuffer::DwgObjectBuffer(const unsigned char *data, std::size_t size)
+{
+    char *begin = const_cast<char *>(reinterpret_cast<const char *>(data));
+    setg(begin, begin, begin + size);
+}
+
+DwgObjectBuffer::pos_type DwgObjectBuffer::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                   std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in))
+    {
+        return pos_type(gptr() - eback());
+    }
+
+    off_type target = off;
+    if (dir == std::ios_base::cur)
+    {
+        target += gptr() - eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        target += egptr() - eback();
+    }
+
+    if (target < 0 || target > egptr() - eback())
+    {
+        return pos_type(off_type(-1));
+    }
+
+    setg(eback(), eback() + target, egptr());
+    return pos_type(target);
+}
+
+DwgObjectBuffer::pos_type DwgObjectBuffer::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+struct DwgMergedReader::Cursor
+{
+    Cursor(const unsigned char *data, std::size_t size) : buffer(data, size), stream(&buffer) {}
+
+    DwgObjectBuffer buffer;
+    std::iostream stream;
+    std::unique_ptr<IDwgStreamReader> reader;
+};
+
+DwgMergedReader::DwgMergedReader(IDwgStreamReader *mainReader, IDwgStreamReader *textReader,
+                                 IDwgStreamReader *handleReader)
+    : _mainReader(mainReader), _textReader(textReader), _handleReader(handleReader)
+{
+}
+
+DwgMergedReader::DwgMergedReader(ACadVersion version, const std::vector<unsigned char> &buffer, Encoding encoding)
+    : _data(buffer.data()), _size(buffer.size())
+{
+    _mainReader = createCursor(version, encoding);
+    _handleReader = createCursor(version, encoding);
+
+    //Strings are stored inline before R2007
+    if (version < ACadVersion::AC1021)
+    {
+        _textReader = _mainReader;
+    }
+    else
+    {
+        _textReader = createCursor(version, encoding);
+    }
+}
+
+DwgMergedReader::~DwgMergedReader() {}
+
+IDwgStreamReader *DwgMergedReader::createCursor(ACadVersion version, Encoding encoding)
+{
+    auto cursor = std::make_unique<Cursor>(_data, _size);
+    cursor->reader.reset(DwgStreamReaderBase::GetStreamHandler(version, &cursor->stream, encoding, true));
+    IDwgStreamReader *reader = cursor->reader.get();
+    _cursors.push_back(std::move(cursor));
+    return reader;
+}
+
+IDwgStreamReader *DwgMergedReader::mainReader() const
+{
+    return _mainReader;
+}
+
+IDwgStreamReader *DwgMergedReader::textReader() const
+{
+    return _textReader;
+}
+
+IDwgStreamReader *DwgMergedReader::handleReader() const
+{
+    return _handleReader;
+}
+
+void DwgMergedReader::setMainPositionInBits(long long position)
+{
+    _mainReader->setPositionInBits(position);
+}
+
+void DwgMergedReader::setHandlePositionInBits(long long position)
+{
+    _handleReader->setPositionInBits(position);
+}
+
+long long DwgMergedReader::setTextPositionByFlag(long long position)
+{
+    if (_textReader == _mainReader)
+    {
+        return position;
+    }
+
+    if (auto base = dynamic_cast<DwgStreamReaderBase *>(_textReader))
+    {
+        base->setEmpty(false);
+    }
+    return _textReader->setPositionByFlag(position);
+}
+
+Encoding DwgMergedReader::encoding() const
+{
+    return _mainReader->encoding();
+}
+
+void DwgMergedReader::setEncoding(Encoding value)
+{
+    _mainReader->setEncoding(value);
+    _textReader->setEncoding(value);
+    _handleReader->setEncoding(value);
+}
+
+std::iostream *DwgMergedReader::stream()
+{
+    throw std::runtime_error("DwgMergedReader does not expose a single stream");
+}
+
+int DwgMergedReader::bitShift() const
+{
+    return _mainReader->bitShift();
+}
+
+long long DwgMergedReader::position() const
+{
+    return _mainReader->position();
+}
+
+bool DwgMergedReader::isEmpty() const
+{
+    return _mainReader->isEmpty();
+}
+
+void DwgMergedReader::setPosition(long long)
+{
+    throw std::runtime_error("DwgMergedReader cursors cannot be repositioned");
+}
+
+void DwgMergedReader::advance(int offset)
+{
+    _mainReader->advance(offset);
+}
+
+void DwgMergedReader::advanceByte()
+{
+    _mainReader->advanceByte();
+}
+
+unsigned long long DwgMergedReader::handleReference()
+{
+    return _handleReader->handleReference();
+}
+
+unsigned long long DwgMergedReader::handleReference(unsigned long long referenceHandle)
+{
+    return _handleReader->handleReference(referenceHandle);
+}
+
+unsigned long long DwgMergedReader::handleReference(unsigned long long referenceHandle, DwgReferenceType &reference)
+{
+    return _handleReader->handleReference(referenceHandle, reference);
+}
+
+long long DwgMergedReader::positionInBits()
+{
+    return _mainReader->positionInBits();
+}
+
+unsigned char DwgMergedReader::read2Bits()
+{
+    return _mainReader->read2Bits();
+}
+
+XY DwgMergedReader::read2RawDouble()
+{
+    return _mainReader->read2RawDouble();
+}
+
+XYZ DwgMergedReader::read3RawDouble()
+{
+    return _mainReader->read3RawDouble();
+}
+
+XYZ DwgMergedReader::read3BitDouble()
+{
+    return _mainReader->read3BitDouble();
+}
+
+bool DwgMergedReader::readBit()
+{
+    return _mainReader->readBit();
+}
+
+short DwgMergedReader::readBitAsShort()
+{
+    return _mainReader->readBitAsShort();
+}
+
+double DwgMergedReader::readBitDouble()
+{
+    return _mainReader->readBitDouble();
+}
+
+XY DwgMergedReader::read2BitDouble()
+{
+    return _mainReader->read2BitDouble();
+}
+
+int DwgMergedReader::readBitLong()
+{
+    return _mainReader->readBitLong();
+}
+
+long long DwgMergedReader::readBitLongLong()
+{
+    return _mainReader->readBitLongLong();
+}
+
+short DwgMergedReader::readBitShort()
+{
+    return _mainReader->readBitShort();
+}
+
+bool DwgMergedReader::readBitShortAsBool()
+{
+    return _mainReader->readBitShortAsBool();
+}
+
+unsigned char DwgMergedReader::readByte()
+{
+    return _mainReader->readByte();
+}
+
+std::vector<unsigned char> DwgMergedReader::readBytes(int length)
+{
+    return _mainReader->readBytes(length);
+}
+
+XY DwgMergedReader::read2BitDoubleWithDefault(const XY &defValue)
+{
+    return _mainReader->read2BitDoubleWithDefault(defValue);
+}
+
+XYZ DwgMergedReader::read3BitDoubleWithDefault(const XYZ &defValue)
+{
+    return _mainReader->read3BitDoubleWithDefault(defValue);
+}
+
+void DwgMergedReader::read2BitDoubles(XY *points, std::size_t count)
+{
+    _mainReader->read2BitDoubles(points, count);
+}
+
+void DwgMergedReader::read3BitDoubles(XYZ *points, std::size_t count)
+{
+    _mainReader->read3BitDoubles(points, count);
+}
+
+void DwgMergedReader::read2BitDoublesWithDefault(XY *points, std::size_t count, const XY &defValue)
+{
+    _mainReader->read2BitDoublesWithDefault(points, count, defValue);
+}
+
+void DwgMergedReader::read3BitDoublesWithDefault(XYZ *points, std::size_t count, const XYZ &defValue)
+{
+    _mainReader->read3BitDoublesWithDefault(points, count, defValue);
+}
+
+Color DwgMergedReader::readCmColor()
+{
+    //To read the color name and book, use the text reader
+    return _mainReader->readCmColor();
+}
+
+Color DwgMergedReader::readEnColor(Transparency &transparency, bool &flag)
+{
+    return _mainReader->readEnColor(transparency, flag);
+}
+
+DateTime DwgMergedReader::read8BitJulianDate()
+{
+    return _mainReader->read8BitJulianDate();
+}
+
+DateTime DwgMergedReader::readDateTime()
+{
+    return _mainReader->readDateTime();
+}
+
+double DwgMergedReader::readDouble()
+{
+    return _mainReader->readDouble();
+}
+
+int DwgMergedReader::readInt()
+{
+    return _mainReader->readInt();
+}
+
+unsigned long long DwgMergedReader::readModularChar()
+{
+    return _mainReader->readModularChar();
+}
+
+int DwgMergedReader::readSignedModularChar()
+{
+    return _mainReader->readSignedModularChar();
+}
+
+int DwgMergedReader::readModularShort()
+{
+    return _mainReader->readModularShort();
+}
+
+Color DwgMergedReader::readColorByIndex()
+{
+    return _mainReader->readColorByIndex();
+}
+
+ObjectType DwgMergedReader::readObjectType()
+{
+    return _mainReader->readObjectType();
+}
+
+XYZ DwgMergedReader::readBitExtrusion()
+{
+    return _mainReader->readBitExtrusion();
+}
+
+double DwgMergedReader::readBitDoubleWithDefault(double def)
+{
+    return _mainReader->readBitDoubleWithDefault(def);
+}
+
+double DwgMergedReader::readBitThickness()
+{
+    return _mainReader->readBitThickness();
+}
+
+char DwgMergedReader::readRawChar()
+{
+    return _mainReader->readRawChar();
+}
+
+unsigned long long DwgMergedReader::readRawULong()
+{
+    return _mainReader->readRawULong();
+}
+
+std::vector<unsigned char> DwgMergedReader::readSentinel()
+{
+    return _mainReader->readSentinel();
+}
+
+short DwgMergedReader::readShort()
+{
+    return _mainReader->readShort();
+}
+
+long long DwgMergedReader::readRawLong()
+{
+    return _mainReader->readRawLong();
+}
+
+std::string DwgMergedReader::readString(size_t length, Encoding encoding)
+{
+    return _mainReader->readString(length, encoding);
+}
+
+std::string DwgMergedReader::readTextUtf8()
+{
+    //Prevent empty string
+    if (_textReader->isEmpty())
+    {
+        return std::string();
+    }
+    return _textReader->readTextUtf8();
+}
+
+Timespan DwgMergedReader::readTimeSpan()
+{
+    return _mainReader->readTimeSpan();
+}
+
+unsigned int DwgMergedReader::readUInt()
+{
+    return _mainReader->readUInt();
+}
+
+std::string DwgMergedReader::readVariableText()
+{
+    //Prevent empty string
+    if (_textReader->isEmpty())
+    {
+        return std::string();
+    }
+    return _textReader->readVariableText();
+}
+
+unsigned short DwgMergedReader::resetShift()
+{
+    return _mainReader->resetShift();
+}
+
+void DwgMergedReader::setPositionInBits(long long)
+{
+    throw std::runtime_error("DwgMergedReader cursors cannot be repositioned");
+}
+
+long long DwgMergedReader::setPositionByFlag(long long)
+{
+    throw std::runtime_error("DwgMergedReader cursors cannot be repositioned");
+}
+
+}// namespace dwg
\ No newline at end of file
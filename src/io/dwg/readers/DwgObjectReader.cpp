@@ -20,16 +20,44 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/classes/DxfClass.h>
+#include <dwg/classes/DxfClassCollection.h>
+#include <dwg/entities/RasterImage.h>
+#include <dwg/entities/Vertex.h>
+#include <dwg/entities/Wipeout.h>
+#include <dwg/io/dwg/DwgDocumentBuilder_p.h>
 #include <dwg/io/dwg/fileheaders/DwgSectionDefinition_p.h>
+#include <dwg/io/dwg/readers/DwgMergedReader_p.h>
 #include <dwg/io/dwg/readers/DwgObjectReader_p.h>
+#include <dwg/tables/collections/AppIdsTable.h>
+#include <dwg/tables/collections/DimensionStylesTable.h>
+#include <dwg/tables/collections/LayersTable.h>
+#include <dwg/tables/collections/TextStylesTable.h>
+#include <dwg/tables/collections/UCSTable.h>
+#include <dwg/tables/collections/VPortsTable.h>
+#include <dwg/tables/collections/ViewsTable.h>
+#include <fmt/core.h>
+#include <unordered_map>
 
 namespace dwg {
 
 DwgObjectReader::DwgObjectReader(ACadVersion version, DwgDocumentBuilder *builder, IDwgStreamReader *reader,
                                  const std::queue<unsigned long long> &handles,
                                  const std::map<unsigned long long, long long> &handleMap, DxfClassCollection *classes)
-    : DwgSectionIO(version)
+    : DwgSectionIO(version), _sreader(reader), _header(nullptr), _builder(builder), _classes(classes),
+      _handles(handles), _handleMap(handleMap)
 {
+    //Setup the entity handler
+    std::iostream *stream = _sreader->stream();
+    stream->seekg(0, std::ios::end);
+    _crcStreamBuffer.resize(static_cast<std::size_t>(stream->tellg()));
+    stream->seekg(0, std::ios::beg);
+    stream->read(reinterpret_cast<char *>(_crcStreamBuffer.data()), _crcStreamBuffer.size());
+    stream->seekg(0, std::ios::beg);
+
+    _mergedReader = std::make_unique<DwgMergedReader>(_version, _crcStreamBuffer, _sreader->encoding());
+
+    buildObjectReaders(classes);
 }
 
 DwgObjectReader::~DwgObjectReader() {}
@@ -39,21 +67,491 @@ std::string DwgObjectReader::sectionName() const
     return DwgSectionDefinition::AcDbObjects;
 }
 
-void DwgObjectReader::read() {}
+void DwgObjectReader::read()
+{
+    //Read each handle in the header
+    while (!_handles.empty())
+    {
+        unsigned long long handle = _handles.front();
+        _handles.pop();
+
+        auto offset = _handleMap.find(handle);
+        if (offset == _handleMap.end() || _readedObjects.find(handle) != _readedObjects.end())
+        {
+            continue;
+        }
+
+        //Get the object type
+        ObjectType type = getEntityType(offset->second);
+        //Save the object to avoid infinite loops while reading
+        _readedObjects.insert({handle, type});
+
+        CadTemplate *temp = nullptr;
+        try
+        {
+            temp = readObject(type);
+        }
+        catch (const std::exception &ex)
+        {
+            if (!_builder->configuration().failsafe())
+            {
+                throw;
+            }
+            notify(fmt::format("Could not read object type {} with handle: {}, {}", (int) type, handle, ex.what()),
+                   Notification::Error);
+        }
+
+        if (!temp)
+        {
+            //The decoder for this type is not ported yet, the object is skipped
+            notify(fmt::format("Object type not implemented: {} with handle: {}", (int) type, handle),
+                   Notification::NotImplemented);
+            continue;
+        }
+
+        //Add the template to the list to be processed
+        _builder->setAppTemplate(temp);
+    }
+}
 
 ObjectType DwgObjectReader::getEntityType(long long offset)
 {
-    return ObjectType::UNLISTED;
+    ObjectType type = ObjectType::INVALID;
+
+    //Set the position to the entity to find
+    _mergedReader->setMainPositionInBits(offset * 8LL);
+    IDwgStreamReader *objectReader = _mergedReader->mainReader();
+
+    //MS : Size of object, not including the CRC
+    unsigned int size = (unsigned int) objectReader->readModularShort();
+    if (size <= 0U)
+    {
+        return type;
+    }
+
+    //remove the padding bits make sure the object stream ends on a byte boundary
+    unsigned int sizeInBits = size << 3;
+
+    //R2010+:
+    if (R2010Plus)
+    {
+        //MC : Size in bits of the handle stream (unsigned, 0x40 is not interpreted as sign).
+        //This includes the padding bits at the end of the handle stream
+        //(the padding bits make sure the object stream ends on a byte boundary).
+        unsigned long long handleSize = objectReader->readModularChar();
+
+        //Find the handles offset
+        long long handleSectionOffset = objectReader->positionInBits() + sizeInBits - (long long) handleSize;
+
+        //set the initial posiltion and get the object type
+        _objectInitialPos = objectReader->positionInBits();
+        type = objectReader->readObjectType();
+
+        //Place the handle and text cursors, they only move forward from here
+        _mergedReader->setHandlePositionInBits(handleSectionOffset);
+        _mergedReader->setTextPositionByFlag(handleSectionOffset - 1);
+    }
+    else
+    {
+        //set the initial posiltion and get the object type
+        _objectInitialPos = objectReader->positionInBits();
+        type = objectReader->readObjectType();
+    }
+
+    _size = size;
+    return type;
+}
+
+void DwgObjectReader::updateHandleReader()
+{
+    //RL: Size of object data in bits (number of bits before the handles),
+    //or the "endbit" of the pre-handles section.
+    long long size = _mergedReader->readRawLong();
+    _mergedReader->setHandlePositionInBits(size + _objectInitialPos);
+
+    //Set the position to the handle section
+    if (_version == ACadVersion::AC1021)
+    {
+        //"endbit" of the pre-handles section.
+        _mergedReader->setTextPositionByFlag(size + _objectInitialPos - 1);
+    }
 }
 
 unsigned long long DwgObjectReader::handleReference()
 {
-    return 0ULL;
+    return handleReference(0ULL);
+}
+
+unsigned long long DwgObjectReader::handleReference(unsigned long long handle)
+{
+    //Read the handle
+    unsigned long long value = _mergedReader->handleReference(handle);
+
+    if (value != 0 && _readedObjects.find(value) == _readedObjects.end())
+    {
+        //Add the value to the handles queue to be processed
+        _handles.push(value);
+    }
+
+    return value;
+}
+
+const std::vector<DwgObjectReader::ObjectReader> &DwgObjectReader::fixedObjectReaders()
+{
+    static const std::vector<ObjectReader> readers = [] {
+        std::vector<ObjectReader> table((std::size_t) ObjectType::ACAD_PROXY_OBJECT + 1);
+        auto set = [&table](ObjectType type, ObjectReadFn read) { table[(std::size_t) type].read = read; };
+
+        set(ObjectType::TEXT, &DwgObjectReader::readText);
+        set(ObjectType::ATTRIB, &DwgObjectReader::readAttribute);
+        set(ObjectType::ATTDEF, &DwgObjectReader::readAttributeDefinition);
+        set(ObjectType::BLOCK, &DwgObjectReader::readBlock);
+        set(ObjectType::ENDBLK, &DwgObjectReader::readEndBlock);
+        set(ObjectType::SEQEND, &DwgObjectReader::readSeqend);
+        set(ObjectType::INSERT, &DwgObjectReader::readInsert);
+        set(ObjectType::MINSERT, &DwgObjectReader::readMInsert);
+        set(ObjectType::VERTEX_2D, &DwgObjectReader::readVertex2D);
+        set(ObjectType::VERTEX_3D, &DwgObjectReader::readVertex<Vertex3D>);
+        set(ObjectType::VERTEX_MESH, &DwgObjectReader::readVertex<Vertex3D>);
+        set(ObjectType::VERTEX_PFACE, &DwgObjectReader::readVertex<VertexFaceMesh>);
+        set(ObjectType::VERTEX_PFACE_FACE, &DwgObjectReader::readPfaceVertex);
+        set(ObjectType::POLYLINE_2D, &DwgObjectReader::readPolyline2D);
+        set(ObjectType::POLYLINE_3D, &DwgObjectReader::readPolyline3D);
+        set(ObjectType::ARC, &DwgObjectReader::readArc);
+        set(ObjectType::CIRCLE, &DwgObjectReader::readCircle);
+        set(ObjectType::LINE, &DwgObjectReader::readLine);
+        set(ObjectType::DIMENSION_ORDINATE, &DwgObjectReader::readDimOrdinate);
+        set(ObjectType::DIMENSION_LINEAR, &DwgObjectReader::readDimLinear);
+        set(ObjectType::DIMENSION_ALIGNED, &DwgObjectReader::readDimAligned);
+        set(ObjectType::DIMENSION_ANG_3_Pt, &DwgObjectReader::readDimAngular3pt);
+        set(ObjectType::DIMENSION_ANG_2_Ln, &DwgObjectReader::readDimLine2pt);
+        set(ObjectType::DIMENSION_RADIUS, &DwgObjectReader::readDimRadius);
+        set(ObjectType::DIMENSION_DIAMETER, &DwgObjectReader::readDimDiameter);
+        set(ObjectType::POINT, &DwgObjectReader::readPoint);
+        set(ObjectType::FACE3D, &DwgObjectReader::read3dFace);
+        set(ObjectType::POLYLINE_PFACE, &DwgObjectReader::readPolyfaceMesh);
+        set(ObjectType::POLYLINE_MESH, &DwgObjectReader::readPolylineMesh);
+        set(ObjectType::SOLID, &DwgObjectReader::readSolid);
+        set(ObjectType::TRACE, &DwgObjectReader::readSolid);
+        set(ObjectType::SHAPE, &DwgObjectReader::readShape);
+        set(ObjectType::VIEWPORT, &DwgObjectReader::readViewport);
+        set(ObjectType::ELLIPSE, &DwgObjectReader::readEllipse);
+        set(ObjectType::SPLINE, &DwgObjectReader::readSpline);
+        set(ObjectType::RAY, &DwgObjectReader::readRay);
+        set(ObjectType::XLINE, &DwgObjectReader::readXLine);
+        set(ObjectType::DICTIONARY, &DwgObjectReader::readDictionary);
+        set(ObjectType::MTEXT, &DwgObjectReader::readMText);
+        set(ObjectType::LEADER, &DwgObjectReader::readLeader);
+        set(ObjectType::TOLERANCE, &DwgObjectReader::readTolerance);
+        set(ObjectType::MLINE, &DwgObjectReader::readMLine);
+        set(ObjectType::BLOCK_CONTROL_OBJ, &DwgObjectReader::readBlockControlObject);
+        set(ObjectType::BLOCK_HEADER, &DwgObjectReader::readBlockHeader);
+        set(ObjectType::LAYER_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<LayersTable>);
+        set(ObjectType::LAYER, &DwgObjectReader::readLayer);
+        set(ObjectType::STYLE_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<TextStylesTable>);
+        set(ObjectType::STYLE, &DwgObjectReader::readTextStyle);
+        set(ObjectType::LTYPE_CONTROL_OBJ, &DwgObjectReader::readLTypeControlObject);
+        set(ObjectType::LTYPE, &DwgObjectReader::readLType);
+        set(ObjectType::VIEW_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<ViewsTable>);
+        set(ObjectType::VIEW, &DwgObjectReader::readView);
+        set(ObjectType::UCS_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<UCSTable>);
+        set(ObjectType::UCS, &DwgObjectReader::readUcs);
+        set(ObjectType::VPORT_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<VPortsTable>);
+        set(ObjectType::VPORT, &DwgObjectReader::readVPort);
+        set(ObjectType::APPID_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<AppIdsTable>);
+        set(ObjectType::APPID, &DwgObjectReader::readAppId);
+        set(ObjectType::DIMSTYLE_CONTROL_OBJ, &DwgObjectReader::readDocumentTable<DimensionStylesTable>);
+        set(ObjectType::DIMSTYLE, &DwgObjectReader::readDimStyle);
+        set(ObjectType::VP_ENT_HDR_CTRL_OBJ, &DwgObjectReader::readViewportEntityControl);
+        set(ObjectType::VP_ENT_HDR, &DwgObjectReader::readViewportEntityHeader);
+        set(ObjectType::GROUP, &DwgObjectReader::readGroup);
+        set(ObjectType::MLINESTYLE, &DwgObjectReader::readMLineStyle);
+        set(ObjectType::LWPOLYLINE, &DwgObjectReader::readLWPolyline);
+        set(ObjectType::HATCH, &DwgObjectReader::readHatch);
+        set(ObjectType::XRECORD, &DwgObjectReader::readXRecord);
+        set(ObjectType::ACDBPLACEHOLDER, &DwgObjectReader::readPlaceHolder);
+        set(ObjectType::LAYOUT, &DwgObjectReader::readLayout);
+        return table;
+    }();
+    return readers;
+}
+
+DwgObjectReader::ObjectReadFn DwgObjectReader::classObjectReader(const std::string &dxfName)
+{
+    static const std::unordered_map<std::string, ObjectReadFn> readers = {
+            {"ACAD_EVALUATION_GRAPH", &DwgObjectReader::readEvaluationGraph},
+            {"ACDBDICTIONARYWDFLT", &DwgObjectReader::readDictionaryWithDefault},
+            {"ACDBPLACEHOLDER", &DwgObjectReader::readPlaceHolder},
+            {"BLOCKVISIBILITYPARAMETER", &DwgObjectReader::readBlockVisibilityParameter},
+            {"DBCOLOR", &DwgObjectReader::readDbColor},
+            {"DICTIONARYVAR", &DwgObjectReader::readDictionaryVar},
+            {"DICTIONARYWDFLT", &DwgObjectReader::readDictionaryWithDefault},
+            {"GEODATA", &DwgObjectReader::readGeoData},
+            {"GROUP", &DwgObjectReader::readGroup},
+            {"HATCH", &DwgObjectReader::readHatch},
+            {"IMAGE", &DwgObjectReader::readImage<RasterImage>},
+            {"IMAGEDEF", &DwgObjectReader::readImageDefinition},
+            {"IMAGEDEF_REACTOR", &DwgObjectReader::readImageDefinitionReactor},
+            {"LAYOUT", &DwgObjectReader::readLayout},
+            {"LWPLINE", &DwgObjectReader::readLWPolyline},
+            {"LWPOLYLINE", &DwgObjectReader::readLWPolyline},
+            {"MESH", &DwgObjectReader::readMesh},
+            {"MLEADERSTYLE", &DwgObjectReader::readMultiLeaderStyle},
+            {"MULTILEADER", &DwgObjectReader::readMultiLeader},
+            {"PDFDEFINITION", &DwgObjectReader::readPdfDefinition},
+            {"PDFUNDERLAY", &DwgObjectReader::readPdfUnderlay},
+            {"SCALE", &DwgObjectReader::readScale},
+            {"SORTENTSTABLE", &DwgObjectReader::readSortentsTable},
+            {"VISUALSTYLE", &DwgObjectReader::readVisualStyle},
+            {"WIPEOUT", &DwgObjectReader::readImage<Wipeout>},
+            {"XRECORD", &DwgObjectReader::readXRecord},
+    };
+
+    auto it = readers.find(dxfName);
+    return it != readers.end() ? it->second : nullptr;
+}
+
+void DwgObjectReader::buildObjectReaders(DxfClassCollection *classes)
+{
+    _objectReaders = fixedObjectReaders();
+    if (!classes)
+    {
+        return;
+    }
+
+    //The class names are resolved once here, objects only index the table by their type code
+    for (auto it = classes->begin(); it != classes->end(); ++it)
+    {
+        DxfClass *c = it->second;
+        if (!c || c->classNumber() < 0)
+        {
+            continue;
+        }
+
+        std::size_t index = (std::size_t) c->classNumber();
+        if (index >= _objectReaders.size())
+        {
+            _objectReaders.resize(index + 1);
+        }
+
+        ObjectReader &entry = _objectReaders[index];
+        entry.dxfClass = c;
+        entry.read = classObjectReader(c->dxfName());
+        if (!entry.read)
+        {
+            entry.readClass = c->isAnEntity() ? &DwgObjectReader::readUnknownEntity
+                                              : &DwgObjectReader::readUnknownNonGraphicalObject;
+        }
+    }
+}
+
+CadTemplate *DwgObjectReader::readObject(ObjectType type)
+{
+    if (type < ObjectType::UNDEFINED || (std::size_t) type >= _objectReaders.size())
+    {
+        return readUnlistedType((short) type);
+    }
+
+    const ObjectReader &entry = _objectReaders[(std::size_t) type];
+    if (entry.read)
+    {
+        return (this->*entry.read)();
+    }
+    if (entry.readClass)
+    {
+        return (this->*entry.readClass)(entry.dxfClass);
+    }
+    return readUnlistedType((short) type);
+}
+
+CadTemplate *DwgObjectReader::readUnlistedType(short)
+{
+    //Every class of the file has an entry in the table, what ends here is a fixed type without
+    //a decoder or a number that is not in the classes section, the caller skips the object
+    return nullptr;
+}
+
+template<typename T>
+CadTemplate *DwgObjectReader::readDocumentTable()
+{
+    return nullptr;
+}
+
+template<typename T>
+CadTemplate *DwgObjectReader::readVertex()
+{
+    return nullptr;
+}
+
+template<typename T>
+CadTemplate *DwgObjectReader::readImage()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readUnknownNonGraphicalObject(DxfClass *)
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDictionary()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readBlockControlObject()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readBlockHeader()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLayer()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readTextStyle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLTypeControlObject()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLType()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readView()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readUcs()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readVPort()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readAppId()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimStyle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readViewportEntityControl()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readViewportEntityHeader()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readGroup()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMLineStyle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readXRecord()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPlaceHolder()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLayout()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDictionaryWithDefault()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDbColor()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDictionaryVar()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readImageDefinition()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readImageDefinitionReactor()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMultiLeaderStyle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPdfDefinition()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readScale()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readSortentsTable()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readVisualStyle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readEvaluationGraph()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readBlockVisibilityParameter()
+{
+    return nullptr;
 }
 
-unsigned long long DwgObjectReader::handleReference(unsigned long long)
+CadTemplate *DwgObjectReader::readGeoData()
 {
-    return 0ULL;
+    return nullptr;
 }
 
 }// namespace dwg
\ No newline at end of file
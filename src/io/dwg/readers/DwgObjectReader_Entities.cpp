@@ -24,4 +24,219 @@
 
 namespace dwg {
 
-}
\ No newline at end of file
+CadTemplate *DwgObjectReader::readUnknownEntity(DxfClass *)
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readText()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readAttribute()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readAttributeDefinition()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readBlock()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readEndBlock()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readSeqend()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readInsert()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMInsert()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readVertex2D()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPfaceVertex()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPolyline2D()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPolyline3D()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readArc()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readCircle()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLine()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimOrdinate()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimLinear()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimAligned()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimAngular3pt()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimLine2pt()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimRadius()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readDimDiameter()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPoint()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::read3dFace()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPolyfaceMesh()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPolylineMesh()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readSolid()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readShape()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readViewport()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readEllipse()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readSpline()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readRay()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readXLine()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMText()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLeader()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readTolerance()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMLine()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readLWPolyline()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readHatch()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMultiLeader()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readMesh()
+{
+    return nullptr;
+}
+
+CadTemplate *DwgObjectReader::readPdfUnderlay()
+{
+    return nullptr;
+}
+
+}// namespace dwg
\ No newline at end of file
@@ -26,10 +26,34 @@
 #include <dwg/io/dwg/readers/DwgStreamReaderAC21_p.h>
 #include <dwg/io/dwg/readers/DwgStreamReaderAC24_p.h>
 #include <dwg/io/dwg/readers/DwgStreamReaderBase_p.h>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 namespace dwg {
 
+static double doubleFromLittleEndian(const unsigned char *bytes)
+{
+    unsigned char buffer[8];
+    std::memcpy(buffer, bytes, sizeof(buffer));
+    if constexpr (is_big_endian)
+    {
+        std::reverse(buffer, buffer + sizeof(buffer));
+    }
+    double value;
+    std::memcpy(&value, buffer, sizeof(value));
+    return value;
+}
+
+static void doubleToLittleEndian(double value, unsigned char *bytes)
+{
+    std::memcpy(bytes, &value, sizeof(value));
+    if constexpr (is_big_endian)
+    {
+        std::reverse(bytes, bytes + sizeof(value));
+    }
+}
+
 DwgStreamReaderBase::DwgStreamReaderBase(std::iostream *stream, bool resetPosition) : _stream(stream), _wrapper(_stream)
 {
     if (resetPosition)
@@ -100,7 +124,7 @@ void DwgStreamReaderBase::setEncoding(Encoding value)
 
 std::iostream *DwgStreamReaderBase::stream()
 {
-    return nullptr;
+    return _stream;
 }
 
 int DwgStreamReaderBase::bitShift() const
@@ -110,7 +134,7 @@ int DwgStreamReaderBase::bitShift() const
 
 long long DwgStreamReaderBase::position() const
 {
-    return 0LL;
+    return _wrapper.pos();
 }
 
 void DwgStreamReaderBase::setBitShift(int value)
@@ -118,7 +142,11 @@ void DwgStreamReaderBase::setBitShift(int value)
     _bitShift = value;
 }
 
-void DwgStreamReaderBase::setPosition(long long) {}
+void DwgStreamReaderBase::setPosition(long long value)
+{
+    _wrapper.seek(value);
+    _bitShift = 0;
+}
 
 bool DwgStreamReaderBase::isEmpty() const
 {
@@ -135,7 +163,7 @@ unsigned char DwgStreamReaderBase::readByte()
     if (bitShift() == 0)
     {
         // No need to apply the shift
-        _lastByte = _wrapper.readByte();
+        _lastByte = nextByte();
 
         return _lastByte;
     }
@@ -143,14 +171,16 @@ unsigned char DwgStreamReaderBase::readByte()
     // Get the last bits from the last readed byte
     unsigned char lastValues = (unsigned char) ((unsigned int) _lastByte << bitShift());
 
-    _lastByte = _wrapper.readByte();
+    _lastByte = nextByte();
 
     return (unsigned char) (lastValues | (unsigned int) (unsigned char) ((unsigned int) _lastByte >> 8 - bitShift()));
 }
 
 short DwgStreamReaderBase::readShort()
 {
-    return _wrapper.readShort();
+    unsigned char arr[2];
+    applyShiftToArr(2, arr);
+    return (short) (arr[0] | (arr[1] << 8));
 }
 
 long long DwgStreamReaderBase::setPositionByFlag(long long position)
@@ -187,17 +217,53 @@ long long DwgStreamReaderBase::setPositionByFlag(long long position)
 
 int DwgStreamReaderBase::readInt()
 {
-    return _wrapper.readInt();
+    return nextLittleEndian<int>();
 }
 
 unsigned int DwgStreamReaderBase::readUInt()
 {
-    return _wrapper.readUInt();
+    return nextLittleEndian<unsigned int>();
 }
 
 double DwgStreamReaderBase::readDouble()
 {
-    return _wrapper.readDouble();
+    unsigned char arr[8];
+    applyShiftToArr(8, arr);
+    return doubleFromLittleEndian(arr);
+}
+
+unsigned char DwgStreamReaderBase::nextByte()
+{
+    //Take the byte straight from the buffer, going through the stream would
+    //build a sentry and resync the put pointer on every call
+    int value = _stream->rdbuf()->sbumpc();
+    if (value == std::char_traits<char>::eof())
+    {
+        throw std::runtime_error("Unexpected end of stream");
+    }
+    return (unsigned char) value;
+}
+
+void DwgStreamReaderBase::nextBytes(unsigned char *arr, int length)
+{
+    if (_stream->rdbuf()->sgetn(reinterpret_cast<char *>(arr), length) != length)
+    {
+        throw std::runtime_error("Unexpected end of stream");
+    }
+}
+
+template<typename T>
+T DwgStreamReaderBase::nextLittleEndian()
+{
+    unsigned char bytes[sizeof(T)];
+    nextBytes(bytes, sizeof(T));
+    if constexpr (is_big_endian)
+    {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
 }
 
 std::vector<unsigned char> DwgStreamReaderBase::readBytes(int length)
@@ -265,7 +331,7 @@ short DwgStreamReaderBase::readBitShort()
         case 0:
             {
                 //00 : A short (2 bytes) follows, little-endian order (LSB first)
-                value = _wrapper.readT<short, LittleEndianConverter>();
+                value = nextLittleEndian<short>();
                 break;
             }
         case 1:
@@ -312,7 +378,7 @@ int DwgStreamReaderBase::readBitLong()
         case 0:
             // 00 : A long (4 bytes) follows, little-endian order (LSB first)
             {
-                value = _wrapper.readT<int, LittleEndianConverter>();
+                value = nextLittleEndian<int>();
                 break;
             }
         case 1:
@@ -355,39 +421,22 @@ long long DwgStreamReaderBase::readBitLongLong()
 
 double DwgStreamReaderBase::readBitDouble()
 {
-    double value;
-    auto t = read2Bits();
-    switch (t)
-    {
-        case 0:
-            {
-                value = _wrapper.readT<double, LittleEndianConverter>();
-                break;
-            }
-        case 1:
-            {
-                value = 1.0;
-                break;
-            }
-        case 2:
-            {
-                value = 0.0;
-                break;
-            }
-        default:
-            throw std::runtime_error("");
-    }
-    return value;
+    return decodeBitDouble();
 }
 
 XY DwgStreamReaderBase::read2BitDouble()
 {
-    return XY(readBitDouble(), readBitDouble());
+    double x = decodeBitDouble();
+    double y = decodeBitDouble();
+    return XY(x, y);
 }
 
 XYZ DwgStreamReaderBase::read3BitDouble()
 {
-    return XYZ(readBitDouble(), readBitDouble(), readBitDouble());
+    double x = decodeBitDouble();
+    double y = decodeBitDouble();
+    double z = decodeBitDouble();
+    return XYZ(x, y, z);
 }
 
 char DwgStreamReaderBase::readRawChar()
@@ -397,12 +446,12 @@ char DwgStreamReaderBase::readRawChar()
 
 long long DwgStreamReaderBase::readRawLong()
 {
-    return _wrapper.readT<int, LittleEndianConverter>();
+    return nextLittleEndian<int>();
 }
 
 unsigned long long DwgStreamReaderBase::readRawULong()
 {
-    return _wrapper.readT<unsigned long long, LittleEndianConverter>();
+    return nextLittleEndian<unsigned long long>();
 }
 
 XY DwgStreamReaderBase::read2RawDouble()
@@ -595,14 +644,67 @@ std::vector<unsigned char> DwgStreamReaderBase::readSentinel()
     return std::vector<unsigned char>();
 }
 
-XY DwgStreamReaderBase::read2BitDoubleWithDefault(const XY &)
+XY DwgStreamReaderBase::read2BitDoubleWithDefault(const XY &defValue)
 {
-    return XY(0, 0);
+    double x = decodeBitDoubleWithDefault(defValue.X);
+    double y = decodeBitDoubleWithDefault(defValue.Y);
+    return XY(x, y);
 }
 
-XYZ DwgStreamReaderBase::read3BitDoubleWithDefault(const XYZ &)
+XYZ DwgStreamReaderBase::read3BitDoubleWithDefault(const XYZ &defValue)
 {
-    return XYZ(0, 0, 0);
+    double x = decodeBitDoubleWithDefault(defValue.X);
+    double y = decodeBitDoubleWithDefault(defValue.Y);
+    double z = decodeBitDoubleWithDefault(defValue.Z);
+    return XYZ(x, y, z);
+}
+
+void DwgStreamReaderBase::read2BitDoubles(XY *points, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        points[i].X = decodeBitDouble();
+        points[i].Y = decodeBitDouble();
+    }
+}
+
+void DwgStreamReaderBase::read3BitDoubles(XYZ *points, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        points[i].X = decodeBitDouble();
+        points[i].Y = decodeBitDouble();
+        points[i].Z = decodeBitDouble();
+    }
+}
+
+void DwgStreamReaderBase::read2BitDoublesWithDefault(XY *points, std::size_t count, const XY &defValue)
+{
+    double x = defValue.X;
+    double y = defValue.Y;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        x = decodeBitDoubleWithDefault(x);
+        y = decodeBitDoubleWithDefault(y);
+        points[i].X = x;
+        points[i].Y = y;
+    }
+}
+
+void DwgStreamReaderBase::read3BitDoublesWithDefault(XYZ *points, std::size_t count, const XYZ &defValue)
+{
+    double x = defValue.X;
+    double y = defValue.Y;
+    double z = defValue.Z;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        x = decodeBitDoubleWithDefault(x);
+        y = decodeBitDoubleWithDefault(y);
+        z = decodeBitDoubleWithDefault(z);
+        points[i].X = x;
+        points[i].Y = y;
+        points[i].Z = z;
+    }
 }
 
 Color DwgStreamReaderBase::readCmColor()
@@ -622,7 +724,7 @@ Color DwgStreamReaderBase::readColorByIndex()
 
 ObjectType DwgStreamReaderBase::readObjectType()
 {
-    return ObjectType::UNLISTED;
+    return (ObjectType) readBitShort();
 }
 
 XYZ DwgStreamReaderBase::readBitExtrusion()
@@ -631,9 +733,167 @@ XYZ DwgStreamReaderBase::readBitExtrusion()
 }
 
 double DwgStreamReaderBase::readBitDoubleWithDefault(double def)
+{
+    return decodeBitDoubleWithDefault(def);
+}
+
+double DwgStreamReaderBase::readBitThickness()
+{
+    return readBitDouble();
+}
+
+DateTime DwgStreamReaderBase::read8BitJulianDate()
+{
+    return julianToDate(readInt(), readInt());
+}
+
+DateTime DwgStreamReaderBase::readDateTime()
+{
+    return julianToDate(readBitLong(), readBitLong());
+}
+
+Timespan DwgStreamReaderBase::readTimeSpan()
+{
+    return Timespan();
+}
+
+long long DwgStreamReaderBase::positionInBits()
+{
+    long long bitPosition = position() * 8LL;
+    if (_bitShift > 0)
+    {
+        bitPosition += _bitShift - 8;
+    }
+    return bitPosition;
+}
+
+void DwgStreamReaderBase::setPositionInBits(long long positon)
+{
+    setPosition(positon >> 3);
+    _bitShift = (int) (positon & 7);
+    if (_bitShift > 0)
+    {
+        advanceByte();
+    }
+}
+
+void DwgStreamReaderBase::advanceByte()
+{
+    _lastByte = nextByte();
+}
+
+void DwgStreamReaderBase::advance(int offset)
+{
+    if (offset > 1)
+        _wrapper.seek(offset - 1 + _wrapper.pos());
+
+    readByte();
+}
+
+unsigned short DwgStreamReaderBase::resetShift()
+{
+    if ((unsigned int) bitShift() > 0U)
+        setBitShift(0);
+
+    advanceByte();
+    unsigned short num = _lastByte;
+    advanceByte();
+
+    return (unsigned short) (num | (unsigned int) (unsigned short) ((unsigned int) _lastByte << 8));
+}
+
+std::string DwgStreamReaderBase::readString(size_t length, Encoding encoding)
+{
+    if (length == 0)
+        return std::string();
+
+    std::vector<unsigned char> numArray = readBytes(length);
+    return _encoding.toUtf8(reinterpret_cast<const char *>(numArray.data()));
+}
+
+void DwgStreamReaderBase::applyFlagToPosition(long long lastPos, long long &length, long long &strDataSize)
+{
+    //If 1, then the "endbit" location should be decremented by 16 bytes
+    length = lastPos - 16LL;
+    setPositionInBits(length);
+
+    //short should be read at location endbit - 128 (bits)
+    strDataSize = (unsigned short) readShort();
+
+    //If this short has the 0x8000 bit set,
+    //then decrement endbit by an additional 16 bytes,
+    //strip the 0x8000 bit off of strDataSize, and read
+    //the short at this new location, calling it hiSize.
+    if ((strDataSize & 0x8000) > 0)
+    {
+        length -= 16LL;
+        setPositionInBits(length);
+
+        strDataSize &= 0x7FFF;
+        unsigned short hiSize = (unsigned short) readShort();
+        //Then set strDataSize to (strDataSize | (hiSize << 15))
+        strDataSize += (long long) hiSize << 15;
+    }
+}
+
+unsigned char DwgStreamReaderBase::applyShiftToLasByte()
+{
+    unsigned char value = (unsigned char) ((unsigned int) _lastByte << bitShift());
+
+    advanceByte();
+
+    return (unsigned char) (value | (unsigned int) (unsigned char) ((unsigned int) _lastByte >> 8 - bitShift()));
+}
+
+void DwgStreamReaderBase::applyShiftToArr(int length, std::vector<unsigned char> &arr)
+{
+    applyShiftToArr(length, arr.data());
+}
+
+void DwgStreamReaderBase::applyShiftToArr(int length, unsigned char *arr)
+{
+    nextBytes(arr, length);
+
+    if (bitShift() > 0)
+    {
+        int shift = 8 - bitShift();
+        for (int i = 0; i < length; ++i)
+        {
+            unsigned char lastByteValue = (unsigned char) ((unsigned int) _lastByte << bitShift());
+            _lastByte = arr[i];
+            arr[i] = (unsigned char) (lastByteValue | (unsigned int) (unsigned char) ((unsigned int) _lastByte >> shift));
+        }
+    }
+}
+
+unsigned char DwgStreamReaderBase::read3bits()
+{
+    return 0;
+}
+
+double DwgStreamReaderBase::decodeBitDouble()
+{
+    switch (read2Bits())
+    {
+        //00 A double follows
+        case 0:
+            return readDouble();
+        //01 1.0
+        case 1:
+            return 1.0;
+        //10 0.0
+        case 2:
+            return 0.0;
+        default:
+            throw std::runtime_error("Failed to read BitDouble");
+    }
+}
+
+double DwgStreamReaderBase::decodeBitDoubleWithDefault(double def)
 {
     //Get the bytes form the default value
-    std::vector<unsigned char> arr = LittleEndianConverter::instance()->bytes(def);
+    unsigned char arr[8];
+    doubleToLittleEndian(def, arr);
 
     switch (read2Bits())
     {
@@ -670,7 +930,7 @@ double DwgStreamReaderBase::readBitDoubleWithDefault(double def)
                 advanceByte();
                 arr[3] |= (unsigned char) ((unsigned int) _lastByte >> shift);
             }
-            return LittleEndianConverter::instance()->toDouble(arr.data());
+            return doubleFromLittleEndian(arr);
         //10 6 bytes of data are present. The result is the default double, with the first 2 data bytes patched in
         //replacing bytes 5 and 6 of the default double, and the last 4 data bytes patched in replacing the first 4
         //bytes of the default double(assuming little endian).
@@ -711,7 +971,7 @@ double DwgStreamReaderBase::readBitDoubleWithDefault(double def)
                 advanceByte();
                 arr[3] |= (unsigned char) ((unsigned int) _lastByte >> 8 - bitShift());
             }
-            return LittleEndianConverter::instance()->toDouble(arr.data());
+            return doubleFromLittleEndian(arr);
         //11 A full RD follows.
         case 3:
             return readDouble();
@@ -720,81 +980,6 @@ double DwgStreamReaderBase::readBitDoubleWithDefault(double def)
     }
 }
 
-double DwgStreamReaderBase::readBitThickness()
-{
-    return readBitDouble();
-}
-
-DateTime DwgStreamReaderBase::read8BitJulianDate()
-{
-    return julianToDate(readInt(), readInt());
-}
-
-DateTime DwgStreamReaderBase::readDateTime()
-{
-    return julianToDate(readBitLong(), readBitLong());
-}
-
-Timespan DwgStreamReaderBase::readTimeSpan()
-{
-    return Timespan();
-}
-
-long long DwgStreamReaderBase::positionInBits()
-{
-    return 0LL;
-}
-
-void DwgStreamReaderBase::setPositionInBits(long long positon) {}
-
-void DwgStreamReaderBase::advanceByte()
-{
-    _lastByte = _wrapper.readByte();
-}
-
-void DwgStreamReaderBase::advance(int offset)
-{
-    if (offset > 1)
-        _wrapper.seek(offset - 1 + _wrapper.pos());
-
-    readByte();
-}
-
-unsigned short DwgStreamReaderBase::resetShift()
-{
-    if ((unsigned int) bitShift() > 0U)
-        setBitShift(0);
-
-    advanceByte();
-    unsigned short num = _lastByte;
-    advanceByte();
-
-    return (unsigned short) (num | (unsigned int) (unsigned short) ((unsigned int) _lastByte << 8));
-}
-
-std::string DwgStreamReaderBase::readString(size_t length, Encoding encoding)
-{
-    if (length == 0)
-        return std::string();
-
-    std::vector<unsigned char> numArray = readBytes(length);
-    return _encoding.toUtf8(reinterpret_cast<const char *>(numArray.data()));
-}
-
-void DwgStreamReaderBase::applyFlagToPosition(long long lastPos, long long &length, long long &strDataSize) {}
-
-unsigned char DwgStreamReaderBase::applyShiftToLasByte()
-{
-    return 0;
-}
-
-void DwgStreamReaderBase::applyShiftToArr(int length, std::vector<unsigned char> &arr) {}
-
-unsigned char DwgStreamReaderBase::read3bits()
-{
-    return 0;
-}
-
 DateTime DwgStreamReaderBase::julianToDate(int jdata, int miliseconds)
 {
     return DateTime();
@@ -27,6 +27,7 @@
 #include <dwg/entities/Insert.h>
 #include <dwg/entities/collection/EntityCollection.h>
 #include <dwg/header/CadHeader.h>
+#include <dwg/io/dwg/DwgVersionTag_p.h>
 #include <dwg/io/dwg/fileheaders/DwgSectionDefinition_p.h>
 #include <dwg/io/dwg/writers/DwgObjectWriter_p.h>
 #include <dwg/io/dwg/writers/IDwgStreamWriter_p.h>
@@ -60,11 +61,18 @@ std::string DwgObjectWriter::sectionName() const
     return DwgSectionDefinition::AcDbObjects;
 }
 
+void DwgObjectWriter::write()
+{
+    //Resolve the version once for the section, the table and block encoders are specialized for it
+    dispatchDwgVersion(_version, [this](auto tag) { write<decltype(tag)>(); });
+}
+
+template<typename V>
 void DwgObjectWriter::write()
 {
     //For R18 and later the section data (right after the page header) starts with a
     //RL value of 0x0dca (meaning unknown).
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         std::vector<unsigned char> arr = LittleEndianConverter::instance()->bytes((int) 0xDCA);
         _stream->write(reinterpret_cast<const char *>(arr.data()), arr.size());
@@ -72,18 +80,18 @@ void DwgObjectWriter::write()
 
     _objects.push(_document->rootDictionary());
 
-    writeBlockControl();
-    writeLayers(_document->layers());
-    writeTextStyles(_document->textStyles());
-    writeLTypeControlObject();
-    writeViews(_document->views());
-    writeUCSs(_document->UCSs());
-    writeVPorts(_document->vports());
-    writeAppIds(_document->appIds());
+    writeBlockControl<V>();
+    writeLayers<V>(_document->layers());
+    writeTextStyles<V>(_document->textStyles());
+    writeLTypeControlObject<V>();
+    writeViews<V>(_document->views());
+    writeUCSs<V>(_document->UCSs());
+    writeVPorts<V>(_document->vports());
+    writeAppIds<V>(_document->appIds());
     //For some reason the dimension must be writen the last
-    writeDimensionStyles(_document->dimensionStyles());
+    writeDimensionStyles<V>(_document->dimensionStyles());
 
-    writeBlockEntities();
+    writeBlockEntities<V>();
     writeObjects();
 }
 
@@ -102,37 +110,49 @@ bool DwgObjectWriter::writeXData() const
     return false;
 }
 
+template<typename V>
 void DwgObjectWriter::writeLTypeControlObject() {}
 
+template<typename V>
 void DwgObjectWriter::writeBlockControl() {}
 
+template<typename V>
 void DwgObjectWriter::writeLayers(LayersTable *layers) {}
 
+template<typename V>
 void DwgObjectWriter::writeTextStyles(TextStylesTable *textStyles) {}
 
+template<typename V>
 void DwgObjectWriter::writeViews(ViewsTable *views) {}
 
+template<typename V>
 void DwgObjectWriter::writeUCSs(UCSTable *ucss) {}
 
+template<typename V>
 void DwgObjectWriter::writeVPorts(VPortsTable *vports) {}
 
+template<typename V>
 void DwgObjectWriter::writeAppIds(AppIdsTable *appids) {}
 
+template<typename V>
 void DwgObjectWriter::writeDimensionStyles(DimensionStylesTable *dimStyles) {}
 
+template<typename V>
 void DwgObjectWriter::writeEntries() {}
 
+template<typename V>
 void DwgObjectWriter::writeBlockEntities() {}
 
+template<typename V>
 void DwgObjectWriter::writeAppId(AppId *app)
 {
-    writeCommonNonEntityData(app);
+    writeCommonNonEntityData<V>(app);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(app->name());
 
-    writeXrefDependantBit(app);
+    writeXrefDependantBit<V>(app);
 
     //Unknown RC 71 Undoc'd 71-group; doesn't even appear in DXF or an entget if it's 0.
     _writer->writeByte(0);
@@ -140,17 +160,19 @@ void DwgObjectWriter::writeAppId(AppId *app)
     //External reference block handle(hard pointer)	??
     _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
 
-    registerObject(app);
+    registerObject<V>(app);
 }
 
+template<typename V>
 void DwgObjectWriter::writeBlockRecord(BlockRecord *blkRecord)
 {
-    writeBlockHeader(blkRecord);
+    writeBlockHeader<V>(blkRecord);
 }
 
+template<typename V>
 void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
 {
-    writeCommonNonEntityData(record);
+    writeCommonNonEntityData<V>(record);
 
     //Common:
     //Entry name TV 2
@@ -164,7 +186,7 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
         _writer->writeVariableText(record->name());
     }
 
-    writeXrefDependantBit(record);
+    writeXrefDependantBit<V>(record);
 
     //Anonymous B 1 if this is an anonymous block (1 bit)
     _writer->writeBit(record->flags() & BlockTypeFlag::Anonymous);
@@ -179,17 +201,20 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
     _writer->writeBit(record->flags() & BlockTypeFlag::XRefOverlay);
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Loaded Bit B 0 indicates loaded for an xref
         _writer->writeBit(record->flags() & BlockTypeFlag::XRef);
     }
 
     //R2004+:
-    if ((R2004Plus && !(record->flags() & BlockTypeFlag::XRef)) && !(record->flags() & BlockTypeFlag::XRefOverlay))
+    if constexpr (V::R2004Plus)
     {
-        //Owned Object Count BL Number of objects owned by this object.
-        _writer->writeBitLong(record->entities()->size());
+        if (!(record->flags() & BlockTypeFlag::XRef) && !(record->flags() & BlockTypeFlag::XRefOverlay))
+        {
+            //Owned Object Count BL Number of objects owned by this object.
+            _writer->writeBitLong(record->entities()->size());
+        }
     }
 
     //Common:
@@ -200,13 +225,13 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
     _writer->writeVariableText(record->blockEntity()->xrefPath());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Insert Count RC A sequence of zero or more non-zero RC's, followed by a terminating 0 RC.The total number of these indicates how many insert handles will be present.
         for (auto item = record->entities()->begin(); item != record->entities()->end(); ++item)
         {
-            auto insert = dynamic_cast<Insert *>(*item);
-            if (insert && insert->block()->name() == record->name())
+            auto insert = object_cast<Insert>(*item);
+            if (insert && insert->block()->sameName(record))
             {
                 _writer->writeByte(1);
             }
@@ -222,7 +247,7 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Insert units BS 70
         _writer->writeBitShort((short) record->units());
@@ -239,25 +264,27 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
     _writer->handleReference(DwgReferenceType::HardOwnership, record->blockEntity());
 
     //R13-R2000:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1015 &&
-        !(record->flags() & BlockTypeFlag::XRef) && !(record->flags() & BlockTypeFlag::XRefOverlay))
+    if constexpr (V::R13_15Only)
     {
-        if (!record->entities()->empty())
-        {
-            //first entity in the def. (soft pointer)
-            _writer->handleReference(DwgReferenceType::SoftPointer, record->entities()->front());
-            //last entity in the def. (soft pointer)
-            _writer->handleReference(DwgReferenceType::SoftPointer, record->entities()->back());
-        }
-        else
+        if (!(record->flags() & BlockTypeFlag::XRef) && !(record->flags() & BlockTypeFlag::XRefOverlay))
         {
-            _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
-            _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
+            if (!record->entities()->empty())
+            {
+                //first entity in the def. (soft pointer)
+                _writer->handleReference(DwgReferenceType::SoftPointer, record->entities()->front());
+                //last entity in the def. (soft pointer)
+                _writer->handleReference(DwgReferenceType::SoftPointer, record->entities()->back());
+            }
+            else
+            {
+                _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
+                _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
+            }
         }
     }
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         for (auto it = record->entities()->begin(); it != record->entities()->end(); ++it)
         {
@@ -271,12 +298,12 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
     _writer->handleReference(DwgReferenceType::HardOwnership, record->blockEnd());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         for (auto item = record->entities()->begin(); item != record->entities()->end(); ++item)
         {
-            auto insert = dynamic_cast<Insert *>(*item);
-            if (insert && insert->block()->name() == record->name())
+            auto insert = object_cast<Insert>(*item);
+            if (insert && insert->block()->sameName(record))
             {
                 _writer->handleReference(DwgReferenceType::SoftPointer, *item);
             }
@@ -286,39 +313,42 @@ void DwgObjectWriter::writeBlockHeader(BlockRecord *record)
         _writer->handleReference(DwgReferenceType::HardPointer, record->layout());
     }
 
-    registerObject(record);
+    registerObject<V>(record);
 }
 
+template<typename V>
 void DwgObjectWriter::writeBlockBegin(Block *block)
 {
-    writeCommonEntityData(block);
+    writeCommonEntityData<V>(block);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(block->name());
 
-    registerObject(block);
+    registerObject<V>(block);
 }
 
+template<typename V>
 void DwgObjectWriter::writeBlockEnd(BlockEnd *blkEnd)
 {
-    writeCommonEntityData(blkEnd);
+    writeCommonEntityData<V>(blkEnd);
 
-    registerObject(blkEnd);
+    registerObject<V>(blkEnd);
 }
 
+template<typename V>
 void DwgObjectWriter::writeLayer(Layer *layer)
 {
-    writeCommonNonEntityData(layer);
+    writeCommonNonEntityData<V>(layer);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(layer->name());
 
-    writeXrefDependantBit(layer);
+    writeXrefDependantBit<V>(layer);
 
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //Frozen B 70 if frozen (1 bit)
         _writer->writeBit(layer->flags() & LayerFlag::Frozen);
@@ -331,7 +361,7 @@ void DwgObjectWriter::writeLayer(Layer *layer)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //and lineweight (mask with 0x03E0)
         short values = (short) (CadUtils::ToIndex(layer->lineWeight()) << 5);
@@ -368,14 +398,14 @@ void DwgObjectWriter::writeLayer(Layer *layer)
     _writer->handleReference(DwgReferenceType::HardPointer, nullptr);
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //H 390 Plotstyle (hard pointer), by default points to PLACEHOLDER with handle 0x0f.
         _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //H 347 Material
         _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
@@ -385,24 +415,25 @@ void DwgObjectWriter::writeLayer(Layer *layer)
     //H 6 linetype (hard pointer)
     _writer->handleReference(DwgReferenceType::HardPointer, layer->lineType()->handle());
 
-    if (R2013Plus)
+    if constexpr (V::R2013Plus)
     {
         //H Unknown handle (hard pointer). Always seems to be NULL.
         _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
     }
 
-    registerObject(layer);
+    registerObject<V>(layer);
 }
 
+template<typename V>
 void DwgObjectWriter::writeLineType(LineType *ltype)
 {
-    writeCommonNonEntityData(ltype);
+    writeCommonNonEntityData<V>(ltype);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(ltype->name());
 
-    writeXrefDependantBit(ltype);
+    writeXrefDependantBit<V>(ltype);
 
     //Description TV 3
     _writer->writeVariableText(ltype->description());
@@ -438,7 +469,7 @@ void DwgObjectWriter::writeLineType(LineType *ltype)
     }
 
     //R2004 and earlier:
-    if (_version <= ACadVersion::AC1018)
+    if constexpr (V::version <= ACadVersion::AC1018)
     {
         //Strings area X 9 256 bytes of text area. The complex dashes that have text use this area via the 75-group indices. It's basically a pile of 0-terminated strings.
         //First unsigned char is always 0 for R13 and data starts at unsigned char 1.
@@ -452,12 +483,15 @@ void DwgObjectWriter::writeLineType(LineType *ltype)
     }
 
     //R2007+:
-    if (R2007Plus && isText)
+    if constexpr (V::R2007Plus)
     {
-        for (int i = 0; i < 512; i++)
+        if (isText)
         {
-            //TODO: Write the line type text area
-            _writer->writeByte(0);
+            for (int i = 0; i < 512; i++)
+            {
+                //TODO: Write the line type text area
+                _writer->writeByte(0);
+            }
         }
     }
 
@@ -471,12 +505,13 @@ void DwgObjectWriter::writeLineType(LineType *ltype)
         _writer->handleReference(DwgReferenceType::HardPointer, segment.style);
     }
 
-    registerObject(ltype);
+    registerObject<V>(ltype);
 }
 
+template<typename V>
 void DwgObjectWriter::writeTextStyle(TextStyle *style)
 {
-    writeCommonNonEntityData(style);
+    writeCommonNonEntityData<V>(style);
 
     //Common:
     //Entry name TV 2
@@ -489,7 +524,7 @@ void DwgObjectWriter::writeTextStyle(TextStyle *style)
         _writer->writeVariableText(style->name());
     }
 
-    writeXrefDependantBit(style);
+    writeXrefDependantBit<V>(style);
 
     //shape file B 1 if a shape file rather than a font (1 bit)
     _writer->writeBit(style->flags().testFlag(StyleFlag::IsShape));
@@ -513,18 +548,19 @@ void DwgObjectWriter::writeTextStyle(TextStyle *style)
 
     _writer->handleReference(DwgReferenceType::HardPointer, _document->textStyles());
 
-    registerObject(style);
+    registerObject<V>(style);
 }
 
+template<typename V>
 void DwgObjectWriter::writeUCS(UCS *ucs)
 {
-    writeCommonNonEntityData(ucs);
+    writeCommonNonEntityData<V>(ucs);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(ucs->name());
 
-    writeXrefDependantBit(ucs);
+    writeXrefDependantBit<V>(ucs);
 
     //Origin 3BD 10
     _writer->write3BitDouble(ucs->origin());
@@ -534,7 +570,7 @@ void DwgObjectWriter::writeUCS(UCS *ucs)
     _writer->write3BitDouble(ucs->yAxis());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Elevation BD 146
         _writer->writeBitDouble(ucs->elevation());
@@ -549,7 +585,7 @@ void DwgObjectWriter::writeUCS(UCS *ucs)
     _writer->handleReference(DwgReferenceType::SoftPointer, _document->UCSs());
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Base UCS Handle H 346 hard pointer
         _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
@@ -557,18 +593,19 @@ void DwgObjectWriter::writeUCS(UCS *ucs)
         _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
     }
 
-    registerObject(ucs);
+    registerObject<V>(ucs);
 }
 
+template<typename V>
 void DwgObjectWriter::writeView(View *view)
 {
-    writeCommonNonEntityData(view);
+    writeCommonNonEntityData<V>(view);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(view->name());
 
-    writeXrefDependantBit(view);
+    writeXrefDependantBit<V>(view);
 
     //View height BD 40
     _writer->writeBitDouble(view->height());
@@ -601,14 +638,14 @@ void DwgObjectWriter::writeView(View *view)
     _writer->writeBit(view->viewMode().testFlag(ViewModeType::FrontClippingZ));
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Render Mode RC 281
         _writer->writeByte((unsigned char) view->renderMode());
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Use default lights B ? Default value is true
         _writer->writeBit(true);
@@ -626,7 +663,7 @@ void DwgObjectWriter::writeView(View *view)
     //Pspace flag B 70 Bit 0(1) of the 70 - group.
     _writer->writeBit(view->flags().testFlag((StandardFlag) 0b1));
 
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         _writer->writeBit(view->isUcsAssociated());
         if (view->isUcsAssociated())
@@ -649,7 +686,7 @@ void DwgObjectWriter::writeView(View *view)
     _writer->handleReference(DwgReferenceType::SoftPointer, _document->views());
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Camera plottable B 73
         _writer->writeBit(view->isPlottable());
@@ -662,37 +699,41 @@ void DwgObjectWriter::writeView(View *view)
         _writer->handleReference(DwgReferenceType::HardOwnership, 0ULL);
     }
 
-    if (R2000Plus && view->isUcsAssociated())
+    if constexpr (V::R2000Plus)
     {
-        //TODO: Implement ucs reference for view
-        //Base UCS Handle H 346 hard pointer
-        _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
-        //Named UCS Handle H 345 hard pointer
-        _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
+        if (view->isUcsAssociated())
+        {
+            //TODO: Implement ucs reference for view
+            //Base UCS Handle H 346 hard pointer
+            _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
+            //Named UCS Handle H 345 hard pointer
+            _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
+        }
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Live section H 334 soft pointer
         _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
     }
 
-    registerObject(view);
+    registerObject<V>(view);
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
 {
-    writeCommonNonEntityData(dimStyle);
+    writeCommonNonEntityData<V>(dimStyle);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(dimStyle->name());
 
-    writeXrefDependantBit(dimStyle);
+    writeXrefDependantBit<V>(dimStyle);
 
     //R13 & R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //DIMTOL B 71
         _writer->writeBit(dimStyle->generateTolerances());
@@ -808,7 +849,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //DIMPOST TV 3
         _writer->writeVariableText(dimStyle->postFix());
@@ -835,7 +876,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //DIMFXL BD 49
         _writer->writeBitDouble(dimStyle->fixedExtensionLineLength());
@@ -848,7 +889,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //DIMTOL B 71
         _writer->writeBit(dimStyle->generateTolerances());
@@ -871,14 +912,14 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //DIMARCSYM BS 90
         _writer->writeBitShort((short) dimStyle->arcLengthSymbolPosition());
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //DIMTXT BD 140
         _writer->writeBitDouble(dimStyle->textHeight());
@@ -957,14 +998,14 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //DIMFXLON B 290
         _writer->writeBit(dimStyle->isExtensionLineLengthFixed());
     }
 
     //R2010+:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //DIMTXTDIRECTION B 295
         _writer->writeBit(dimStyle->textDirection() == TextDirection::RightToLeft);
@@ -979,7 +1020,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //DIMLWD BS 371
         _writer->writeBitShort((short) dimStyle->dimensionLineWeight());
@@ -1002,7 +1043,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     _writer->handleReference(DwgReferenceType::HardPointer, dimStyle->style());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //341 leader block(DIMLDRBLK) (hard pointer)
         _writer->handleReference(DwgReferenceType::HardPointer, dimStyle->leaderArrow());
@@ -1015,7 +1056,7 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //345 dimltype(hard pointer)
         _writer->handleReference(DwgReferenceType::HardPointer, dimStyle->lineType());
@@ -1025,18 +1066,19 @@ void DwgObjectWriter::writeDimensionStyle(DimensionStyle *dimStyle)
         _writer->handleReference(DwgReferenceType::HardPointer, dimStyle->lineTypeExt2());
     }
 
-    registerObject(dimStyle);
+    registerObject<V>(dimStyle);
 }
 
+template<typename V>
 void DwgObjectWriter::writeVPort(VPort *vport)
 {
-    writeCommonNonEntityData(vport);
+    writeCommonNonEntityData<V>(vport);
 
     //Common:
     //Entry name TV 2
     _writer->writeVariableText(vport->name());
 
-    writeXrefDependantBit(vport);
+    writeXrefDependantBit<V>(vport);
 
     //View height BD 40
     _writer->writeBitDouble(vport->viewHeight());
@@ -1072,14 +1114,14 @@ void DwgObjectWriter::writeVPort(VPort *vport)
     _writer->writeBit(vport->viewMode().testFlag(ViewModeType::FrontClippingZ));
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Render Mode RC 281
         _writer->writeByte((unsigned char) vport->renderMode());
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Use default lights B 292
         _writer->writeBit(vport->useDefaultLighting());
@@ -1135,7 +1177,7 @@ void DwgObjectWriter::writeVPort(VPort *vport)
     _writer->write2RawDouble(vport->snapSpacing());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Unknown B
         _writer->writeBit(false);
@@ -1155,7 +1197,7 @@ void DwgObjectWriter::writeVPort(VPort *vport)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Grid flags BS 60
         _writer->writeBitShort((short) vport->gridFlags());
@@ -1168,7 +1210,7 @@ void DwgObjectWriter::writeVPort(VPort *vport)
     _writer->handleReference(DwgReferenceType::HardPointer, 0ULL);
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Background handle H 332 soft pointer
         _writer->handleReference(DwgReferenceType::SoftPointer, 0ULL);
@@ -1179,7 +1221,7 @@ void DwgObjectWriter::writeVPort(VPort *vport)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         if (vport->orthographicType() == OrthographicType::None)
         {
@@ -1197,7 +1239,7 @@ void DwgObjectWriter::writeVPort(VPort *vport)
         }
     }
 
-    registerObject(vport);
+    registerObject<V>(vport);
 }
 
 }// namespace dwg
\ No newline at end of file
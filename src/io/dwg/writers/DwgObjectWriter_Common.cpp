@@ -27,6 +27,7 @@
 #include <dwg/classes/DxfClassCollection.h>
 #include <dwg/entities/Entity.h>
 #include <dwg/io/dwg/CRC8StreamHandler_p.h>
+#include <dwg/io/dwg/DwgVersionTag_p.h>
 #include <dwg/io/dwg/writers/DwgObjectWriter_p.h>
 #include <dwg/io/dwg/writers/IDwgStreamWriter_p.h>
 #include <dwg/objects/BookColor.h>
@@ -45,9 +46,11 @@
 #include <fmt/core.h>
 #include <fstream>
 #include <stdexcept>
+#include <utility>
 
 namespace dwg {
 
+template<typename V>
 void DwgObjectWriter::registerObject(CadObject *cadObject)
 {
     _writer->writeSpearShift();
@@ -63,7 +66,7 @@ void DwgObjectWriter::registerObject(CadObject *cadObject)
     writeSize(&crc, size);
 
     //R2010+:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //MC : Size in bits of the handle stream (unsigned, 0x40 is not interpreted as sign).
         //This includes the padding bits at the end of the handle stream
@@ -123,9 +126,10 @@ void DwgObjectWriter::writeSizeInBits(CRC8StreamHandler *stream, unsigned long l
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeXrefDependantBit(TableEntry *entry)
 {
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //xrefindex+1 BS 70 subtract one from this value when read.
         //After that, -1 indicates that this reference did not come from an xref,
@@ -147,6 +151,7 @@ void DwgObjectWriter::writeXrefDependantBit(TableEntry *entry)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeCommonData(CadObject *cadObject)
 {
     //Reset the current stream to re-write a new object in it
@@ -156,7 +161,7 @@ void DwgObjectWriter::writeCommonData(CadObject *cadObject)
     {
         case ObjectType::UNLISTED:
             {
-                DxfClass *dxfClass = _document->classes()->getByName(cadObject->objectName());
+                DxfClass *dxfClass = _document->classes()->getByName(std::string(cadObject->objectName()));
                 if (dxfClass)
                 {
                     _writer->writeObjectType(dxfClass->classNumber());
@@ -181,7 +186,7 @@ void DwgObjectWriter::writeCommonData(CadObject *cadObject)
             break;
     }
 
-    if (_version >= ACadVersion::AC1015 && _version < ACadVersion::AC1024)
+    if constexpr (V::R2000Plus && !V::R2010Plus)
         //Obj size RL size of object in bits, not including end handles
         _writer->savePositonForSize();
 
@@ -190,41 +195,44 @@ void DwgObjectWriter::writeCommonData(CadObject *cadObject)
     _writer->main()->handleReference(cadObject);
 
     //Extended object data, if any
-    writeExtendedData(cadObject->extendedData());
+    writeExtendedData<V>(cadObject->hasExtendedData() ? cadObject->extendedData() : nullptr);
 }
 
+template<typename V>
 void DwgObjectWriter::writeCommonNonEntityData(CadObject *cadObject)
 {
-    writeCommonData(cadObject);
+    writeCommonData<V>(cadObject);
 
     //R13-R14 Only:
     //Obj size RL size of object in bits, not including end handles
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
         _writer->savePositonForSize();
 
     //[Owner ref handle (soft pointer)]
     _writer->handleReference(DwgReferenceType::SoftPointer, cadObject->owner()->handle());
 
     //write the cad object reactors
-    writeReactorsAndDictionaryHandle(cadObject);
+    writeReactorsAndDictionaryHandle<V>(cadObject);
 }
 
+template<typename V>
 void DwgObjectWriter::writeCommonEntityData(Entity *entity)
 {
-    writeCommonData(entity);
+    writeCommonData<V>(entity);
 
     //Graphic present Flag B 1 if a graphic is present
     _writer->writeBit(false);
 
     //R13 - R14 Only:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1014)
+    if constexpr (V::R13_14Only)
     {
         _writer->savePositonForSize();
     }
 
-    writeEntityMode(entity);
+    writeEntityMode<V>(entity);
 }
 
+template<typename V>
 void DwgObjectWriter::writeEntityMode(Entity *entity)
 {
     //FE: Entity mode(entmode). Generally, this indicates whether or not the owner
@@ -246,10 +254,10 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
         _writer->handleReference(DwgReferenceType::SoftPointer, entity->layer());
     }
 
-    writeReactorsAndDictionaryHandle(entity);
+    writeReactorsAndDictionaryHandle<V>(entity);
 
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //8 LAYER (hard pointer)
         _writer->handleReference(DwgReferenceType::HardPointer, entity->layer());
@@ -266,7 +274,7 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
     //previous/next handles present if Nolinks is 0.
     //Nolinks B 1 if major links are assumed +1, -1, else 0 For R2004+this always has value 1 (links are not used)
     bool hasLinks = true;
-    if (!R2004Plus)
+    if constexpr (!V::R2004Plus)
     {
         hasLinks = _prev != nullptr && _prev->handle() == entity->handle() - 1 && _next != nullptr &&
                    _next->handle() == entity->handle() + 1;
@@ -283,16 +291,19 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
     _writer->writeEnColor(entity->color(), entity->transparency(), entity->bookColor() != nullptr);
 
     //R2004+:
-    if ((_version >= ACadVersion::AC1018) && entity->bookColor() != nullptr)
+    if constexpr (V::R2004Plus)
     {
-        //[Color book color handle (hard pointer)]
-        _writer->handleReference(DwgReferenceType::HardPointer, entity->bookColor());
+        if (entity->bookColor() != nullptr)
+        {
+            //[Color book color handle (hard pointer)]
+            _writer->handleReference(DwgReferenceType::HardPointer, entity->bookColor());
+        }
     }
 
     //Ltype scale	BD	48
     _writer->writeBitDouble(entity->linetypeScale());
 
-    if (!(_version >= ACadVersion::AC1015))
+    if constexpr (!V::R2000Plus)
     {
         //Common:
         //Invisibility BS 60
@@ -329,7 +340,7 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
     }
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Material flags BB 00 = bylayer, 01 = byblock, 11 = material handle present at end of object
         _writer->write2Bits(0b00);
@@ -346,7 +357,7 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
     }
 
     //R2007 +:
-    if (_version > ACadVersion::AC1021)
+    if constexpr (V::R2010Plus)
     {
         //Material flags BB 00 = bylayer, 01 = byblock, 11 = material handle present at end of object
         _writer->writeBit(false);
@@ -373,20 +384,22 @@ void DwgObjectWriter::writeEntityMode(Entity *entity)
     _writer->writeByte(CadUtils::ToIndex(entity->lineweight()));
 }
 
+template<typename V>
 void DwgObjectWriter::writeExtendedData(ExtendedDataDictionary *data)
 {
-    if (writeXData())
+    if (writeXData() && data)
     {
         //EED size BS size of extended entity data, if any
         for (auto it = data->begin(); it != data->end(); ++it)
         {
-            writeExtendedDataEntry(it->first, it->second);
+            writeExtendedDataEntry<V>(it->first, it->second);
         }
     }
 
     _writer->writeBitShort(0);
 }
 
+template<typename V>
 void DwgObjectWriter::writeExtendedDataEntry(AppId *app, ExtendedData *entry)
 {
     std::stringstream stream;
@@ -473,7 +486,7 @@ void DwgObjectWriter::writeExtendedDataEntry(AppId *app, ExtendedData *entry)
         auto &&str = dynamic_cast<ExtendedDataString *>(record);
         if (str)
         {
-            if (R2007Plus)
+            if constexpr (V::R2007Plus)
             {
                 mstream.write(LittleEndianConverter::instance()->bytes((unsigned short) str->value().size() + 1), 0, 2);
                 std::vector<unsigned char> bytes = Encoding::Utf8().bytes(str->value());
@@ -502,12 +515,14 @@ void DwgObjectWriter::writeExtendedDataEntry(AppId *app, ExtendedData *entry)
     _writer->writeBytes(mstream.buffer(), 0, (int) mstream.length());
 }
 
+template<typename V>
 void DwgObjectWriter::writeReactorsAndDictionaryHandle(CadObject *cadObject)
 {
     //Numreactors S number of reactors in this object
     cadObject->clearReactors();
-    _writer->writeBitLong(cadObject->reactors().size());
-    for (auto &&item: cadObject->reactors())
+    const std::vector<CadObject *> reactors = std::as_const(*cadObject).reactors();
+    _writer->writeBitLong(reactors.size());
+    for (auto &&item: reactors)
     {
         //[Reactors (soft pointer)]
         _writer->handleReference(DwgReferenceType::SoftPointer, item);
@@ -516,7 +531,7 @@ void DwgObjectWriter::writeReactorsAndDictionaryHandle(CadObject *cadObject)
     bool noDictionary = (cadObject->xdictionary() == nullptr);
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         _writer->writeBit(noDictionary);
         if (!noDictionary)
@@ -531,7 +546,7 @@ void DwgObjectWriter::writeReactorsAndDictionaryHandle(CadObject *cadObject)
     }
 
     //R2013+:
-    if (R2013Plus)
+    if constexpr (V::R2013Plus)
     {
         //Has DS binary data B If 1 then this object has associated binary data stored in the data store
         _writer->writeBit(false);
@@ -564,4 +579,20 @@ unsigned char DwgObjectWriter::getEntMode(Entity *entity)
     return 0;
 }
 
+//The common encoders are called from the entity, object and table writers
+#define INSTANTIATE_COMMON_WRITERS(V)                                                                                  \
+    template void DwgObjectWriter::registerObject<V>(CadObject *);                                                     \
+    template void DwgObjectWriter::writeXrefDependantBit<V>(TableEntry *);                                             \
+    template void DwgObjectWriter::writeCommonData<V>(CadObject *);                                                    \
+    template void DwgObjectWriter::writeCommonNonEntityData<V>(CadObject *);                                           \
+    template void DwgObjectWriter::writeCommonEntityData<V>(Entity *);                                                 \
+    template void DwgObjectWriter::writeEntityMode<V>(Entity *);                                                       \
+    template void DwgObjectWriter::writeExtendedData<V>(ExtendedDataDictionary *);                                     \
+    template void DwgObjectWriter::writeExtendedDataEntry<V>(AppId *, ExtendedData *);                                 \
+    template void DwgObjectWriter::writeReactorsAndDictionaryHandle<V>(CadObject *);
+
+DWG_FOR_EACH_VERSION_TAG(INSTANTIATE_COMMON_WRITERS)
+
+#undef INSTANTIATE_COMMON_WRITERS
+
 }// namespace dwg
\ No newline at end of file
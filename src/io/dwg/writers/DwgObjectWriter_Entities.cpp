@@ -46,21 +46,28 @@
 #include <dwg/entities/LwPolyline.h>
 #include <dwg/entities/MLine.h>
 #include <dwg/entities/MText.h>
+#include <dwg/entities/Mesh.h>
 #include <dwg/entities/MultiLeader.h>
 #include <dwg/entities/Point.h>
+#include <dwg/entities/PolyLine.h>
 #include <dwg/entities/PolyfaceMesh.h>
 #include <dwg/entities/Ray.h>
 #include <dwg/entities/Seqend.h>
 #include <dwg/entities/Shape.h>
 #include <dwg/entities/Solid.h>
+#include <dwg/entities/Solid3D.h>
 #include <dwg/entities/Spline.h>
+#include <dwg/entities/TableEntity.h>
 #include <dwg/entities/TextEntity.h>
 #include <dwg/entities/Tolerance.h>
+#include <dwg/entities/UnknownEntity.h>
+#include <dwg/entities/Vertex.h>
 #include <dwg/entities/Viewport.h>
 #include <dwg/entities/XLine.h>
 #include <dwg/entities/collection/AttributeEntitySeqendCollection.h>
 #include <dwg/entities/collection/VertexFaceRecordCollection.h>
 #include <dwg/entities/collection/VertexSeqendCollection.h>
+#include <dwg/io/dwg/DwgVersionTag_p.h>
 #include <dwg/io/dwg/writers/DwgObjectWriter_p.h>
 #include <dwg/io/dwg/writers/IDwgStreamWriter_p.h>
 #include <dwg/objects/ImageDefinition.h>
@@ -71,29 +78,211 @@
 #include <dwg/tables/DimensionStyle.h>
 #include <dwg/tables/Layer.h>
 #include <dwg/tables/LineType.h>
+#include <fmt/core.h>
+#include <stdexcept>
 
 namespace dwg {
 
-void DwgObjectWriter::writeEntity(Entity *entity) {}
+void DwgObjectWriter::writeEntity(Entity *entity)
+{
+    //Resolve the version once per entity, the encoders below are specialized for it
+    dispatchDwgVersion(_version, [this, entity](auto tag) { writeEntity<decltype(tag)>(entity); });
+}
+
+template<typename V>
+void DwgObjectWriter::writeEntity(Entity *entity)
+{
+    //Ignore the unlisted entities, the ones reporting a type of their own are told apart by it
+    ObjectType type = entity->objectType();
+    if (type == ObjectType::SOLID3D ||
+        (isSharedObjectType(type) && (dynamic_cast<TableEntity *>(entity) || dynamic_cast<Mesh *>(entity) ||
+                                      dynamic_cast<UnknownEntity *>(entity))))
+    {
+        notify(fmt::format("Entity type not implemented {}", entity->objectName()), Notification::NotImplemented);
+        return;
+    }
+
+    writeCommonEntityData<V>(entity);
+
+    switch (type)
+    {
+        case ObjectType::ARC:
+            writeArc<V>(static_cast<Arc *>(entity));
+            break;
+        case ObjectType::CIRCLE:
+            writeCircle<V>(static_cast<Circle *>(entity));
+            break;
+        case ObjectType::ATTRIB:
+            writeAttribute<V>(static_cast<AttributeEntity *>(entity));
+            break;
+        case ObjectType::ATTDEF:
+            writeAttDefinition<V>(static_cast<AttributeDefinition *>(entity));
+            break;
+        case ObjectType::DIMENSION_LINEAR:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionLinear<V>(static_cast<DimensionLinear *>(entity));
+            break;
+        case ObjectType::DIMENSION_ALIGNED:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionAligned<V>(static_cast<DimensionAligned *>(entity));
+            break;
+        case ObjectType::DIMENSION_RADIUS:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionRadius<V>(static_cast<DimensionRadius *>(entity));
+            break;
+        case ObjectType::DIMENSION_ANG_2_Ln:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionAngular2Line<V>(static_cast<DimensionAngular2Line *>(entity));
+            break;
+        case ObjectType::DIMENSION_ANG_3_Pt:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionAngular3Pt<V>(static_cast<DimensionAngular3Pt *>(entity));
+            break;
+        case ObjectType::DIMENSION_DIAMETER:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionDiameter<V>(static_cast<DimensionDiameter *>(entity));
+            break;
+        case ObjectType::DIMENSION_ORDINATE:
+            writeCommonDimensionData<V>(static_cast<Dimension *>(entity));
+            writeDimensionOrdinate<V>(static_cast<DimensionOrdinate *>(entity));
+            break;
+        case ObjectType::ELLIPSE:
+            writeEllipse<V>(static_cast<Ellipse *>(entity));
+            break;
+        case ObjectType::FACE3D:
+            writeFace3D<V>(static_cast<Face3D *>(entity));
+            break;
+        case ObjectType::HATCH:
+            writeHatch<V>(static_cast<Hatch *>(entity));
+            break;
+        case ObjectType::INSERT:
+        case ObjectType::MINSERT:
+            writeInsert<V>(static_cast<Insert *>(entity));
+            break;
+        case ObjectType::LEADER:
+            writeLeader<V>(static_cast<Leader *>(entity));
+            break;
+        case ObjectType::LINE:
+            writeLine<V>(static_cast<Line *>(entity));
+            break;
+        case ObjectType::LWPOLYLINE:
+            writeLwPolyline<V>(static_cast<LwPolyline *>(entity));
+            break;
+        case ObjectType::MLINE:
+            writeMLine<V>(static_cast<MLine *>(entity));
+            break;
+        case ObjectType::MTEXT:
+            writeMText<V>(static_cast<MText *>(entity));
+            break;
+        case ObjectType::POINT:
+            writePoint<V>(static_cast<Point *>(entity));
+            break;
+        case ObjectType::POLYLINE_PFACE:
+            writePolyfaceMesh<V>(static_cast<PolyfaceMesh *>(entity));
+            break;
+        case ObjectType::POLYLINE_2D:
+            writePolyline2D<V>(static_cast<Polyline2D *>(entity));
+            break;
+        case ObjectType::POLYLINE_3D:
+            writePolyline3D<V>(static_cast<Polyline3D *>(entity));
+            break;
+        case ObjectType::SHAPE:
+            writeShape<V>(static_cast<Shape *>(entity));
+            break;
+        case ObjectType::SOLID:
+            writeSolid<V>(static_cast<Solid *>(entity));
+            break;
+        case ObjectType::SPLINE:
+            writeSpline<V>(static_cast<Spline *>(entity));
+            break;
+        case ObjectType::RAY:
+            writeRay<V>(static_cast<Ray *>(entity));
+            break;
+        case ObjectType::TEXT:
+            writeTextEntity<V>(static_cast<TextEntity *>(entity));
+            break;
+        case ObjectType::TOLERANCE:
+            writeTolerance<V>(static_cast<Tolerance *>(entity));
+            break;
+        case ObjectType::VERTEX_2D:
+            writeVertex2D<V>(static_cast<Vertex2D *>(entity));
+            break;
+        case ObjectType::VERTEX_PFACE_FACE:
+            writeFaceRecord<V>(static_cast<VertexFaceRecord *>(entity));
+            break;
+        case ObjectType::VERTEX_3D:
+        case ObjectType::VERTEX_MESH:
+        case ObjectType::VERTEX_PFACE:
+            writeVertex<V>(static_cast<Vertex *>(entity));
+            break;
+        case ObjectType::VIEWPORT:
+            writeViewport<V>(static_cast<Viewport *>(entity));
+            break;
+        case ObjectType::XLINE:
+            writeXLine<V>(static_cast<XLine *>(entity));
+            break;
+        default:
+            if (auto dimension = dynamic_cast<Dimension *>(entity))
+            {
+                writeCommonDimensionData<V>(dimension);
+            }
+            else if (auto multiLeader = dynamic_cast<MultiLeader *>(entity))
+            {
+                writeMultiLeader<V>(multiLeader);
+            }
+            else if (auto image = dynamic_cast<CadWipeoutBase *>(entity))
+            {
+                writeCadImage<V>(image);
+            }
+            else
+            {
+                throw std::runtime_error(fmt::format("Entity not implemented : {}", entity->objectName()));
+            }
+            break;
+    }
 
+    registerObject<V>(entity);
+
+    //Owned entities follow their owner in the object stream
+    if (auto insert = object_cast<Insert>(entity); insert && insert->hasAttributes())
+    {
+        std::vector<Entity *> children(insert->attributes()->begin(), insert->attributes()->end());
+        writeChildEntities<V>(children, insert->attributes()->seqend());
+    }
+    else if (auto fm = object_cast<PolyfaceMesh>(entity))
+    {
+        std::vector<Entity *> children(fm->vertices()->begin(), fm->vertices()->end());
+        children.insert(children.end(), fm->faces()->begin(), fm->faces()->end());
+        writeChildEntities<V>(children, fm->vertices()->seqend());
+    }
+    else if (auto pline = object_cast<Polyline>(entity))
+    {
+        std::vector<Entity *> children(pline->vertices()->begin(), pline->vertices()->end());
+        writeChildEntities<V>(children, pline->vertices()->seqend());
+    }
+}
+
+template<typename V>
 void DwgObjectWriter::writeArc(Arc *arc)
 {
-    writeCircle(arc);
+    writeCircle<V>(arc);
     _writer->writeBitDouble(arc->startAngle());
     _writer->writeBitDouble(arc->endAngle());
 }
 
+template<typename V>
 void DwgObjectWriter::writeAttribute(AttributeEntity *att)
 {
-    writeCommonAttData(att);
+    writeCommonAttData<V>(att);
 }
 
+template<typename V>
 void DwgObjectWriter::writeAttDefinition(AttributeDefinition *attdef)
 {
-    writeCommonAttData(attdef);
+    writeCommonAttData<V>(attdef);
 
     //R2010+:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
         //Version RC ?		Repeated??
         _writer->writeByte(attdef->version());
 
@@ -102,28 +291,29 @@ void DwgObjectWriter::writeAttDefinition(AttributeDefinition *attdef)
     _writer->writeVariableText(attdef->prompt());
 }
 
+template<typename V>
 void DwgObjectWriter::writeCommonAttData(AttributeBase *att)
 {
-    writeTextEntity(att);
+    writeTextEntity<V>(att);
 
     //R2010+:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //Version RC ?
         _writer->writeByte(att->version());
     }
 
     //R2018+:
-    if (R2018Plus)
+    if constexpr (V::R2018Plus)
     {
         _writer->writeByte((unsigned char) att->attributeType());
 
         if (att->attributeType() == AttributeBase::AttributeType::MultiLine ||
             att->attributeType() == AttributeBase::AttributeType::ConstantMultiLine)
         {
-            writeEntityMode(att->mtext());
+            writeEntityMode<V>(att->mtext());
 
-            writeMText(att->mtext());
+            writeMText<V>(att->mtext());
 
             //TODO: Write attribute MText data
             _writer->writeBitShort(0);
@@ -139,13 +329,14 @@ void DwgObjectWriter::writeCommonAttData(AttributeBase *att)
     _writer->writeByte((unsigned char) att->flags());
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Lock position flag B 280
         _writer->writeBit(att->isReallyLocked());
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeCircle(Circle *circle)
 {
     _writer->write3BitDouble(circle->center());
@@ -154,10 +345,11 @@ void DwgObjectWriter::writeCircle(Circle *circle)
     _writer->writeBitExtrusion(circle->normal());
 }
 
+template<typename V>
 void DwgObjectWriter::writeCommonDimensionData(Dimension *dimension)
 {
     //R2010:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //Version RC 280 0 = R2010
         _writer->writeByte(dimension->version());
@@ -192,7 +384,7 @@ void DwgObjectWriter::writeCommonDimensionData(Dimension *dimension)
     _writer->writeBitDouble(0);
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Attachment Point BS 71
         _writer->writeBitShort((short) dimension->attachmentPoint());
@@ -204,7 +396,7 @@ void DwgObjectWriter::writeCommonDimensionData(Dimension *dimension)
         _writer->writeBitDouble(dimension->measurement());
     }
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Unknown B 73
         _writer->writeBit(false);
@@ -224,14 +416,16 @@ void DwgObjectWriter::writeCommonDimensionData(Dimension *dimension)
     _writer->handleReference(DwgReferenceType::HardPointer, dimension->block());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionLinear(DimensionLinear *dimension)
 {
-    writeDimensionAligned(dimension);
+    writeDimensionAligned<V>(dimension);
 
     //Dim rot BD 50 Linear dimension rotation; see DXF documentation.
     _writer->writeBitDouble(dimension->rotation());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionAligned(DimensionAligned *dimension)
 {
     //Common:
@@ -246,6 +440,7 @@ void DwgObjectWriter::writeDimensionAligned(DimensionAligned *dimension)
     _writer->writeBitDouble(dimension->extLineRotation());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionRadius(DimensionRadius *dimension)
 {
     //Common:
@@ -257,6 +452,7 @@ void DwgObjectWriter::writeDimensionRadius(DimensionRadius *dimension)
     _writer->writeBitDouble(dimension->leaderLength());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionAngular2Line(DimensionAngular2Line *dimension)
 {
     //Common:
@@ -273,6 +469,7 @@ void DwgObjectWriter::writeDimensionAngular2Line(DimensionAngular2Line *dimensio
     _writer->write3BitDouble(dimension->definitionPoint());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionAngular3Pt(DimensionAngular3Pt *dimension)
 {
     //Common:
@@ -286,6 +483,7 @@ void DwgObjectWriter::writeDimensionAngular3Pt(DimensionAngular3Pt *dimension)
     _writer->write3BitDouble(dimension->angleVertex());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionDiameter(DimensionDiameter *dimension)
 {
     //Common:
@@ -297,6 +495,7 @@ void DwgObjectWriter::writeDimensionDiameter(DimensionDiameter *dimension)
     _writer->writeBitDouble(dimension->leaderLength());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDimensionOrdinate(DimensionOrdinate *dimension)
 {
     //Common:
@@ -311,6 +510,7 @@ void DwgObjectWriter::writeDimensionOrdinate(DimensionOrdinate *dimension)
     _writer->writeByte(flag);
 }
 
+template<typename V>
 void DwgObjectWriter::writeEllipse(Ellipse *ellipse)
 {
     _writer->write3BitDouble(ellipse->center());
@@ -321,13 +521,14 @@ void DwgObjectWriter::writeEllipse(Ellipse *ellipse)
     _writer->writeBitDouble(ellipse->endParameter());
 }
 
+template<typename V>
 void DwgObjectWriter::writeInsert(Insert *insert)
 {
     //Ins pt 3BD 10
     _writer->write3BitDouble(insert->insertPoint());
 
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //X Scale BD 41
         _writer->writeBitDouble(insert->XScale());
@@ -338,7 +539,7 @@ void DwgObjectWriter::writeInsert(Insert *insert)
     }
 
     //R2000 + Only:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Data flags BB
         //Scale Data Varies with Data flags:
@@ -379,10 +580,13 @@ void DwgObjectWriter::writeInsert(Insert *insert)
     _writer->writeBit(insert->hasAttributes());
 
     //R2004+:
-    if (R2004Plus && insert->hasAttributes())
+    if constexpr (V::R2004Plus)
     {
-        //Owned Object Count BL Number of objects owned by this object.
-        _writer->writeBitLong(insert->attributes()->size());
+        if (insert->hasAttributes())
+        {
+            //Owned Object Count BL Number of objects owned by this object.
+            _writer->writeBitLong(insert->attributes()->size());
+        }
     }
 
     if (insert->isMultiple())
@@ -409,13 +613,13 @@ void DwgObjectWriter::writeInsert(Insert *insert)
     }
 
     //R13 - R2000:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1015)
+    if constexpr (V::version >= ACadVersion::AC1012 && V::version <= ACadVersion::AC1015)
     {
         _writer->handleReference(DwgReferenceType::SoftPointer, insert->attributes()->front());
         _writer->handleReference(DwgReferenceType::SoftPointer, insert->attributes()->back());
     }
     //R2004+:
-    else if (R2004Plus)
+    else if constexpr (V::R2004Plus)
     {
         for (auto att = insert->attributes()->begin(); att != insert->attributes()->end(); ++att)
         {
@@ -429,10 +633,11 @@ void DwgObjectWriter::writeInsert(Insert *insert)
     _writer->handleReference(DwgReferenceType::HardOwnership, insert->attributes()->seqend());
 }
 
+template<typename V>
 void DwgObjectWriter::writeFace3D(Face3D *face)
 {
     //R13 - R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //1st corner 3BD 10
         _writer->write3BitDouble(face->firstCorner());
@@ -447,7 +652,7 @@ void DwgObjectWriter::writeFace3D(Face3D *face)
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         bool noFlags = face->flags() == (int) InvisibleEdgeFlag::None;
         //Has no flag ind. B
@@ -483,6 +688,7 @@ void DwgObjectWriter::writeFace3D(Face3D *face)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeMLine(MLine *mline)
 {
     //Scale BD 40
@@ -544,6 +750,7 @@ void DwgObjectWriter::writeMLine(MLine *mline)
     _writer->handleReference(DwgReferenceType::HardPointer, mline->style());
 }
 
+template<typename V>
 void DwgObjectWriter::writeLwPolyline(LwPolyline *lwPolyline)
 {
     bool nbulges = false;
@@ -636,7 +843,7 @@ void DwgObjectWriter::writeLwPolyline(LwPolyline *lwPolyline)
         _writer->writeBitLong(lwPolyline->vertices().size());
     }
 
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         for (int i = 0; i < lwPolyline->vertices().size(); i++)
         {
@@ -644,15 +851,18 @@ void DwgObjectWriter::writeLwPolyline(LwPolyline *lwPolyline)
         }
     }
 
-    if (R2000Plus && lwPolyline->vertices().size() > 0)
+    if constexpr (V::R2000Plus)
     {
-        auto &&last = lwPolyline->vertices().at(0);
-        _writer->write2RawDouble(last.Location);
-        for (int j = 1; j < lwPolyline->vertices().size(); j++)
+        if (lwPolyline->vertices().size() > 0)
         {
-            auto &&curr = lwPolyline->vertices().at(j);
-            _writer->write2BitDoubleWithDefault(curr.Location, last.Location);
-            last = curr;
+            auto &&last = lwPolyline->vertices().at(0);
+            _writer->write2RawDouble(last.Location);
+            for (int j = 1; j < lwPolyline->vertices().size(); j++)
+            {
+                auto &&curr = lwPolyline->vertices().at(j);
+                _writer->write2BitDoubleWithDefault(curr.Location, last.Location);
+                last = curr;
+            }
         }
     }
 
@@ -674,10 +884,11 @@ void DwgObjectWriter::writeLwPolyline(LwPolyline *lwPolyline)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeHatch(Hatch *hatch)
 {
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         HatchGradientPattern *gradient = hatch->gradientColor();//TODO: set default ?? HatchGradientPattern.Default;
 
@@ -771,7 +982,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
                 {
                     case HatchBoundaryPath::HBP_EdgeType::HBP_Line:
                         {
-                            auto line = dynamic_cast<HatchBoundaryPath::HBP_Line *>(edge);
+                            auto line = static_cast<HatchBoundaryPath::HBP_Line *>(edge);
                             //pt0 2RD 10 first endpoint
                             _writer->write2RawDouble(line->start());
                             //pt1 2RD 11 second endpoint
@@ -780,7 +991,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
                         }
                     case HatchBoundaryPath::HBP_EdgeType::HBP_CircularArc:
                         {
-                            auto arc = dynamic_cast<HatchBoundaryPath::HBP_Arc *>(edge);
+                            auto arc = static_cast<HatchBoundaryPath::HBP_Arc *>(edge);
                             //pt0 2RD 10 center
                             _writer->write2RawDouble(arc->center());
                             //radius BD 40 radius
@@ -795,7 +1006,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
                         }
                     case HatchBoundaryPath::HBP_EdgeType::HBP_EllipticArc:
                         {
-                            auto ellipse = dynamic_cast<HatchBoundaryPath::HBP_Ellipse *>(edge);
+                            auto ellipse = static_cast<HatchBoundaryPath::HBP_Ellipse *>(edge);
                             //pt0 2RD 10 center
                             _writer->write2RawDouble(ellipse->center());
                             //endpoint 2RD 11 endpoint of major axis
@@ -812,7 +1023,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
                         }
                     case HatchBoundaryPath::HBP_EdgeType::HBP_Spline:
                         {
-                            auto splineEdge = dynamic_cast<HatchBoundaryPath::HBP_Spline *>(edge);
+                            auto splineEdge = static_cast<HatchBoundaryPath::HBP_Spline *>(edge);
                             //degree BL 94 degree of the spline
                             _writer->writeBitLong(splineEdge->degree());
                             //isrational B 73 1 if rational(has weights), else 0
@@ -841,7 +1052,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
                             }
 
                             //R24:
-                            if (R2010Plus)
+                            if constexpr (V::R2010Plus)
                             {
                                 //Numfitpoints BL 97 number of fit points
                                 _writer->writeBitLong(splineEdge->fitPoints().size());
@@ -923,6 +1134,7 @@ void DwgObjectWriter::writeHatch(Hatch *hatch)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeLeader(Leader *leader)
 {
     //Unknown bit B --- Always seems to be 0.
@@ -951,14 +1163,14 @@ void DwgObjectWriter::writeLeader(Leader *leader)
     _writer->write3BitDouble(leader->blockOffset());
 
     //R14+:
-    if (_version >= ACadVersion::AC1014)
+    if constexpr (V::version >= ACadVersion::AC1014)
     {
         //Endptproj 3BD --- A non-planar leader gives a point that projects the endpoint back to the annotation.
         _writer->write3BitDouble(leader->annotationOffset());
     }
 
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //DIMGAP BD --- The value of DIMGAP in the associated DIMSTYLE at the time of creation, multiplied by the dimscale in that dimstyle.
         _writer->writeBitDouble(leader->style()->dimensionLineGap());
@@ -966,7 +1178,7 @@ void DwgObjectWriter::writeLeader(Leader *leader)
 
 
     //Common:
-    if (_version <= ACadVersion::AC1021)
+    if constexpr (V::version <= ACadVersion::AC1021)
     {
         //Box height BD 40 MTEXT extents height. (A text box is slightly taller, probably by some DIMvar amount.)
         _writer->writeBitDouble(leader->textHeight());
@@ -980,7 +1192,7 @@ void DwgObjectWriter::writeLeader(Leader *leader)
     _writer->writeBit(leader->arrowHeadEnabled());
 
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //Arrowheadtype BS arrowhead type
         _writer->writeBitShort(0);
@@ -1001,7 +1213,7 @@ void DwgObjectWriter::writeLeader(Leader *leader)
     }
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Unknown BS
         _writer->writeBitShort(0);
@@ -1017,15 +1229,16 @@ void DwgObjectWriter::writeLeader(Leader *leader)
     _writer->handleReference(DwgReferenceType::HardPointer, leader->style());
 }
 
+template<typename V>
 void DwgObjectWriter::writeMultiLeader(MultiLeader *multiLeader)
 {
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //	270 Version, expected to be 2
         _writer->writeBitShort(2);
     }
 
-    writeMultiLeaderAnnotContext(multiLeader->contextData());
+    writeMultiLeaderAnnotContext<V>(multiLeader->contextData());
 
     //	Multileader Common data
     //	340 Leader StyleId (handle)
@@ -1109,7 +1322,7 @@ void DwgObjectWriter::writeMultiLeader(MultiLeader *multiLeader)
     //	45	BD	ScaleFactor
     _writer->writeBitDouble(multiLeader->scaleFactor());
 
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //  271 Text attachment direction for MText contents
         _writer->writeBitShort((short) multiLeader->textAttachmentDirection());
@@ -1119,13 +1332,14 @@ void DwgObjectWriter::writeMultiLeader(MultiLeader *multiLeader)
         _writer->writeBitShort((short) multiLeader->textTopAttachment());
     }
 
-    if (R2013Plus)
+    if constexpr (V::R2013Plus)
     {
         //	295 Leader extended to text
         _writer->writeBit(multiLeader->extendedToText());
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *annotContext)
 {
     auto writeLeaderLine = [&](MultiLeaderAnnotContext::LeaderLine leaderLine) {
@@ -1161,7 +1375,7 @@ void DwgObjectWriter::writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *anno
         //	BL	91	Leader line index
         _writer->writeBitLong(leaderLine.index);
 
-        if (R2010Plus)
+        if constexpr (V::R2010Plus)
         {
             //	BS	170	Leader type(0 = invisible leader, 1 = straight leader, 2 = spline leader)
             _writer->writeBitShort((short) leaderLine.pathType);
@@ -1215,7 +1429,7 @@ void DwgObjectWriter::writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *anno
             writeLeaderLine(leaderLine);
         }
 
-        if (R2010Plus)
+        if constexpr (V::R2010Plus)
         {
             //	BS	271	Attachment direction(0 = horizontal, 1 = vertical, default is 0)
             _writer->writeBitShort((short) leaderRoot.textAttachmentDirection);
@@ -1373,7 +1587,7 @@ void DwgObjectWriter::writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *anno
     //	B	297	Is normal reversed?
     _writer->writeBit(annotContext->normalReversed());
 
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //	BS	273	Style top attachment
         _writer->writeBitShort((short) annotContext->textTopAttachment());
@@ -1382,10 +1596,11 @@ void DwgObjectWriter::writeMultiLeaderAnnotContext(MultiLeaderAnnotContext *anno
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeLine(Line *line)
 {
     //R13-R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //Start pt 3BD 10
         _writer->write3BitDouble(line->startPoint());
@@ -1395,7 +1610,7 @@ void DwgObjectWriter::writeLine(Line *line)
 
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Z's are zero bit B
         bool flag = line->startPoint().Z == 0.0 && line->endPoint().Z == 0.0;
@@ -1426,6 +1641,7 @@ void DwgObjectWriter::writeLine(Line *line)
     _writer->writeBitExtrusion(line->normal());
 }
 
+template<typename V>
 void DwgObjectWriter::writePoint(Point *point)
 {
     //Point 3BD 10
@@ -1438,6 +1654,7 @@ void DwgObjectWriter::writePoint(Point *point)
     _writer->writeBitDouble(point->rotation());
 }
 
+template<typename V>
 void DwgObjectWriter::writePolyfaceMesh(PolyfaceMesh *fm)
 {
     //Numverts BS 71 Number of vertices in the mesh.
@@ -1446,7 +1663,7 @@ void DwgObjectWriter::writePolyfaceMesh(PolyfaceMesh *fm)
     _writer->writeBitShort((short) fm->faces()->size());
 
     //R2004 +:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Owned Object Count BL Number of objects owned by this object.
         _writer->writeBitLong(fm->vertices()->size() + fm->faces()->size());
@@ -1462,7 +1679,7 @@ void DwgObjectWriter::writePolyfaceMesh(PolyfaceMesh *fm)
     }
 
     //R13 - R2000:
-    if (R13_15Only)
+    if constexpr (V::R13_15Only)
     {
         std::vector<CadObject *> child;
         child.insert(child.end(), fm->faces()->begin(), fm->faces()->end());
@@ -1484,6 +1701,7 @@ void DwgObjectWriter::writePolyfaceMesh(PolyfaceMesh *fm)
     _writer->handleReference(DwgReferenceType::SoftPointer, fm->vertices()->seqend());
 }
 
+template<typename V>
 void DwgObjectWriter::writePolyline2D(Polyline2D *pline)
 {
     //Flags BS 70
@@ -1503,7 +1721,7 @@ void DwgObjectWriter::writePolyline2D(Polyline2D *pline)
 
     int count = pline->vertices()->size();
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Owned Object Count BL Number of objects owned by this object.
         _writer->writeBitLong(count);
@@ -1514,7 +1732,7 @@ void DwgObjectWriter::writePolyline2D(Polyline2D *pline)
     }
 
     //R13-R2000:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1015)
+    if constexpr (V::version >= ACadVersion::AC1012 && V::version <= ACadVersion::AC1015)
     {
         if (pline->vertices()->empty())
         {
@@ -1537,6 +1755,7 @@ void DwgObjectWriter::writePolyline2D(Polyline2D *pline)
     _writer->handleReference(DwgReferenceType::HardOwnership, pline->vertices()->seqend());
 }
 
+template<typename V>
 void DwgObjectWriter::writePolyline3D(Polyline3D *pline)
 {
     //Flags RC 70 NOT DIRECTLY THE 75. Bit-coded (76543210):
@@ -1551,7 +1770,7 @@ void DwgObjectWriter::writePolyline3D(Polyline3D *pline)
     _writer->writeByte((unsigned char) (pline->flags() & PolylineFlag::ClosedPolylineOrClosedPolygonMeshInM) ? 1 : 0);
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Owned Object Count BL Number of objects owned by this object.
         _writer->writeBitLong(pline->vertices()->size());
@@ -1563,7 +1782,7 @@ void DwgObjectWriter::writePolyline3D(Polyline3D *pline)
     }
 
     //R13-R2000:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1015)
+    if constexpr (V::version >= ACadVersion::AC1012 && V::version <= ACadVersion::AC1015)
     {
         if (pline->vertices()->empty())
         {
@@ -1583,6 +1802,7 @@ void DwgObjectWriter::writePolyline3D(Polyline3D *pline)
     _writer->handleReference(DwgReferenceType::HardOwnership, pline->vertices()->seqend());
 }
 
+template<typename V>
 void DwgObjectWriter::writeSeqend(Seqend *seqend)
 {
     //for empty list seqend is nullptr
@@ -1595,13 +1815,14 @@ void DwgObjectWriter::writeSeqend(Seqend *seqend)
     _prev = nullptr;
     _next = nullptr;
 
-    writeCommonEntityData(seqend);
-    registerObject(seqend);
+    writeCommonEntityData<V>(seqend);
+    registerObject<V>(seqend);
 
     _prev = prevHolder;
     _next = nextHolder;
 }
 
+template<typename V>
 void DwgObjectWriter::writeShape(Shape *shape)
 {
     //Ins pt 3BD 10
@@ -1632,6 +1853,7 @@ void DwgObjectWriter::writeShape(Shape *shape)
     _writer->handleReference(DwgReferenceType::HardPointer, nullptr);
 }
 
+template<typename V>
 void DwgObjectWriter::writeSolid(Solid *solid)
 {
     //Thickness BT 39
@@ -1657,8 +1879,10 @@ void DwgObjectWriter::writeSolid(Solid *solid)
     _writer->writeBitExtrusion(solid->normal());
 }
 
+template<typename V>
 void DwgObjectWriter::writeSolid3D(Solid3D *solid) {}
 
+template<typename V>
 void DwgObjectWriter::writeCadImage(CadWipeoutBase *image)
 {
     _writer->writeBitLong(image->classVersion());
@@ -1675,7 +1899,7 @@ void DwgObjectWriter::writeCadImage(CadWipeoutBase *image)
     _writer->writeByte(image->contrast());
     _writer->writeByte(image->fade());
 
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         _writer->writeBit(image->clipMode() == ClipMode::Inside);
     }
@@ -1703,11 +1927,12 @@ void DwgObjectWriter::writeCadImage(CadWipeoutBase *image)
     _writer->handleReference(nullptr);
 }
 
+template<typename V>
 void DwgObjectWriter::writeSpline(Spline *spline)
 {
     int scenario;
     //R2013+:
-    if (R2013Plus)
+    if constexpr (V::R2013Plus)
     {
         //The scenario flag becomes 1 if the knot parameter is Custom or has no fit data, otherwise 2.
         if (spline->knotParameterization() == KnotParameterization::Custom || spline->fitPoints().size() == 0)
@@ -1803,6 +2028,7 @@ void DwgObjectWriter::writeSpline(Spline *spline)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeRay(Ray *ray)
 {
     //Point 3BD 10
@@ -1811,10 +2037,11 @@ void DwgObjectWriter::writeRay(Ray *ray)
     _writer->write3BitDouble(ray->direction());
 }
 
+template<typename V>
 void DwgObjectWriter::writeTextEntity(TextEntity *text)
 {
     //R13-14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //Elevation BD ---
         _writer->writeBitDouble(text->insertPoint().Z);
@@ -1940,6 +2167,7 @@ void DwgObjectWriter::writeTextEntity(TextEntity *text)
     _writer->handleReference(DwgReferenceType::HardPointer, text->style());
 }
 
+template<typename V>
 void DwgObjectWriter::writeMText(MText *mtext)
 {
     //Insertion pt3 BD 10 First picked point. (Location relative to text depends on attachment point (71).)
@@ -1952,7 +2180,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
     _writer->writeBitDouble(mtext->rectangleWidth());
 
     //R2007+:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Rect height BD 46 Reference rectangle height.
         _writer->writeBitDouble(mtext->rectangleHeight());
@@ -1978,7 +2206,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
     _writer->handleReference(DwgReferenceType::HardPointer, mtext->style());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Linespacing Style BS 73
         _writer->writeBitShort((short) mtext->lineSpacingStyle());
@@ -1989,7 +2217,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
     }
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Background flags BL 90 0 = no background, 1 = background fill, 2 = background fill with drawing fill color, 0x10 = text frame (R2018+)
         _writer->writeBitLong((int) mtext->backgroundFillFlags());
@@ -1997,7 +2225,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
         //background flags has bit 0x01 set, or in case of R2018 bit 0x10:
         if ((mtext->backgroundFillFlags() & BackgroundFillFlag::UseBackgroundFillColor) !=
                     (int) BackgroundFillFlag::None ||
-            _version > ACadVersion::AC1027 && (mtext->backgroundFillFlags() & BackgroundFillFlag::TextFrame) > 0)
+            V::version > ACadVersion::AC1027 && (mtext->backgroundFillFlags() & BackgroundFillFlag::TextFrame) > 0)
         {
             //Background scale factor	BL 45 default = 1.5
             _writer->writeBitDouble(mtext->backgroundScale());
@@ -2009,7 +2237,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
     }
 
     //R2018+
-    if (!R2018Plus)
+    if constexpr (!V::R2018Plus)
     {
         return;
     }
@@ -2077,6 +2305,7 @@ void DwgObjectWriter::writeMText(MText *mtext)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeFaceRecord(VertexFaceRecord *face)
 {
     //Vert index BS 71 1 - based vertex index(see DXF doc)
@@ -2089,6 +2318,7 @@ void DwgObjectWriter::writeFaceRecord(VertexFaceRecord *face)
     _writer->writeBitShort(face->index4());
 }
 
+template<typename V>
 void DwgObjectWriter::writeVertex2D(Vertex2D *vertex)
 {
     //Flags EC 70 NOT bit-pair-coded.
@@ -2116,7 +2346,7 @@ void DwgObjectWriter::writeVertex2D(Vertex2D *vertex)
     _writer->writeBitDouble(vertex->bulge());
 
     //R2010+:
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //Vertex ID BL 91
         _writer->writeBitLong(vertex->id());
@@ -2127,6 +2357,7 @@ void DwgObjectWriter::writeVertex2D(Vertex2D *vertex)
     _writer->writeBitDouble(vertex->curveTangent());
 }
 
+template<typename V>
 void DwgObjectWriter::writeVertex(Vertex *vertex)
 {
     //Flags EC 70 NOT bit-pair-coded.
@@ -2135,10 +2366,11 @@ void DwgObjectWriter::writeVertex(Vertex *vertex)
     _writer->write3BitDouble(vertex->location());
 }
 
+template<typename V>
 void DwgObjectWriter::writeTolerance(Tolerance *tolerance)
 {
     //R13 - R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         //Unknown short S
         _writer->writeBitShort(0);
@@ -2163,6 +2395,7 @@ void DwgObjectWriter::writeTolerance(Tolerance *tolerance)
     _writer->handleReference(DwgReferenceType::HardPointer, tolerance->style());
 }
 
+template<typename V>
 void DwgObjectWriter::writeViewport(Viewport *viewport)
 {
     //Center 3BD 10
@@ -2173,7 +2406,7 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     _writer->writeBitDouble(viewport->height());
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //View Target 3BD 17
         _writer->write3BitDouble(viewport->viewTarget());
@@ -2204,14 +2437,14 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Grid Major BS 61
         _writer->writeBitShort(viewport->majorGridLineFrequency());
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Frozen Layer Count BL
         _writer->writeBitLong(viewport->frozenLayers().size());
@@ -2238,14 +2471,14 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 
     //R2004 +:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //ShadePlot Mode BS 170
         _writer->writeBitShort((short) viewport->shadePlotMode());
     }
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Use def. lights B 292
         _writer->writeBit(viewport->useDefaultLighting());
@@ -2260,17 +2493,17 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 
     //R13 - R14 Only:
-    if (R13_14Only)
+    if constexpr (V::R13_14Only)
     {
         _writer->handleReference(DwgReferenceType::HardPointer, nullptr);
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         for (auto &&layer: viewport->frozenLayers())
         {
-            if (R2004Plus)
+            if constexpr (V::R2004Plus)
             {
                 //H 341 Frozen Layer Handles(use count from above)
                 //(hard pointer until R2000, soft pointer from R2004 onwards)
@@ -2287,14 +2520,14 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 
     //R2000:
-    if (_version == ACadVersion::AC1015)
+    if constexpr (V::version == ACadVersion::AC1015)
     {
         //H VIEWPORT ENT HEADER((hard pointer))
         _writer->handleReference(DwgReferenceType::HardPointer, nullptr);
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //TODO: Implement viewport UCS
         _writer->handleReference(DwgReferenceType::HardPointer, nullptr);
@@ -2302,7 +2535,7 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //H 332 Background(soft pointer)
         _writer->handleReference(DwgReferenceType::SoftPointer, nullptr);
@@ -2315,6 +2548,7 @@ void DwgObjectWriter::writeViewport(Viewport *viewport)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeXLine(XLine *xline)
 {
     //3 RD: a point on the construction line
@@ -2323,6 +2557,7 @@ void DwgObjectWriter::writeXLine(XLine *xline)
     _writer->write3BitDouble(xline->direction());
 }
 
+template<typename V>
 void DwgObjectWriter::writeChildEntities(const std::vector<Entity *> &entities, Seqend *seqend)
 {
     if (entities.empty())
@@ -2337,20 +2572,20 @@ void DwgObjectWriter::writeChildEntities(const std::vector<Entity *> &entities,
     for (int i = 1; i < entities.size(); i++)
     {
         _next = entities.at(i);
-        writeEntity(curr);
+        writeEntity<V>(curr);
         _prev = curr;
         curr = _next;
     }
 
     _next = nullptr;
-    writeEntity(curr);
+    writeEntity<V>(curr);
 
     _prev = prevHolder;
     _next = nextHolder;
 
     if (seqend != nullptr)
     {
-        writeSeqend(seqend);
+        writeSeqend<V>(seqend);
     }
 }
 
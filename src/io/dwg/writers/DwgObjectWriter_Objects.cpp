@@ -24,8 +24,10 @@
 #include <dwg/GroupCodeValue.h>
 #include <dwg/entities/Entity.h>
 #include <dwg/entities/Viewport.h>
+#include <dwg/io/dwg/DwgVersionTag_p.h>
 #include <dwg/io/dwg/writers/DwgObjectWriter_p.h>
 #include <dwg/io/dwg/writers/IDwgStreamWriter_p.h>
+#include <dwg/objects/AcdbPlaceHolder.h>
 #include <dwg/objects/BookColor.h>
 #include <dwg/objects/CadDictionary.h>
 #include <dwg/objects/CadDictionaryWithDefault.h>
@@ -36,31 +38,148 @@
 #include <dwg/objects/ImageDefinitionReactor.h>
 #include <dwg/objects/Layout.h>
 #include <dwg/objects/MLineStyle.h>
+#include <dwg/objects/Material.h>
+#include <dwg/objects/MultiLeaderAnnotContext.h>
 #include <dwg/objects/MultiLeaderStyle.h>
 #include <dwg/objects/NonGraphicalObject.h>
 #include <dwg/objects/PlotSettings.h>
 #include <dwg/objects/Scale.h>
 #include <dwg/objects/SortEntitiesTable.h>
 #include <dwg/objects/UnknownNonGraphicalObject.h>
+#include <dwg/objects/VisualStyle.h>
 #include <dwg/objects/XRecord.h>
+#include <dwg/objects/evaluations/EvaluationGraph.h>
 #include <dwg/tables/LineType.h>
 #include <dwg/tables/UCS.h>
 #include <dwg/utils/EndianConverter.h>
 #include <dwg/utils/StreamWrapper.h>
+#include <fmt/core.h>
+#include <stdexcept>
 
 namespace dwg {
 
-void DwgObjectWriter::writeObjects() {}
+void DwgObjectWriter::writeObjects()
+{
+    //Resolve the version once for the whole queue, the encoders below are specialized for it
+    dispatchDwgVersion(_version, [this](auto tag) {
+        while (!_objects.empty())
+        {
+            CadObject *obj = _objects.front();
+            _objects.pop();
+            writeObject<decltype(tag)>(obj);
+        }
+    });
+}
+
+void DwgObjectWriter::writeObject(CadObject *obj)
+{
+    dispatchDwgVersion(_version, [this, obj](auto tag) { writeObject<decltype(tag)>(obj); });
+}
+
+template<typename V>
+void DwgObjectWriter::writeObject(CadObject *obj)
+{
+    //The objects reporting a type of their own are told apart by it
+    ObjectType type = obj->objectType();
+    if (isSharedObjectType(type) &&
+        (dynamic_cast<EvaluationGraph *>(obj) || dynamic_cast<Material *>(obj) ||
+         dynamic_cast<MultiLeaderAnnotContext *>(obj) || dynamic_cast<UnknownNonGraphicalObject *>(obj) ||
+         dynamic_cast<VisualStyle *>(obj)))
+    {
+        notify(fmt::format("Object type not implemented {}", obj->objectName()), Notification::NotImplemented);
+        return;
+    }
+
+    if (type == ObjectType::XRECORD && !writeXRecords())
+    {
+        return;
+    }
 
-void DwgObjectWriter::writeObject(CadObject *obj) {}
+    writeCommonNonEntityData<V>(obj);
+
+    switch (type)
+    {
+        case ObjectType::ACDBPLACEHOLDER:
+            writeAcdbPlaceHolder(static_cast<AcdbPlaceHolder *>(obj));
+            break;
+        case ObjectType::DICTIONARY:
+            writeDictionary<V>(static_cast<CadDictionary *>(obj));
+            break;
+        case ObjectType::GROUP:
+            writeGroup(static_cast<Group *>(obj));
+            break;
+        case ObjectType::LAYOUT:
+            writeLayout<V>(static_cast<Layout *>(obj));
+            break;
+        case ObjectType::MLINESTYLE:
+            writeMLineStyle<V>(static_cast<MLineStyle *>(obj));
+            break;
+        case ObjectType::XRECORD:
+            writeXRecord<V>(static_cast<XRecord *>(obj));
+            break;
+        default:
+            if (auto bookColor = dynamic_cast<BookColor *>(obj))
+            {
+                writeBookColor<V>(bookColor);
+            }
+            else if (auto dictionaryWithDefault = dynamic_cast<CadDictionaryWithDefault *>(obj))
+            {
+                writeCadDictionaryWithDefault<V>(dictionaryWithDefault);
+            }
+            else if (auto dictionary = dynamic_cast<CadDictionary *>(obj))
+            {
+                writeDictionary<V>(dictionary);
+            }
+            else if (auto dictionaryVariable = dynamic_cast<DictionaryVariable *>(obj))
+            {
+                writeDictionaryVariable(dictionaryVariable);
+            }
+            else if (auto geodata = dynamic_cast<GeoData *>(obj))
+            {
+                writeGeoData(geodata);
+            }
+            else if (auto definition = dynamic_cast<ImageDefinition *>(obj))
+            {
+                writeImageDefinition(definition);
+            }
+            else if (auto definitionReactor = dynamic_cast<ImageDefinitionReactor *>(obj))
+            {
+                writeImageDefinitionReactor(definitionReactor);
+            }
+            else if (auto mLeaderStyle = dynamic_cast<MultiLeaderStyle *>(obj))
+            {
+                writeMultiLeaderStyle<V>(mLeaderStyle);
+            }
+            else if (auto plot = dynamic_cast<PlotSettings *>(obj))
+            {
+                writePlotSettings<V>(plot);
+            }
+            else if (auto scale = dynamic_cast<Scale *>(obj))
+            {
+                writeScale(scale);
+            }
+            else if (auto sortEntitiesTable = dynamic_cast<SortEntitiesTable *>(obj))
+            {
+                writeSortEntitiesTable(sortEntitiesTable);
+            }
+            else
+            {
+                throw std::runtime_error(fmt::format("Object not implemented : {}", obj->objectName()));
+            }
+            break;
+    }
+
+    registerObject<V>(obj);
+}
 
 void DwgObjectWriter::writeAcdbPlaceHolder(AcdbPlaceHolder *acdbPlaceHolder) {}
 
+template<typename V>
 void DwgObjectWriter::writeBookColor(BookColor *color)
 {
     _writer->writeBitShort(0);
 
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         unsigned char arr[4] = {color->color().blue(), color->color().green(), color->color().red(), 0b11000010};
 
@@ -92,14 +211,16 @@ void DwgObjectWriter::writeBookColor(BookColor *color)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeCadDictionaryWithDefault(CadDictionaryWithDefault *dictionary)
 {
-    writeDictionary(dictionary);
+    writeDictionary<V>(dictionary);
 
     //H 7 Default entry (hard pointer)
     _writer->handleReference(DwgReferenceType::HardPointer, dictionary->defaultEntry());
 }
 
+template<typename V>
 void DwgObjectWriter::writeDictionary(CadDictionary *dictionary)
 {
     //Common:
@@ -108,7 +229,7 @@ void DwgObjectWriter::writeDictionary(CadDictionary *dictionary)
     for (auto it = dictionary->value_begin(); it != dictionary->value_end(); ++it)
     {
         auto item = *it;
-        if (dynamic_cast<XRecord *>(item) && !writeXRecords())
+        if (object_cast<XRecord>(item) && !writeXRecords())
         {
             continue;
         }
@@ -123,14 +244,14 @@ void DwgObjectWriter::writeDictionary(CadDictionary *dictionary)
     _writer->writeBitLong(entries.size());
 
     //R14 Only:
-    if (_version == ACadVersion::AC1014)
+    if constexpr (V::version == ACadVersion::AC1014)
     {
         //Unknown R14 RC Unknown R14 unsigned char, has always been 0
         _writer->writeByte(0);
     }
 
     //R2000 +:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Cloning flag BS 281
         _writer->writeBitShort((short) dictionary->clonningFlags());
@@ -140,7 +261,7 @@ void DwgObjectWriter::writeDictionary(CadDictionary *dictionary)
     //Common:
     for (auto &&item: entries)
     {
-        if (dynamic_cast<XRecord *>(item) && !writeXRecords())
+        if (object_cast<XRecord>(item) && !writeXRecords())
         {
             continue;
         }
@@ -333,9 +454,10 @@ void DwgObjectWriter::writeImageDefinition(ImageDefinition *definition)
     _writer->write2RawDouble(definition->defaultSize());
 }
 
+template<typename V>
 void DwgObjectWriter::writeLayout(Layout *layout)
 {
-    writePlotSettings(layout);
+    writePlotSettings<V>(layout);
 
     //Common:
     //Layout name TV 1 layout name
@@ -360,7 +482,7 @@ void DwgObjectWriter::writeLayout(Layout *layout)
     _writer->write3BitDouble(layout->maxExtents());
 
     //R2004 +:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Viewport count RL # of viewports in this layout
         _writer->writeBitLong(layout->viewports().size());
@@ -389,7 +511,7 @@ void DwgObjectWriter::writeLayout(Layout *layout)
     }
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         for (auto &&viewport: layout->viewports())
         {
@@ -399,6 +521,7 @@ void DwgObjectWriter::writeLayout(Layout *layout)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeMLineStyle(MLineStyle *mlineStyle)
 {
     //Common:
@@ -460,7 +583,7 @@ void DwgObjectWriter::writeMLineStyle(MLineStyle *mlineStyle)
         //Color CMC Color of this segment
         _writer->writeCmColor(element.color);
         //R2018+:
-        if (R2018Plus)
+        if constexpr (V::R2018Plus)
         {
             //Line type handle H Line type handle (hard pointer)
             _writer->handleReference(DwgReferenceType::HardPointer, element.lineType);
@@ -475,9 +598,10 @@ void DwgObjectWriter::writeMLineStyle(MLineStyle *mlineStyle)
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeMultiLeaderStyle(MultiLeaderStyle *mLeaderStyle)
 {
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //	BS	179	Version expected: 2
         _writer->writeBitShort(2);
@@ -573,7 +697,7 @@ void DwgObjectWriter::writeMultiLeaderStyle(MultiLeaderStyle *mLeaderStyle)
     //	BD	143	Break size
     _writer->writeBitDouble(mLeaderStyle->breakGapSize());
 
-    if (R2010Plus)
+    if constexpr (V::R2010Plus)
     {
         //	BS	271	Attachment direction (see paragraph on LEADER for more details).
         _writer->writeBitShort((short) mLeaderStyle->textAttachmentDirection());
@@ -583,13 +707,14 @@ void DwgObjectWriter::writeMultiLeaderStyle(MultiLeaderStyle *mLeaderStyle)
         _writer->writeBitShort((short) mLeaderStyle->textTopAttachment());
     }
 
-    if (R2013Plus)
+    if constexpr (V::R2013Plus)
     {
         //	B	298 Undocumented, found in DXF
         _writer->writeBit(mLeaderStyle->unknownFlag298());
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writePlotSettings(PlotSettings *plot)
 {
     //Common:
@@ -636,7 +761,7 @@ void DwgObjectWriter::writePlotSettings(PlotSettings *plot)
     _writer->writeBitDouble(plot->windowUpperLeftY());
 
     //R13 - R2000 Only:
-    if (_version >= ACadVersion::AC1012 && _version <= ACadVersion::AC1015)
+    if constexpr (V::version >= ACadVersion::AC1012 && V::version <= ACadVersion::AC1015)
     {
         //Plot view name T 6 plotsettings plot view name
         _writer->writeVariableText(plot->plotViewName());
@@ -657,7 +782,7 @@ void DwgObjectWriter::writePlotSettings(PlotSettings *plot)
     _writer->write2BitDouble(plot->paperImageOrigin());
 
     //R2004+:
-    if (R2004Plus)
+    if constexpr (V::R2004Plus)
     {
         //Shade plot mode BS 76
         _writer->writeBitShort((short) plot->shadePlotMode());
@@ -671,7 +796,7 @@ void DwgObjectWriter::writePlotSettings(PlotSettings *plot)
     }
 
     //R2007 +:
-    if (R2007Plus)
+    if constexpr (V::R2007Plus)
     {
         //Visual Style handle(soft pointer)
         _writer->handleReference(DwgReferenceType::SoftPointer, nullptr);
@@ -713,6 +838,7 @@ void DwgObjectWriter::writeSortEntitiesTable(SortEntitiesTable *sortEntitiesTabl
     }
 }
 
+template<typename V>
 void DwgObjectWriter::writeXRecord(XRecord *xrecord)
 {
     std::unique_ptr<std::stringstream> stream = std::make_unique<std::stringstream>();
@@ -779,7 +905,7 @@ void DwgObjectWriter::writeXRecord(XRecord *xrecord)
             case GroupCodeValueType::Handle:
                 {
                     std::string text = entry.value.convert<std::string>();
-                    if (R2007Plus)
+                    if constexpr (V::R2007Plus)
                     {
                         if (text.empty())
                         {
@@ -821,7 +947,7 @@ void DwgObjectWriter::writeXRecord(XRecord *xrecord)
     _writer->writeBytes(ms.buffer());
 
     //R2000+:
-    if (R2000Plus)
+    if constexpr (V::R2000Plus)
     {
         //Cloning flag BS 280
         _writer->writeBitShort((short) xrecord->cloningFlags());
@@ -0,0 +1,160 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <cstring>
+#include <dwg/io/dxf/DxfCaretEscape_p.h>
+
+namespace dwg {
+
+std::size_t DxfCaretEscape::findEscaped(std::string_view str)
+{
+    static constexpr unsigned long long ones = 0x0101010101010101ULL;
+    static constexpr unsigned long long highs = 0x8080808080808080ULL;
+
+    const char *data = str.data();
+    std::size_t size = str.size();
+    std::size_t i = 0;
+
+    //Eight bytes at a time, a word flagged as having a caret or a byte below 0x0E is
+    //checked byte by byte, most text has neither
+    for (; i + 8 <= size; i += 8)
+    {
+        unsigned long long word;
+        std::memcpy(&word, data + i, 8);
+        unsigned long long carets = word ^ (ones * '^');
+        unsigned long long flags = ((carets - ones) & ~carets) | ((word - ones * 0x0E) & ~word);
+        if ((flags & highs) == 0)
+        {
+            continue;
+        }
+
+        for (std::size_t j = i; j < i + 8; ++j)
+        {
+            if (isEscaped(data[j]))
+            {
+                return j;
+            }
+        }
+    }
+
+    for (; i < size; ++i)
+    {
+        if (isEscaped(data[i]))
+        {
+            return i;
+        }
+    }
+    return std::string_view::npos;
+}
+
+std::string DxfCaretEscape::escape(std::string_view str)
+{
+    std::size_t first = findEscaped(str);
+    if (first == std::string_view::npos)
+    {
+        return std::string(str);
+    }
+    return escape(str, first);
+}
+
+std::string DxfCaretEscape::escape(std::string_view str, std::size_t first)
+{
+    std::string result;
+    result.reserve(str.size() + 8);
+    result.append(str.data(), first);
+    for (char c: str.substr(first))
+    {
+        switch (c)
+        {
+            case '^':
+                result.append("^ ");
+                break;
+            case '\n':
+                result.append("^J");
+                break;
+            case '\r':
+                result.append("^M");
+                break;
+            case '\t':
+                result.append("^I");
+                break;
+            default:
+                result.push_back(c);
+                break;
+        }
+    }
+    return result;
+}
+
+std::string DxfCaretEscape::unescape(std::string_view str)
+{
+    const char *caret = static_cast<const char *>(std::memchr(str.data(), '^', str.size()));
+    if (!caret)
+    {
+        return std::string(str);
+    }
+
+    std::string result;
+    result.reserve(str.size());
+
+    const char *current = str.data();
+    const char *end = str.data() + str.size();
+    while (caret)
+    {
+        //Copy up to the caret, then the character it stands for
+        result.append(current, caret);
+        char next = caret + 1 < end ? caret[1] : '\0';
+        switch (next)
+        {
+            case 'J':
+                result.push_back('\n');
+                current = caret + 2;
+                break;
+            case 'M':
+                result.push_back('\r');
+                current = caret + 2;
+                break;
+            case 'I':
+                result.push_back('\t');
+                current = caret + 2;
+                break;
+            case ' ':
+                result.push_back('^');
+                current = caret + 2;
+                break;
+            default:
+                result.push_back('^');
+                current = caret + 1;
+                break;
+        }
+        caret = static_cast<const char *>(std::memchr(current, '^', end - current));
+    }
+    result.append(current, end);
+    return result;
+}
+
+bool DxfCaretEscape::isEscaped(char c)
+{
+    return c == '^' || c == '\n' || c == '\r' || c == '\t';
+}
+
+}// namespace dwg
@@ -20,7 +20,9 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <algorithm>
 #include <dwg/CadDocument.h>
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/CadSummaryInfo.h>
 #include <dwg/CadSystemVariables_p.h>
 #include <dwg/CadUtils.h>
@@ -31,10 +33,18 @@
 #include <dwg/io/dxf/DxfReader.h>
 #include <dwg/io/dxf/readers/DxfBinaryReaderAC1009_p.h>
 #include <dwg/io/dxf/readers/DxfBinaryReader_p.h>
+#include <dwg/io/dxf/readers/DxfEntitiesSectionReader_p.h>
+#include <dwg/io/dxf/readers/DxfObjectsSectionReader_p.h>
+#include <dwg/io/dxf/readers/DxfSectionIndex_p.h>
 #include <dwg/io/dxf/readers/DxfTextReader_p.h>
 #include <dwg/io/dxf/readers/IDxfStreamReader_p.h>
+#include <dwg/io/template/CadEntityTemplate_p.h>
 #include <dwg/utils/StreamWrapper.h>
 #include <fmt/core.h>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <thread>
 
 namespace dwg {
 
@@ -57,6 +67,14 @@ bool DxfReader::isBinary() const
 CadDocument *DxfReader::read()
 {
     _document = new CadDocument(false);
+    //The configured resource only feeds the pool of the document, see CadMemoryScope
+    _document->setMemoryResource(CadMemoryScope::createPool(memoryResource()));
+    if (!_templateResource)
+    {
+        _templateResource = CadMemoryScope::createPool();
+    }
+    CadMemoryScope scope(_document->memoryResource().get(), _templateResource.get());
+
     _document->setSummaryInfo(new CadSummaryInfo());
     if (!_reader)
     {
@@ -64,85 +82,398 @@ CadDocument *DxfReader::read()
     }
     _builder = new DxfDocumentBuilder(_version, _document, *this);
     _builder->OnNotification.add(this, &DxfReader::triggerNotification);
-    while (_reader->valueAsString() != DxfFileToken::EndOfFile)
+
+    if (DxfTextReader *textReader = dynamic_cast<DxfTextReader *>(_reader))
     {
-        if (_reader->valueAsString() != DxfFileToken::BeginSection)
+        readSections(textReader);
+    }
+    else
+    {
+        while (_reader->valueAsStringView() != DxfFileToken::EndOfFile)
         {
+            if (_reader->valueAsStringView() != DxfFileToken::BeginSection)
+            {
+                _reader->readNext();
+                continue;
+            }
+            else
+            {
+                _reader->readNext();
+            }
+
+            readSection(std::string(_reader->valueAsStringView()), _reader);
             _reader->readNext();
-            continue;
         }
-        else
+    }
+
+    if (!_document->header())
+    {
+        _document->setHeader(new CadHeader(_document));
+    }
+    _builder->buildDocument();
+
+    return _document;
+}
+
+CadHeader *DxfReader::readHeader()
+{
+    _reader = goToSection(DxfFileToken::HeaderSection);
+    return readHeader(_reader);
+}
+
+CadDocument *DxfReader::readTables()
+{
+    _reader = goToSection(DxfFileToken::TablesSection);
+    readTables(_reader);
+    return nullptr;
+}
+
+std::vector<Entity *> DxfReader::readEntities()
+{
+    _reader = goToSection(DxfFileToken::EntitiesSection);
+    readEntitiesPrivate(_reader);
+    return std::vector<Entity *>();
+}
+
+DxfHeaderSummary DxfReader::probe()
+{
+    StreamWrapper wrapper(_fileStream);
+    bool isBinary = IsBinary(_fileStream, false);
+    bool isAC1009Format = false;
+    if (isBinary && wrapper.readByte() != -1)
+    {
+        int flag = wrapper.readByte();
+        isAC1009Format = flag != -1 && flag != 0;
+    }
+
+    _fileStream->clear();
+    _fileStream->seekg(0, std::ios::beg);
+
+    //Each attempt reads a block twice as large as the previous one and parses the prefix again,
+    //the total work stays proportional to the header
+    DxfHeaderSummary summary;
+    std::string prefix;
+    for (std::size_t blockSize = ProbeBlockSize;; blockSize *= 2)
+    {
+        std::size_t offset = prefix.size();
+        prefix.resize(offset + blockSize);
+        _fileStream->read(prefix.data() + offset, blockSize);
+        prefix.resize(offset + static_cast<std::size_t>(_fileStream->gcount()));
+        bool complete = prefix.size() < offset + blockSize;
+
+        //A text line cut by the block would be read as a shorter value
+        std::size_t length = prefix.size();
+        if (!isBinary && !complete)
         {
-            _reader->readNext();
+            std::size_t lineEnd = prefix.rfind('\n');
+            length = lineEnd == std::string::npos ? 0 : lineEnd + 1;
         }
 
-        std::string v = _reader->valueAsString();
-        if (v == DxfFileToken::HeaderSection)
+        std::stringstream stream(prefix.substr(0, length));
+        std::unique_ptr<IDxfStreamReader> reader(createReader(&stream, isBinary, isAC1009Format));
+
+        summary = DxfHeaderSummary();
+        summary.isBinary = isBinary;
+        if (probeHeader(reader.get(), summary) || complete)
         {
-            _document->setHeader(readHeader());
-            _document->header()->setDocument(_document);
-            _builder->setInitialHandSeed(_document->header()->handleSeed());
+            break;
         }
-        else if (v == DxfFileToken::ClassesSection)
+    }
+
+    _fileStream->clear();
+    _fileStream->seekg(0, std::ios::beg);
+    return summary;
+}
+
+bool DxfReader::probeHeader(IDxfStreamReader *reader, DxfHeaderSummary &summary)
+{
+    //The header is the first section, any other one means there is no header to read
+    reader->readNext();
+    while (reader->valueAsStringView() != DxfFileToken::BeginSection)
+    {
+        if (reader->valueAsStringView() == DxfFileToken::EndOfFile)
         {
-            _document->setClasses(readClasses());
+            return false;
         }
-        else if (v == DxfFileToken::TablesSection)
+        reader->readNext();
+    }
+
+    reader->readNext();
+    if (reader->valueAsStringView() != DxfFileToken::HeaderSection)
+    {
+        return reader->valueAsStringView() != DxfFileToken::EndOfFile;
+    }
+
+    std::string variable;
+    reader->readNext();
+    while (reader->dxfCode() != DxfCode::Start)
+    {
+        if (reader->dxfCode() == DxfCode::CLShapeText)
+        {
+            variable = reader->valueAsString();
+        }
+        else if (variable == CadSystemVariables::ACADVER)
         {
-            readTables();
+            summary.versionName = reader->valueAsString();
+            summary.version = CadUtils::GetVersionFromName(summary.versionName);
         }
-        else if (v == DxfFileToken::BlocksSection)
+        else if (variable == CadSystemVariables::DWGCODEPAGE)
         {
-            readBlocks();
+            summary.codePage = reader->valueAsString();
         }
-        else if (v == DxfFileToken::EntitiesSection)
+        else if (variable == CadSystemVariables::EXTMIN || variable == CadSystemVariables::EXTMAX)
         {
-            readEntities();
+            XYZ &point = variable == CadSystemVariables::EXTMIN ? summary.extMin : summary.extMax;
+            switch (reader->code())
+            {
+                case 10:
+                    point.X = reader->valueAsDouble();
+                    break;
+                case 20:
+                    point.Y = reader->valueAsDouble();
+                    break;
+                case 30:
+                    point.Z = reader->valueAsDouble();
+                    break;
+                default:
+                    break;
+            }
         }
-        else if (v == DxfFileToken::ObjectsSection)
+        else if (variable == CadSystemVariables::INSUNITS)
         {
-            readObjects();
+            summary.insUnits = static_cast<UnitsType>(reader->valueAsShort());
         }
-        else
+        else if (variable == CadSystemVariables::HANDSEED)
         {
-            triggerNotification(fmt::format("Section not implemented {}", v), Notification::NotImplemented);
+            summary.handleSeed = reader->valueAsHandle();
         }
-        _reader->readNext();
+
+        reader->readNext();
     }
 
-    if (!_document->header())
+    //The prefix ended before the ENDSEC of the header
+    return reader->valueAsStringView() == DxfFileToken::EndSection;
+}
+
+bool DxfReader::IsBinary(const std::string &filename)
+{
+    std::fstream ifs(filename);
+    bool result = IsBinary(&ifs);
+    ifs.close();
+    return result;
+}
+
+bool DxfReader::IsBinary(std::iostream *stream, bool resetPos)
+{
+    stream->seekg(std::ios::beg);
+    StreamWrapper wrapper(stream);
+    std::string sn = wrapper.readString(DxfBinaryReader::Sentinel.length());
+    bool isBinary = (sn == DxfBinaryReader::Sentinel);
+
+    if (resetPos)
     {
-        _document->setHeader(new CadHeader(_document));
+        stream->seekg(std::ios::beg);
     }
-    _builder->buildDocument();
+    return isBinary;
+}
 
-    return _document;
+void DxfReader::readSections(DxfTextReader *reader)
+{
+    const DxfSectionIndex &index = reader->sectionIndex();
+
+    //The header and the classes do not depend on the document, each one is parsed
+    //in its own task with an independent reader over the shared buffer
+    std::future<CadHeader *> header;
+    std::future<DxfClassCollection *> classes;
+    for (const DxfSectionRange &section: index.sections())
+    {
+        std::shared_ptr<IDxfStreamReader> sectionReader;
+        if (section.name == DxfFileToken::HeaderSection && !header.valid())
+        {
+            sectionReader.reset(reader->createSectionReader(section));
+            header = std::async(std::launch::async, [this, sectionReader]() {
+                sectionReader->readNext();
+                return readHeader(sectionReader.get());
+            });
+        }
+        else if (section.name == DxfFileToken::ClassesSection && !classes.valid())
+        {
+            sectionReader.reset(reader->createSectionReader(section));
+            classes = std::async(std::launch::async, [this, sectionReader]() {
+                sectionReader->readNext();
+                return readClasses(sectionReader.get());
+            });
+        }
+    }
+
+    //The rest of the sections add objects to the document. ENTITIES and OBJECTS are parsed into
+    //templates on the workers and merged in file order, the others are read on this thread.
+    std::vector<const DxfSectionRange *> chunked;
+    for (const DxfSectionRange &section: index.sections())
+    {
+        if (section.name == DxfFileToken::HeaderSection || section.name == DxfFileToken::ClassesSection)
+        {
+            continue;
+        }
+
+        if (parallelSections() &&
+            (section.name == DxfFileToken::EntitiesSection || section.name == DxfFileToken::ObjectsSection))
+        {
+            chunked.push_back(&section);
+            continue;
+        }
+
+        std::unique_ptr<IDxfStreamReader> sectionReader(reader->createSectionReader(section));
+        sectionReader->readNext();
+        readSection(section.name, sectionReader.get());
+    }
+
+    if (!chunked.empty())
+    {
+        readChunks(reader, chunked);
+    }
+
+    if (header.valid())
+    {
+        _document->setHeader(header.get());
+        _document->header()->setDocument(_document);
+        _builder->setInitialHandSeed(_document->header()->handleSeed());
+    }
+
+    if (classes.valid())
+    {
+        _document->setClasses(classes.get());
+    }
 }
 
-CadHeader *DxfReader::readHeader()
+void DxfReader::readChunks(DxfTextReader *reader, const std::vector<const DxfSectionRange *> &sections)
 {
-    _reader = goToSection(DxfFileToken::HeaderSection);
+    struct Chunk
+    {
+        DxfSectionRange range;
+        bool first;
+    };
+
+    //The chunks of all the sections share the workers, each one is parsed into its own slot
+    std::vector<Chunk> chunks;
+    for (const DxfSectionRange *section: sections)
+    {
+        for (DxfSectionRange &range: DxfSectionIndex::Chunks(*section))
+        {
+            bool first = range.begin == section->begin;
+            chunks.push_back({std::move(range), first});
+        }
+    }
+
+    std::vector<std::vector<CadEntityTemplate *>> entities(chunks.size());
+    std::vector<std::vector<CadTemplate *>> objects(chunks.size());
+    auto readChunk = [&](std::size_t i) {
+        std::unique_ptr<IDxfStreamReader> chunkReader(reader->createSectionReader(chunks[i].range));
+        chunkReader->readNext();
+        if (chunks[i].first)
+        {
+            //The first chunk starts with the section name
+            chunkReader->readNext();
+        }
+
+        if (chunks[i].range.name == DxfFileToken::EntitiesSection)
+        {
+            entities[i] = DxfEntitiesSectionReader(chunkReader.get(), _builder).readTemplates();
+        }
+        else
+        {
+            objects[i] = DxfObjectsSectionReader(chunkReader.get(), _builder).readTemplates();
+        }
+    };
 
+    //The workers allocate from the same resources as the calling thread
+    std::pmr::memory_resource *objectResource = CadMemoryScope::objectResource();
+    std::pmr::memory_resource *templateResource = CadMemoryScope::templateResource();
+
+    std::size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, chunks.size());
+    std::vector<std::future<void>> tasks;
+    for (std::size_t w = 0; w < workers; ++w)
+    {
+        tasks.push_back(std::async(std::launch::async, [&, w]() {
+            CadMemoryScope scope(objectResource, templateResource);
+            for (std::size_t i = w; i < chunks.size(); i += workers)
+            {
+                readChunk(i);
+            }
+        }));
+    }
+    for (std::future<void> &task: tasks)
+    {
+        task.get();
+    }
+
+    //Handles and owners are resolved later by the builder, only the order matters here
+    DxfEntitiesSectionReader entitiesReader(nullptr, _builder);
+    DxfObjectsSectionReader objectsReader(nullptr, _builder);
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        entitiesReader.addTemplates(entities[i]);
+        objectsReader.addTemplates(objects[i]);
+    }
+}
+
+void DxfReader::readSection(const std::string &name, IDxfStreamReader *reader)
+{
+    if (name == DxfFileToken::HeaderSection)
+    {
+        _document->setHeader(readHeader(reader));
+        _document->header()->setDocument(_document);
+        _builder->setInitialHandSeed(_document->header()->handleSeed());
+    }
+    else if (name == DxfFileToken::ClassesSection)
+    {
+        _document->setClasses(readClasses(reader));
+    }
+    else if (name == DxfFileToken::TablesSection)
+    {
+        readTables(reader);
+    }
+    else if (name == DxfFileToken::BlocksSection)
+    {
+        readBlocks(reader);
+    }
+    else if (name == DxfFileToken::EntitiesSection)
+    {
+        readEntitiesPrivate(reader);
+    }
+    else if (name == DxfFileToken::ObjectsSection)
+    {
+        readObjects(reader);
+    }
+    else
+    {
+        triggerNotification(fmt::format("Section not implemented {}", name), Notification::NotImplemented);
+    }
+}
+
+CadHeader *DxfReader::readHeader(IDxfStreamReader *reader)
+{
     CadHeader *header = new CadHeader();
 
     auto &&headerMap = CadSystemVariables::headerMap();
 
     //Loop until the section ends
-    while (_reader->valueAsString() != DxfFileToken::EndSection)
+    while (reader->valueAsStringView() != DxfFileToken::EndSection)
     {
         //Get the current header variable
-        std::string currVar = _reader->valueAsString();
+        std::string currVar(reader->valueAsStringView());
 
-        if (_reader->valueAsString().empty())
+        if (reader->valueAsStringView().empty())
         {
-            _reader->readNext();
+            reader->readNext();
             continue;
         }
 
         auto it = headerMap.find(currVar);
         if (it == headerMap.end())
         {
-            _reader->readNext();
+            reader->readNext();
             continue;
         }
         const CadSystemVariableAttribute data = it->second;
@@ -150,8 +481,8 @@ CadHeader *DxfReader::readHeader()
         std::vector<DwgVariant> parameters(data.valueCodes().size(), DwgVariant());
         for (int i = 0; i < data.valueCodes().size(); ++i)
         {
-            _reader->readNext();
-            if (_reader->dxfCode() == DxfCode::CLShapeText)
+            reader->readNext();
+            if (reader->dxfCode() == DxfCode::CLShapeText)
             {
                 //Irregular dxf files may not follow the header type
                 int c = (int) data.valueCodes().at(i);
@@ -178,7 +509,7 @@ CadHeader *DxfReader::readHeader()
                 break;
             }
 
-            parameters[i] = _reader->value();
+            parameters[i] = reader->value();
         }
 
         //Set the header value by name
@@ -190,64 +521,42 @@ CadHeader *DxfReader::readHeader()
         {
         }
 
-        if (_reader->dxfCode() != DxfCode::CLShapeText)
+        if (reader->dxfCode() != DxfCode::CLShapeText)
         {
-            _reader->readNext();
+            reader->readNext();
         }
     }
 
     return header;
 }
 
-CadDocument *DxfReader::readTables()
+DxfClassCollection *DxfReader::readClasses(IDxfStreamReader *)
 {
     return nullptr;
 }
 
-std::vector<Entity *> DxfReader::readEntities()
+DxfClass *DxfReader::readClass(IDxfStreamReader *)
 {
-    return std::vector<Entity *>();
+    return nullptr;
 }
 
-bool DxfReader::IsBinary(const std::string &filename)
-{
-    std::fstream ifs(filename);
-    bool result = IsBinary(&ifs);
-    ifs.close();
-    return result;
-}
+void DxfReader::readTables(IDxfStreamReader *) {}
 
-bool DxfReader::IsBinary(std::iostream *stream, bool resetPos)
-{
-    stream->seekg(std::ios::beg);
-    StreamWrapper wrapper(stream);
-    std::string sn = wrapper.readString(DxfBinaryReader::Sentinel.length());
-    bool isBinary = (sn == DxfBinaryReader::Sentinel);
-
-    if (resetPos)
-    {
-        stream->seekg(std::ios::beg);
-    }
-    return isBinary;
-}
+void DxfReader::readBlocks(IDxfStreamReader *) {}
 
-DxfClassCollection *DxfReader::readClasses()
+void DxfReader::readEntitiesPrivate(IDxfStreamReader *reader)
 {
-    return nullptr;
+    DxfEntitiesSectionReader sectionReader(reader, _builder);
+    sectionReader.read();
 }
 
-DxfClass *DxfReader::readClass()
+void DxfReader::readObjects(IDxfStreamReader *reader)
 {
-    return nullptr;
+    DxfObjectsSectionReader sectionReader(reader, _builder);
+    sectionReader.read();
 }
 
-void DxfReader::readBlocks() {}
-
-void DxfReader::readEntitiesPrivate() {}
-
-void DxfReader::readObjects() {}
-
-void DxfReader::readThumbnailImage() {}
+void DxfReader::readThumbnailImage(IDxfStreamReader *) {}
 
 IDxfStreamReader *DxfReader::getReader()
 {
@@ -268,6 +577,30 @@ IDxfStreamReader *DxfReader::getReader()
     }
 
     tmpReader = createReader(isBinary, isA1009Format);
+    if (DxfTextReader *textReader = dynamic_cast<DxfTextReader *>(tmpReader))
+    {
+        //The section index has the version and the code page, no need for a second pass
+        const DxfSectionIndex &index = textReader->sectionIndex();
+        if (!index.find(DxfFileToken::HeaderSection))
+        {
+            return textReader;
+        }
+
+        if (!index.acadVersion().empty())
+        {
+            readVersion(index.acadVersion());
+        }
+
+        if (_version <= ACadVersion::AC1021 && !index.codePage().empty())
+        {
+            CodePage code = CadUtils::GetCodePageByString(index.codePage());
+            _encoding = getListedEncoding((int) code);
+        }
+
+        textReader->setEncoding(_encoding.codePage() == CodePage::Unknown ? Encoding(CodePage::Usascii) : _encoding);
+        return textReader;
+    }
+
     if (!tmpReader->find(DxfFileToken::HeaderSection))
     {
         _version = ACadVersion::Unknown;
@@ -275,35 +608,21 @@ IDxfStreamReader *DxfReader::getReader()
         return tmpReader;
     }
 
-    while (tmpReader->valueAsString() != DxfFileToken::EndSection)
+    while (tmpReader->valueAsStringView() != DxfFileToken::EndSection)
     {
-        if (tmpReader->valueAsString() == "$ACADVER")
+        if (tmpReader->valueAsStringView() == "$ACADVER")
         {
             tmpReader->readNext();
-            _version = CadUtils::GetVersionFromName(tmpReader->valueAsString());
+            readVersion(std::string(tmpReader->valueAsStringView()));
             if (_version > ACadVersion::AC1021)
             {
-                _encoding = Encoding(CodePage::Utf8);
                 break;
             }
-
-            if (_version < ACadVersion::AC1002)
-            {
-                if (_version == ACadVersion::Unknown)
-                {
-                    throw std::runtime_error("Not support");
-                }
-                else
-                {
-                    throw std::runtime_error(
-                            fmt::format("Not support version: {}", CadUtils::GetNameFromVersion(_version)));
-                }
-            }
         }
-        else if (tmpReader->valueAsString() == "$DWGCODEPAGE")
+        else if (tmpReader->valueAsStringView() == "$DWGCODEPAGE")
         {
             tmpReader->readNext();
-            std::string encoding = tmpReader->valueAsString();
+            std::string encoding(tmpReader->valueAsStringView());
             CodePage code = CadUtils::GetCodePageByString(encoding);
             _encoding = getListedEncoding((int) code);
             break;
@@ -315,6 +634,28 @@ IDxfStreamReader *DxfReader::getReader()
     return createReader(isBinary, isA1009Format);
 }
 
+void DxfReader::readVersion(const std::string &name)
+{
+    _version = CadUtils::GetVersionFromName(name);
+    if (_version > ACadVersion::AC1021)
+    {
+        _encoding = Encoding(CodePage::Utf8);
+        return;
+    }
+
+    if (_version < ACadVersion::AC1002)
+    {
+        if (_version == ACadVersion::Unknown)
+        {
+            throw std::runtime_error("Not support");
+        }
+        else
+        {
+            throw std::runtime_error(fmt::format("Not support version: {}", CadUtils::GetNameFromVersion(_version)));
+        }
+    }
+}
+
 IDxfStreamReader *DxfReader::goToSection(const std::string &sectionName)
 {
     if (!_reader)
@@ -322,14 +663,34 @@ IDxfStreamReader *DxfReader::goToSection(const std::string &sectionName)
         _reader = getReader();
     }
 
-    if (_reader->valueAsString() == sectionName)
+    if (_reader->valueAsStringView() == sectionName)
         return _reader;
 
+    if (DxfTextReader *textReader = dynamic_cast<DxfTextReader *>(_reader))
+    {
+        const DxfSectionRange *section = textReader->sectionIndex().find(sectionName);
+        if (section)
+        {
+            textReader->seekSection(*section);
+            textReader->readNext();
+        }
+        else
+        {
+            textReader->find(sectionName);
+        }
+        return _reader;
+    }
+
     _reader->find(sectionName);
     return _reader;
 }
 
 IDxfStreamReader *DxfReader::createReader(bool isBinary, bool isAC1009Format)
+{
+    return createReader(_fileStream, isBinary, isAC1009Format);
+}
+
+IDxfStreamReader *DxfReader::createReader(std::iostream *stream, bool isBinary, bool isAC1009Format)
 {
     Encoding encoding = _encoding;
     if (encoding.codePage() == CodePage::Unknown)
@@ -341,16 +702,16 @@ IDxfStreamReader *DxfReader::createReader(bool isBinary, bool isAC1009Format)
     {
         if (isAC1009Format)
         {
-            return new DxfBinaryReaderAC1009(_fileStream, encoding);
+            return new DxfBinaryReaderAC1009(stream, encoding);
         }
         else
         {
-            return new DxfBinaryReader(_fileStream, encoding);
+            return new DxfBinaryReader(stream, encoding);
         }
     }
     else
     {
-        return new DxfTextReader(_fileStream, encoding);
+        return new DxfTextReader(stream, encoding);
     }
 }
 
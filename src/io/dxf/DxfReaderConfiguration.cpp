@@ -24,7 +24,7 @@
 
 namespace dwg {
 
-DxfReaderConfiguration::DxfReaderConfiguration() {}
+DxfReaderConfiguration::DxfReaderConfiguration() : _clearCache(false), _parallelSections(false) {}
 
 DxfReaderConfiguration::~DxfReaderConfiguration() {}
 
@@ -38,4 +38,14 @@ void DxfReaderConfiguration::setClearCache(bool value)
     _clearCache = value;
 }
 
+bool DxfReaderConfiguration::parallelSections() const
+{
+    return _parallelSections;
+}
+
+void DxfReaderConfiguration::setParallelSections(bool value)
+{
+    _parallelSections = value;
+}
+
 }// namespace dwg
\ No newline at end of file
@@ -0,0 +1,298 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadDocument.h>
+#include <dwg/DxfCode.h>
+#include <dwg/DxfFileToken_p.h>
+#include <dwg/DxfSubclassMarker_p.h>
+#include <dwg/classes/DxfClassCollection.h>
+#include <dwg/entities/AttributeEntity.h>
+#include <dwg/entities/Entity.h>
+#include <dwg/entities/Insert.h>
+#include <dwg/entities/PolyLine.h>
+#include <dwg/entities/Seqend.h>
+#include <dwg/entities/Vertex.h>
+#include <dwg/entities/collection/AttributeEntitySeqendCollection.h>
+#include <dwg/entities/collection/VertexSeqendCollection.h>
+#include <dwg/header/CadHeader.h>
+#include <dwg/io/dxf/CadObjectHolder_p.h>
+#include <dwg/io/dxf/DxfStreamingWriter.h>
+#include <dwg/io/dxf/writers/DxfAsciiWriter_p.h>
+#include <dwg/io/dxf/writers/DxfBinaryWriter_p.h>
+#include <dwg/io/dxf/writers/DxfBlocksSectionWriter_p.h>
+#include <dwg/io/dxf/writers/DxfClassesSectionWriter_p.h>
+#include <dwg/io/dxf/writers/DxfEntitiesSectionWriter_p.h>
+#include <dwg/io/dxf/writers/DxfHeaderSectionWriter_p.h>
+#include <dwg/io/dxf/writers/DxfObjectsSectionWriter_p.h>
+#include <dwg/io/dxf/writers/DxfTablesSectionWriter_p.h>
+#include <dwg/objects/CadDictionary.h>
+#include <dwg/tables/BlockRecord.h>
+#include <dwg/tables/collections/LayersTable.h>
+#include <fmt/core.h>
+#include <stdexcept>
+
+namespace dwg {
+
+DxfStreamingWriter::DxfStreamingWriter(const std::string &filename, bool binary)
+    : DxfStreamingWriter(new std::fstream(filename, binary ? std::ios::out | std::ios::binary : std::ios::out), binary)
+{
+    _ownsStream = true;
+}
+
+DxfStreamingWriter::DxfStreamingWriter(std::fstream *stream, bool binary) : _stream(stream), _binary(binary) {}
+
+DxfStreamingWriter::~DxfStreamingWriter()
+{
+    //A writer that was not closed still ends the file, the destructor must not throw
+    if (_entities)
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+            _writer->flush();
+        }
+    }
+
+    delete _entities;
+    delete _holder;
+    delete _writer;
+    if (_ownsStream)
+    {
+        delete _stream;
+    }
+}
+
+unsigned long long DxfStreamingWriter::handleCapacity() const
+{
+    return _handleCapacity;
+}
+
+void DxfStreamingWriter::setHandleCapacity(unsigned long long value)
+{
+    _handleCapacity = value;
+}
+
+void DxfStreamingWriter::open(CadDocument *document)
+{
+    if (_writer)
+    {
+        throw std::runtime_error("The streaming writer is already open");
+    }
+
+    _document = document;
+    DxfClassCollection::UpdateDxfClasses(_document);
+
+    //The handles of the streamed entities are reserved in the written $HANDSEED only,
+    //the header of the document keeps its seed
+    _nextHandle = _document->header()->handleSeed();
+    _lastHandle = _nextHandle + _handleCapacity;
+
+    if (_binary)
+    {
+        _writer = new DxfBinaryWriter(_stream, Encoding(CodePage::Utf8));
+    }
+    else
+    {
+        DxfAsciiWriter *writer = new DxfAsciiWriter(_stream, Encoding(CodePage::Utf8));
+        writer->setDoublePrecision(doublePrecision());
+        _writer = writer;
+    }
+
+    _holder = new CadObjectHolder();
+    _holder->objects().push(_document->rootDictionary());
+
+    DxfHeaderSectionWriter headerWriter(_writer, _document, _holder, *this);
+    headerWriter.setHandleSeed(_lastHandle);
+    headerWriter.write();
+    DxfClassesSectionWriter(_writer, _document, _holder, *this).write();
+    DxfTablesSectionWriter(_writer, _document, _holder, *this).write();
+    DxfBlocksSectionWriter(_writer, _document, _holder, *this).write();
+
+    _writer->write(DxfCode::Start, DxfFileToken::BeginSection);
+    _writer->write(DxfCode::SymbolTableName, DxfFileToken::EntitiesSection);
+
+    //Entities already in the document go first
+    _entities = new DxfEntitiesSectionWriter(_writer, _document, _holder, *this);
+    while (!_holder->entities().empty())
+    {
+        _entities->append(_holder->entities().front());
+        _holder->entities().pop();
+    }
+}
+
+unsigned long long DxfStreamingWriter::append(Entity *entity)
+{
+    if (!_entities)
+    {
+        throw std::runtime_error("The streaming writer is not open");
+    }
+
+    unsigned long long handle = nextHandle();
+    entity->setHandle(handle);
+    if (!entity->owner())
+    {
+        entity->setOwner(_document->modelSpace());
+    }
+    assignSubEntityHandles(entity);
+
+    _entities->append(entity);
+    return handle;
+}
+
+unsigned long long DxfStreamingWriter::appendPoint(const XYZ &location, const std::string &layer)
+{
+    checkLayer(layer);
+    unsigned long long handle = nextHandle();
+    writeEntityStart(DxfFileToken::EntityPoint, handle, layer, DxfSubclassMarker::Point);
+    _writer->write(10, location.X);
+    _writer->write(20, location.Y);
+    _writer->write(30, location.Z);
+    return handle;
+}
+
+unsigned long long DxfStreamingWriter::appendLine(const XYZ &start, const XYZ &end, const std::string &layer)
+{
+    checkLayer(layer);
+    unsigned long long handle = nextHandle();
+    writeEntityStart(DxfFileToken::EntityLine, handle, layer, DxfSubclassMarker::Line);
+    _writer->write(10, start.X);
+    _writer->write(20, start.Y);
+    _writer->write(30, start.Z);
+    _writer->write(11, end.X);
+    _writer->write(21, end.Y);
+    _writer->write(31, end.Z);
+    return handle;
+}
+
+unsigned long long DxfStreamingWriter::appendLwPolyline(const std::vector<XY> &vertices, bool closed,
+                                                        const std::string &layer)
+{
+    checkLayer(layer);
+    unsigned long long handle = nextHandle();
+    writeEntityStart(DxfFileToken::EntityLwPolyline, handle, layer, DxfSubclassMarker::LwPolyline);
+    _writer->write(90, (int) vertices.size());
+    _writer->write(70, (short) (closed ? 1 : 0));
+    for (const XY &v: vertices)
+    {
+        _writer->write(10, v.X);
+        _writer->write(20, v.Y);
+    }
+    return handle;
+}
+
+void DxfStreamingWriter::close()
+{
+    if (!_entities)
+    {
+        throw std::runtime_error("The streaming writer is not open");
+    }
+
+    _writer->write(DxfCode::Start, DxfFileToken::EndSection);
+    DxfObjectsSectionWriter(_writer, _document, _holder, *this).write();
+    _writer->write(DxfCode::Start, DxfFileToken::EndOfFile);
+    _writer->flush();
+    if (closeStream())
+    {
+        _writer->close();
+    }
+
+    delete _entities;
+    _entities = nullptr;
+}
+
+unsigned long long DxfStreamingWriter::nextHandle()
+{
+    if (!_entities)
+    {
+        throw std::runtime_error("The streaming writer is not open");
+    }
+
+    if (_nextHandle >= _lastHandle)
+    {
+        throw std::runtime_error(
+                fmt::format("The {} handles reserved for the streamed entities are used", _handleCapacity));
+    }
+    return _nextHandle++;
+}
+
+void DxfStreamingWriter::assignSubEntityHandles(Entity *entity)
+{
+    switch (entity->objectType())
+    {
+        case ObjectType::INSERT:
+        case ObjectType::MINSERT:
+            {
+                Insert *insert = static_cast<Insert *>(entity);
+                if (!insert->hasAttributes())
+                    break;
+
+                for (AttributeEntity *attribute: *insert->attributes())
+                {
+                    attribute->setHandle(nextHandle());
+                }
+                insert->attributes()->seqend()->setHandle(nextHandle());
+                break;
+            }
+        case ObjectType::POLYLINE_2D:
+        case ObjectType::POLYLINE_3D:
+        case ObjectType::POLYLINE_PFACE:
+        case ObjectType::POLYLINE_MESH:
+            {
+                Polyline *polyline = static_cast<Polyline *>(entity);
+                if (polyline->vertices()->empty())
+                    break;
+
+                for (Vertex *vertex: *polyline->vertices())
+                {
+                    vertex->setHandle(nextHandle());
+                }
+                polyline->vertices()->seqend()->setHandle(nextHandle());
+                break;
+            }
+        default:
+            break;
+    }
+}
+
+void DxfStreamingWriter::checkLayer(const std::string &layer) const
+{
+    if (!_document->layers()->contains(layer))
+    {
+        throw std::runtime_error(fmt::format("The layer {} is not in the layers table", layer));
+    }
+}
+
+void DxfStreamingWriter::writeEntityStart(const std::string &name, unsigned long long handle,
+                                          const std::string &layer, const std::string &subclass)
+{
+    _writer->write(DxfCode::Start, name);
+    _writer->write(DxfCode::Handle, handle);
+    _writer->write(DxfCode::SoftPointerId, _document->modelSpace()->handle());
+    _writer->write(DxfCode::Subclass, DxfSubclassMarker::Entity);
+    _writer->write(DxfCode::LayerName, layer);
+    _writer->write(DxfCode::Subclass, subclass);
+}
+
+}// namespace dwg
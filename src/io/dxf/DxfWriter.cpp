@@ -86,46 +86,59 @@ void DxfWriter::createStreamWriter()
     }
     else
     {
-        _writer = new DxfAsciiWriter(_stream, Encoding(CodePage::Utf8));
+        DxfAsciiWriter *writer = new DxfAsciiWriter(_stream, Encoding(CodePage::Utf8));
+        writer->setDoublePrecision(doublePrecision());
+        _writer = writer;
     }
 }
 
 void DxfWriter::writeHeader()
 {
     auto &&writer = std::make_unique<DxfHeaderSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeDxfClasses()
 {
     auto &&writer = std::make_unique<DxfClassesSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeTables()
 {
     auto &&writer = std::make_unique<DxfTablesSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeBlocks()
 {
     auto &&writer = std::make_unique<DxfBlocksSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeEntities()
 {
     auto &&writer = std::make_unique<DxfEntitiesSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeObjects()
 {
     auto &&writer = std::make_unique<DxfObjectsSectionWriter>(_writer, _document, _objectHolder, *this);
+    writer->OnNotification.add(this, &DxfWriter::triggerNotification);
     writer->write();
 }
 
 void DxfWriter::writeACDSData() {}
 
+void DxfWriter::triggerNotification(const std::string &message, Notification notificationType)
+{
+    OnNotification(message, notificationType);
+}
+
 }// namespace dwg
\ No newline at end of file
@@ -40,7 +40,8 @@ static std::vector<std::string> FixedVariables = {
         "$TDCREATE", "$TDUCREATE",   "$TDUPDATE",    "$TDUUPDATE", "$TDINDWG",
 };
 
-DxfWriterConfiguration::DxfWriterConfiguration() : _writeAllHeaderVariables(false), _writeOptionalValues(true)
+DxfWriterConfiguration::DxfWriterConfiguration()
+    : _writeAllHeaderVariables(false), _writeOptionalValues(true), _doublePrecision(-1), _sectionThreads(0)
 {
     _headerVariables.insert(FixedVariables.begin(), FixedVariables.end());
 }
@@ -69,7 +70,7 @@ void DxfWriterConfiguration::setWriteOptionalValues(bool value)
 
 void DxfWriterConfiguration::addHeaderVariable(const std::string &name)
 {
-    auto _map = CadSystemVariables::headerMap();
+    auto &&_map = CadSystemVariables::headerMap();
     if (_map.find(name) == _map.end())
     {
         throw std::runtime_error(fmt::format("The variable {} is not a valid header variable", name));
@@ -99,4 +100,24 @@ std::set<std::string> DxfWriterConfiguration::headerVariables() const
     return _headerVariables;
 }
 
+int DxfWriterConfiguration::doublePrecision() const
+{
+    return _doublePrecision;
+}
+
+void DxfWriterConfiguration::setDoublePrecision(int value)
+{
+    _doublePrecision = value;
+}
+
+int DxfWriterConfiguration::sectionThreads() const
+{
+    return _sectionThreads;
+}
+
+void DxfWriterConfiguration::setSectionThreads(int value)
+{
+    _sectionThreads = value;
+}
+
 }// namespace dwg
\ No newline at end of file
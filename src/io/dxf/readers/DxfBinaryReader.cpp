@@ -20,7 +20,9 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/DxfFileToken_p.h>
 #include <dwg/io/dxf/readers/DxfBinaryReader_p.h>
+#include <dwg/utils/StringHelp.h>
 
 namespace dwg {
 
@@ -29,76 +31,142 @@ std::string DxfBinaryReader::Sentinel = "AutoCAD Binary DXF\r\n\u001a\0";
 DxfBinaryReader::DxfBinaryReader(std::iostream *stream) : DxfBinaryReader(stream, Encoding(CodePage::Usascii)) {}
 
 DxfBinaryReader::DxfBinaryReader(std::iostream *stream, Encoding encoding)
-    : _stream(stream), _encoding(encoding), _wrapper(StreamWrapper(_stream))
+    : _encoding(encoding), _stream(stream), _current(nullptr), _end(nullptr)
 {
-    _stream->seekg(std::ios::beg);
+    //Load the whole stream once, values are read from the buffer
+    _stream->seekg(0, std::ios::end);
+    std::streamoff size = _stream->tellg();
+    _stream->seekg(0, std::ios::beg);
+    if (size > 0)
+    {
+        _buffer.resize(static_cast<std::size_t>(size));
+        _stream->read(_buffer.data(), size);
+        _buffer.resize(static_cast<std::size_t>(_stream->gcount()));
+    }
     start();
 }
 
 DxfBinaryReader::~DxfBinaryReader() {}
 
+void DxfBinaryReader::readNext()
+{
+    if (_current >= _end)
+    {
+        setEndToken(DxfFileToken::EndOfFile);
+        return;
+    }
+
+    DxfStreamReaderBase::readNext();
+    _position = _current - _buffer.data();
+}
+
 void DxfBinaryReader::start()
 {
     DxfStreamReaderBase::start();
-    auto sentinel = _wrapper.readBytes(22);
     //AutoCAD Binary DXF\r\n\u001a\0
+    _current = _buffer.data() + std::min<std::size_t>(22, _buffer.size());
+    _end = _buffer.data() + _buffer.size();
+    _position = _current - _buffer.data();
 }
 
 std::string DxfBinaryReader::readStringLine()
 {
-    unsigned char b = _wrapper.readByte();
-    std::vector<unsigned char> bytes;
+    return std::string(readStringView());
+}
+
+std::string_view DxfBinaryReader::readStringView()
+{
+    const char *start = _current;
+    const char *terminator = static_cast<const char *>(std::memchr(start, 0, _end - start));
+    const char *stop = terminator ? terminator : _end;
+    _current = terminator ? terminator + 1 : _end;
 
-    while (b != 0)
+    std::string_view str(start, stop - start);
+    if (isAscii(str))
     {
-        bytes.push_back(b);
-        b = _wrapper.readByte();
+        return str;
     }
 
-    _valueRaw = _encoding.toUtf8(std::string(bytes.begin(), bytes.end()));
-    return _valueRaw;
+    //Only non ASCII strings go through the encoding
+    _stringValue = _encoding.toUtf8(std::string(str));
+    return _stringValue;
 }
 
 DxfCode DxfBinaryReader::readCode()
 {
-    return DxfCode(_wrapper.readShort());
+    return DxfCode(readValue<short>());
 }
 
 bool DxfBinaryReader::lineAsBool()
 {
-    return _wrapper.readByte() > 0;
+    return readValue<unsigned char>() > 0;
 }
 
-
 double DxfBinaryReader::lineAsDouble()
 {
-    return _wrapper.readDouble();
+    return readValue<double>();
 }
 
 short DxfBinaryReader::lineAsShort()
 {
-    return _wrapper.readShort();
+    return readValue<short>();
 }
 
 int DxfBinaryReader::lineAsInt()
 {
-    return _wrapper.readInt();
+    return readValue<int>();
 }
 
 long long DxfBinaryReader::lineAsLong()
 {
-    return _wrapper.readLong();
+    return readValue<long long>();
 }
 
 unsigned long long DxfBinaryReader::lineAsHandle()
 {
-    return _wrapper.readULong();
+    //Handles are null terminated hexadecimal strings, as in the ASCII format
+    unsigned long long value;
+    if (StringHelp::tryParseHex64(readStringView(), value))
+    {
+        return value;
+    }
+    return 0ULL;
 }
 
 std::vector<unsigned char> DxfBinaryReader::lineAsBinaryChunk()
 {
-    unsigned char length = _wrapper.readByte();
-    return _wrapper.readBytes(length);
+    std::size_t length = readValue<unsigned char>();
+    length = std::min<std::size_t>(length, _end - _current);
+    std::vector<unsigned char> bytes(_current, _current + length);
+    _current += length;
+    return bytes;
+}
+
+bool DxfBinaryReader::isAscii(std::string_view str)
+{
+    const char *data = str.data();
+    std::size_t size = str.size();
+    std::size_t i = 0;
+
+    //Eight bytes at a time, any byte with the high bit set needs a conversion
+    for (; i + 8 <= size; i += 8)
+    {
+        unsigned long long word;
+        std::memcpy(&word, data + i, 8);
+        if (word & 0x8080808080808080ULL)
+        {
+            return false;
+        }
+    }
+
+    for (; i < size; ++i)
+    {
+        if (static_cast<unsigned char>(data[i]) & 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
-}// namespace dwg
\ No newline at end of file
+}// namespace dwg
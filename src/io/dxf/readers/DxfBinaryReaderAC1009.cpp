@@ -33,10 +33,10 @@ DxfBinaryReaderAC1009::~DxfBinaryReaderAC1009() {}
 
 DxfCode DxfBinaryReaderAC1009::readCode()
 {
-    int code = _wrapper.readByte();
+    int code = readValue<unsigned char>();
     if (code == UCHAR_MAX)
     {
-        code = _wrapper.readShort();
+        code = readValue<short>();
     }
     return DxfCode(code);
 }
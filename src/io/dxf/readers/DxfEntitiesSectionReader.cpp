@@ -20,8 +20,57 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/DxfFileToken_p.h>
+#include <dwg/io/dxf/DxfDocumentBuilder_p.h>
 #include <dwg/io/dxf/readers/DxfEntitiesSectionReader_p.h>
+#include <dwg/io/dxf/readers/IDxfStreamReader_p.h>
+#include <dwg/io/template/CadEntityTemplate_p.h>
 
 namespace dwg {
 
-}// namespace dwg
\ No newline at end of file
+DxfEntitiesSectionReader::DxfEntitiesSectionReader(IDxfStreamReader *reader, DxfDocumentBuilder *builder)
+    : DxfSectionReaderBase(reader, builder)
+{
+}
+
+DxfEntitiesSectionReader::~DxfEntitiesSectionReader() {}
+
+void DxfEntitiesSectionReader::read()
+{
+    //Advance to the first record
+    _reader->readNext();
+    addTemplates(readTemplates());
+}
+
+std::vector<CadEntityTemplate *> DxfEntitiesSectionReader::readTemplates()
+{
+    std::vector<CadEntityTemplate *> templates;
+    while (_reader->valueAsStringView() != DxfFileToken::EndSection)
+    {
+        CadEntityTemplate *entityTemplate = readEntity();
+        if (!entityTemplate)
+            continue;
+
+        templates.push_back(entityTemplate);
+    }
+    return templates;
+}
+
+void DxfEntitiesSectionReader::addTemplates(const std::vector<CadEntityTemplate *> &templates)
+{
+    for (CadEntityTemplate *entityTemplate: templates)
+    {
+        CadObject *entity = entityTemplate->cadObject();
+        if (!entity)
+        {
+            _builder->OnNotification("Entity template without an entity, the record is ignored", Notification::Warning);
+            continue;
+        }
+
+        //Add the object and the template to the builder
+        _builder->setAppTemplate(entityTemplate);
+        _builder->modelSpaceEntities().insert(entity->handle());
+    }
+}
+
+}// namespace dwg
@@ -20,8 +20,55 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/DxfFileToken_p.h>
+#include <dwg/io/dxf/DxfDocumentBuilder_p.h>
 #include <dwg/io/dxf/readers/DxfObjectsSectionReader_p.h>
+#include <dwg/io/dxf/readers/IDxfStreamReader_p.h>
+#include <dwg/io/template/CadTemplate_p.h>
 
 namespace dwg {
 
-}// namespace dwg
\ No newline at end of file
+DxfObjectsSectionReader::DxfObjectsSectionReader(IDxfStreamReader *reader, DxfDocumentBuilder *builder)
+    : DxfSectionReaderBase(reader, builder)
+{
+}
+
+DxfObjectsSectionReader::~DxfObjectsSectionReader() {}
+
+void DxfObjectsSectionReader::read()
+{
+    //Advance to the first record
+    _reader->readNext();
+    addTemplates(readTemplates());
+}
+
+std::vector<CadTemplate *> DxfObjectsSectionReader::readTemplates()
+{
+    std::vector<CadTemplate *> templates;
+    while (_reader->valueAsStringView() != DxfFileToken::EndSection)
+    {
+        CadTemplate *objectTemplate = readObject();
+        if (!objectTemplate)
+            continue;
+
+        templates.push_back(objectTemplate);
+    }
+    return templates;
+}
+
+void DxfObjectsSectionReader::addTemplates(const std::vector<CadTemplate *> &templates)
+{
+    for (CadTemplate *objectTemplate: templates)
+    {
+        _builder->setAppTemplate(objectTemplate);
+    }
+}
+
+CadTemplate *DxfObjectsSectionReader::readObject()
+{
+    //Object readers are not ported yet, the record is skipped
+    skipRecord();
+    return nullptr;
+}
+
+}// namespace dwg
@@ -0,0 +1,177 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+#include <dwg/DxfFileToken_p.h>
+#include <dwg/io/dxf/readers/DxfSectionIndex_p.h>
+#include <dwg/io/dxf/readers/DxfTextTokenizer_p.h>
+
+namespace dwg {
+
+DxfSectionIndex::DxfSectionIndex() {}
+
+DxfSectionIndex DxfSectionIndex::Scan(const char *data, std::size_t size, std::size_t chunkSize)
+{
+    DxfSectionIndex index;
+    DxfTextTokenizer tokenizer(data, size);
+
+    DxfSectionRange current;
+    bool inSection = false;
+    bool inHeader = false;
+    bool chunked = false;
+    bool inSequence = false;
+    std::size_t chunkStart = 0;
+
+    int code;
+    std::string_view value;
+    while (!tokenizer.atEnd())
+    {
+        std::size_t pairStart = tokenizer.offset();
+        if (!tokenizer.next(code, value))
+        {
+            continue;
+        }
+
+        if (code == 0)
+        {
+            std::string_view name = DxfTextTokenizer::trim(value);
+            if (name == DxfFileToken::BeginSection)
+            {
+                //The section name follows as a group code 2 pair
+                current = DxfSectionRange();
+                current.begin = tokenizer.offset();
+                if (tokenizer.next(code, value) && code == 2)
+                {
+                    current.name = DxfTextTokenizer::trim(value);
+                }
+                inSection = true;
+                inHeader = current.name == DxfFileToken::HeaderSection;
+                chunked = current.name == DxfFileToken::EntitiesSection ||
+                          current.name == DxfFileToken::ObjectsSection;
+                chunkStart = current.begin;
+                inSequence = false;
+            }
+            else if (name == DxfFileToken::EndSection && inSection)
+            {
+                current.end = tokenizer.offset();
+                index._sections.push_back(std::move(current));
+                inSection = false;
+                inHeader = false;
+                chunked = false;
+            }
+            else if (name == DxfFileToken::EndOfFile)
+            {
+                break;
+            }
+            else if (name == DxfFileToken::EntityVertex || name == DxfFileToken::EntityAttribute)
+            {
+                //Vertices and attributes belong to the record before them, up to its SEQEND
+                inSequence = true;
+            }
+            else if (name == DxfFileToken::EndSequence)
+            {
+                inSequence = false;
+            }
+            else if (chunked && !inSequence && pairStart - chunkStart >= chunkSize)
+            {
+                //Split only before a top level record, its owner is always in the same chunk
+                current.chunks.push_back(pairStart);
+                chunkStart = pairStart;
+            }
+            continue;
+        }
+
+        if (inHeader && code == 9)
+        {
+            std::string_view variable = DxfTextTokenizer::trim(value);
+            if (variable == "$ACADVER" && tokenizer.next(code, value))
+            {
+                index._acadVersion = DxfTextTokenizer::trim(value);
+            }
+            else if (variable == "$DWGCODEPAGE" && tokenizer.next(code, value))
+            {
+                index._codePage = DxfTextTokenizer::trim(value);
+            }
+        }
+    }
+
+    //Unterminated section, keep what is there so it can still be read
+    if (inSection)
+    {
+        current.end = size;
+        index._sections.push_back(std::move(current));
+    }
+
+    return index;
+}
+
+std::vector<DxfSectionRange> DxfSectionIndex::Chunks(const DxfSectionRange &section)
+{
+    std::vector<DxfSectionRange> chunks;
+    chunks.reserve(section.chunks.size() + 1);
+
+    std::size_t begin = section.begin;
+    for (std::size_t offset: section.chunks)
+    {
+        DxfSectionRange chunk;
+        chunk.name = section.name;
+        chunk.begin = begin;
+        chunk.end = offset;
+        chunks.push_back(std::move(chunk));
+        begin = offset;
+    }
+
+    DxfSectionRange last;
+    last.name = section.name;
+    last.begin = begin;
+    last.end = section.end;
+    chunks.push_back(std::move(last));
+
+    return chunks;
+}
+
+const std::vector<DxfSectionRange> &DxfSectionIndex::sections() const
+{
+    return _sections;
+}
+
+const DxfSectionRange *DxfSectionIndex::find(std::string_view name) const
+{
+    for (const DxfSectionRange &section: _sections)
+    {
+        if (section.name == name)
+        {
+            return &section;
+        }
+    }
+    return nullptr;
+}
+
+const std::string &DxfSectionIndex::acadVersion() const
+{
+    return _acadVersion;
+}
+
+const std::string &DxfSectionIndex::codePage() const
+{
+    return _codePage;
+}
+
+}// namespace dwg
@@ -21,7 +21,30 @@
  */
 
 #include <dwg/io/dxf/readers/DxfSectionReaderBase_p.h>
+#include <dwg/io/dxf/readers/IDxfStreamReader_p.h>
 
 namespace dwg {
 
-}// namespace dwg
\ No newline at end of file
+DxfSectionReaderBase::DxfSectionReaderBase(IDxfStreamReader *reader, DxfDocumentBuilder *builder)
+    : _reader(reader), _builder(builder)
+{
+}
+
+DxfSectionReaderBase::~DxfSectionReaderBase() {}
+
+CadEntityTemplate *DxfSectionReaderBase::readEntity()
+{
+    //Entity readers are not ported yet, the record is skipped
+    skipRecord();
+    return nullptr;
+}
+
+void DxfSectionReaderBase::skipRecord()
+{
+    do
+    {
+        _reader->readNext();
+    } while (_reader->dxfCode() != DxfCode::Start);
+}
+
+}// namespace dwg
@@ -22,36 +22,64 @@
 
 #include <dwg/DxfFileToken_p.h>
 #include <dwg/GroupCodeValue.h>
+#include <dwg/io/dxf/DxfCaretEscape_p.h>
 #include <dwg/io/dxf/readers/DxfStreamReaderBase_p.h>
-#include <dwg/utils/StringHelp.h>
 
 namespace dwg {
 
-DxfStreamReaderBase::DxfStreamReaderBase()
-    : _dxfcode(DxfCode::Invalid), _groupCodeValue(GroupCodeValueType::None), _position(0)
-{
-}
+DxfStreamReaderBase::DxfStreamReaderBase() : _position(0) {}
 
 DxfStreamReaderBase::~DxfStreamReaderBase() {}
 
 DxfCode DxfStreamReaderBase::dxfCode() const
 {
-    return _dxfcode;
+    return _token.code;
 }
 
 GroupCodeValueType DxfStreamReaderBase::groupCodeValue() const
 {
-    return _groupCodeValue;
+    return _token.valueType;
 }
 
 int DxfStreamReaderBase::code() const
 {
-    return (int) _dxfcode;
+    return (int) _token.code;
+}
+
+const DxfToken &DxfStreamReaderBase::token() const
+{
+    return _token;
 }
 
 DwgVariant DxfStreamReaderBase::value() const
 {
-    return _value;
+    switch (_token.kind)
+    {
+        case DxfToken::Kind::String:
+            return std::string(_token.data, _token.size);
+        case DxfToken::Kind::Double:
+            return _token.doubleValue;
+        case DxfToken::Kind::Integer:
+            switch (_token.valueType)
+            {
+                case GroupCodeValueType::Int32:
+                case GroupCodeValueType::ExtendedDataInt32:
+                    return (int) _token.intValue;
+                case GroupCodeValueType::Int64:
+                    return _token.intValue;
+                default:
+                    return (short) _token.intValue;
+            }
+        case DxfToken::Kind::Handle:
+            return _token.handleValue;
+        case DxfToken::Kind::Bool:
+            return _token.boolValue;
+        case DxfToken::Kind::Chunk:
+            return std::vector<unsigned char>(_token.chunkData(), _token.chunkData() + _token.size);
+        case DxfToken::Kind::None:
+        default:
+            return DwgVariant();
+    }
 }
 
 size_t DxfStreamReaderBase::position() const
@@ -61,107 +89,152 @@ size_t DxfStreamReaderBase::position() const
 
 std::string DxfStreamReaderBase::valueRaw() const
 {
+    if (_token.kind == DxfToken::Kind::String)
+        return std::string(_token.data, _token.size);
+
     return _valueRaw;
 }
 
 std::string DxfStreamReaderBase::valueAsString() const
 {
-    if (_value.isEmpty())
+    if (_token.kind == DxfToken::Kind::None)
         return std::string();
 
-    std::string str = _value.convert<std::string>();
-    str = StringHelp::replace(str, "^J", "\n");
-    str = StringHelp::replace(str, "^M", "\r");
-    str = StringHelp::replace(str, "^I", "\t");
-    str = StringHelp::replace(str, "^ ", "^");
-    return str;
+    if (_token.kind != DxfToken::Kind::String)
+        return value().convert<std::string>();
+
+    return DxfCaretEscape::unescape(std::string_view(_token.data, _token.size));
+}
+
+std::string_view DxfStreamReaderBase::valueAsStringView() const
+{
+    return _token.stringView();
 }
 
 bool DxfStreamReaderBase::valueAsBool() const
 {
-    if (_value.isEmpty())
-        return false;
+    switch (_token.kind)
+    {
+        case DxfToken::Kind::Bool:
+            return _token.boolValue;
+        case DxfToken::Kind::Integer:
+            return (unsigned char) _token.intValue > 0;
+        case DxfToken::Kind::None:
+            return false;
+        default:
+            return (value().convert<unsigned char>() > 0) ? true : false;
+    }
+}
 
-    return (_value.convert<unsigned char>() > 0) ? true : false;
+template<typename T>
+static bool tokenAsNumber(const DxfToken &token, T &result)
+{
+    switch (token.kind)
+    {
+        case DxfToken::Kind::Integer:
+            result = (T) token.intValue;
+            return true;
+        case DxfToken::Kind::Double:
+            result = (T) token.doubleValue;
+            return true;
+        case DxfToken::Kind::Handle:
+            result = (T) token.handleValue;
+            return true;
+        case DxfToken::Kind::Bool:
+            result = (T) token.boolValue;
+            return true;
+        case DxfToken::Kind::None:
+            result = T();
+            return true;
+        default:
+            return false;
+    }
 }
 
 short DxfStreamReaderBase::valueAsShort() const
 {
-    if (_value.isEmpty())
-        return 0;
+    short result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<short>();
+    return value().convert<short>();
 }
 
 unsigned short DxfStreamReaderBase::valueAsUShort() const
 {
-    if (_value.isEmpty())
-        return 0;
+    unsigned short result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<unsigned short>();
+    return value().convert<unsigned short>();
 }
 
 int DxfStreamReaderBase::valueAsInt() const
 {
-    if (_value.isEmpty())
-        return 0;
+    int result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<int>();
+    return value().convert<int>();
 }
 
 unsigned int DxfStreamReaderBase::valueAsUInt() const
 {
-    if (_value.isEmpty())
-        return 0;
+    unsigned int result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<unsigned int>();
+    return value().convert<unsigned int>();
 }
 
 long long DxfStreamReaderBase::valueAsLongLong() const
 {
-    if (_value.isEmpty())
-        return 0LL;
+    long long result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<long long>();
+    return value().convert<long long>();
 }
 
 unsigned long long DxfStreamReaderBase::valueAsHandle() const
 {
-    if (_value.isEmpty())
-        return 0ULL;
+    unsigned long long result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<unsigned long long>();
+    return value().convert<unsigned long long>();
 }
 
 double DxfStreamReaderBase::valueAsDouble() const
 {
-    if (_value.isEmpty())
-        return 0.0;
+    double result;
+    if (tokenAsNumber(_token, result))
+        return result;
 
-    return _value.convert<double>();
+    return value().convert<double>();
 }
 
 double DxfStreamReaderBase::valueAsAngle() const
 {
-    if (_value.isEmpty())
-        return 0.0;
-
-    return _value.convert<double>();
+    return valueAsDouble();
 }
 
 std::vector<unsigned char> DxfStreamReaderBase::valueAsBinaryChunk() const
 {
-    if (_value.isEmpty())
+    if (_token.kind == DxfToken::Kind::None)
         return std::vector<unsigned char>();
 
-    return _value.convert<std::vector<unsigned char>>();
+    if (_token.kind == DxfToken::Kind::Chunk)
+        return std::vector<unsigned char>(_token.chunkData(), _token.chunkData() + _token.size);
+
+    return value().convert<std::vector<unsigned char>>();
 }
 
 void DxfStreamReaderBase::readNext()
 {
-    _dxfcode = readCode();
-    _groupCodeValue = GroupCodeValue::transformValue(code());
-    _value = transformValue(_groupCodeValue);
+    _token.code = readCode();
+    _token.valueType = GroupCodeValue::transformValue(code());
+    transformValue(_token.valueType);
 }
 
 bool DxfStreamReaderBase::find(const std::string &dxfEntry)
@@ -171,9 +244,9 @@ bool DxfStreamReaderBase::find(const std::string &dxfEntry)
     {
         readNext();
 
-    } while (valueAsString() != dxfEntry && (valueAsString() != DxfFileToken::EndOfFile));
+    } while (valueAsStringView() != dxfEntry && (valueAsStringView() != DxfFileToken::EndOfFile));
 
-    return valueAsString() == dxfEntry;
+    return valueAsStringView() == dxfEntry;
 }
 
 void DxfStreamReaderBase::expectedCode(int code) {}
@@ -183,42 +256,79 @@ std::string DxfStreamReaderBase::toString() const
     return fmt::format("{} | {}", code(), valueRaw());
 }
 
+void DxfStreamReaderBase::setEndToken(std::string_view value)
+{
+    _token = DxfToken();
+    _token.code = DxfCode::Start;
+    _token.valueType = GroupCodeValueType::String;
+    _token.kind = DxfToken::Kind::String;
+    _token.data = value.data();
+    _token.size = value.size();
+}
+
 void DxfStreamReaderBase::start()
 {
-    _dxfcode = DxfCode::Invalid;
-    _value = DwgVariant();
+    _token = DxfToken();
+}
+
+std::string_view DxfStreamReaderBase::readStringView()
+{
+    _stringValue = readStringLine();
+    return _stringValue;
 }
 
-DwgVariant DxfStreamReaderBase::transformValue(GroupCodeValueType code)
+void DxfStreamReaderBase::transformValue(GroupCodeValueType code)
 {
     switch (code)
     {
         case GroupCodeValueType::String:
         case GroupCodeValueType::Comment:
         case GroupCodeValueType::ExtendedDataString:
-            return readStringLine();
+            {
+                std::string_view str = readStringView();
+                _token.kind = DxfToken::Kind::String;
+                _token.data = str.data();
+                _token.size = str.size();
+                break;
+            }
         case GroupCodeValueType::Point3D:
         case GroupCodeValueType::Double:
         case GroupCodeValueType::ExtendedDataDouble:
-            return lineAsDouble();
+            _token.kind = DxfToken::Kind::Double;
+            _token.doubleValue = lineAsDouble();
+            break;
         case GroupCodeValueType::Byte:
         case GroupCodeValueType::Int16:
         case GroupCodeValueType::ExtendedDataInt16:
-            return lineAsShort();
+            _token.kind = DxfToken::Kind::Integer;
+            _token.intValue = lineAsShort();
+            break;
         case GroupCodeValueType::Int32:
         case GroupCodeValueType::ExtendedDataInt32:
-            return lineAsInt();
+            _token.kind = DxfToken::Kind::Integer;
+            _token.intValue = lineAsInt();
+            break;
         case GroupCodeValueType::Int64:
-            return lineAsLong();
+            _token.kind = DxfToken::Kind::Integer;
+            _token.intValue = lineAsLong();
+            break;
         case GroupCodeValueType::Handle:
         case GroupCodeValueType::ObjectId:
         case GroupCodeValueType::ExtendedDataHandle:
-            return lineAsHandle();
+            _token.kind = DxfToken::Kind::Handle;
+            _token.handleValue = lineAsHandle();
+            break;
         case GroupCodeValueType::Bool:
-            return lineAsBool();
+            _token.kind = DxfToken::Kind::Bool;
+            _token.boolValue = lineAsBool();
+            break;
         case GroupCodeValueType::Chunk:
         case GroupCodeValueType::ExtendedDataChunk:
-            return lineAsBinaryChunk();
+            _chunkValue = lineAsBinaryChunk();
+            _token.kind = DxfToken::Kind::Chunk;
+            _token.data = reinterpret_cast<const char *>(_chunkValue.data());
+            _token.size = _chunkValue.size();
+            break;
         case GroupCodeValueType::None:
         default:
             throw std::runtime_error(
@@ -20,39 +20,124 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <algorithm>
+#include <dwg/DxfFileToken_p.h>
 #include <dwg/io/dxf/readers/DxfTextReader_p.h>
 #include <dwg/utils/StringHelp.h>
 
 namespace dwg {
 
 DxfTextReader::DxfTextReader(std::iostream *stream, Encoding encoding)
-    : _stream(stream), _encoding(encoding), _wrapper(_stream)
+    : _encoding(encoding), _stream(stream), _begin(0), _end(0), _terminator(DxfFileToken::EndOfFile)
 {
-    _stream->seekg(std::ios::beg);
+    //Load the whole stream once, lines are split in place
+    auto buffer = std::make_shared<std::vector<char>>();
+    _stream->seekg(0, std::ios::end);
+    std::streamoff size = _stream->tellg();
+    _stream->seekg(0, std::ios::beg);
+    if (size > 0)
+    {
+        buffer->resize(static_cast<std::size_t>(size));
+        _stream->read(buffer->data(), size);
+        buffer->resize(static_cast<std::size_t>(_stream->gcount()));
+    }
+    _end = buffer->size();
+    _buffer = std::move(buffer);
+    _tokenizer = DxfTextTokenizer(_buffer->data(), _end);
+
+    start();
+}
+
+DxfTextReader::DxfTextReader(std::shared_ptr<const std::vector<char>> buffer, std::size_t begin, std::size_t end,
+                             Encoding encoding)
+    : _encoding(encoding), _stream(nullptr), _buffer(std::move(buffer)), _begin(begin), _end(end),
+      _terminator(DxfFileToken::EndSection)
+{
+    _end = std::min(_end, _buffer->size());
+    _begin = std::min(_begin, _end);
+    _tokenizer = DxfTextTokenizer(_buffer->data() + _begin, _end - _begin);
+
     start();
 }
 
 DxfTextReader::~DxfTextReader() {}
 
+const DxfSectionIndex &DxfTextReader::sectionIndex()
+{
+    if (!_sectionIndex)
+    {
+        _sectionIndex = std::make_unique<DxfSectionIndex>(
+                DxfSectionIndex::Scan(_buffer->data() + _begin, _end - _begin));
+    }
+    return *_sectionIndex;
+}
+
+DxfTextReader *DxfTextReader::createSectionReader(const DxfSectionRange &section) const
+{
+    //Section offsets are relative to the range of this reader
+    return new DxfTextReader(_buffer, _begin + section.begin, _begin + section.end, _encoding);
+}
+
+void DxfTextReader::seekSection(const DxfSectionRange &section)
+{
+    DxfStreamReaderBase::start();
+    _tokenizer.seek(section.begin);
+    //Line position of the section name, each pair takes two lines
+    const char *data = _buffer->data() + _begin;
+    _position = static_cast<std::size_t>(std::count(data, data + section.begin, '\n'));
+}
+
+void DxfTextReader::setEncoding(const Encoding &encoding)
+{
+    _encoding = encoding;
+}
+
 void DxfTextReader::readNext()
 {
+    if (_tokenizer.atEnd())
+    {
+        //Nothing left in the range, close it so the readers looping on the value stop
+        setEndToken(_terminator);
+        return;
+    }
+
     DxfStreamReaderBase::readNext();
     _position += 2;
 }
 
+void DxfTextReader::start()
+{
+    DxfStreamReaderBase::start();
+    _position = 0;
+    _tokenizer.reset();
+}
+
 std::string DxfTextReader::readStringLine()
 {
-    std::string str;
-    std::getline(*_stream, str);
-    _valueRaw = str;
+    return readLine();
+}
+
+std::string_view DxfTextReader::readStringView()
+{
+    //String values point into the loaded buffer
+    std::string_view line;
+    _tokenizer.nextLine(line);
+    return line;
+}
+
+const std::string &DxfTextReader::readLine()
+{
+    std::string_view line;
+    _tokenizer.nextLine(line);
+    //Reuses the capacity of the raw value, no allocation once it has grown
+    _valueRaw.assign(line.data(), line.size());
     return _valueRaw;
 }
 
 DxfCode DxfTextReader::readCode()
 {
-    std::string line = readStringLine();
     int value;
-    if (StringHelp::tryParse32(line, value))
+    if (_tokenizer.nextCode(value))
     {
         return DxfCode(value);
     }
@@ -62,7 +147,7 @@ DxfCode DxfTextReader::readCode()
 
 bool DxfTextReader::lineAsBool()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     unsigned char value;
     if (StringHelp::tryParseUnsigned8(str, value))
     {
@@ -73,7 +158,7 @@ bool DxfTextReader::lineAsBool()
 
 double DxfTextReader::lineAsDouble()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     double value;
     if (StringHelp::tryParseFloat(str, value))
     {
@@ -84,7 +169,7 @@ double DxfTextReader::lineAsDouble()
 
 short DxfTextReader::lineAsShort()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     short value;
     if (StringHelp::tryParse16(str, value))
     {
@@ -95,7 +180,7 @@ short DxfTextReader::lineAsShort()
 
 int DxfTextReader::lineAsInt()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     int value;
     if (StringHelp::tryParse32(str, value))
     {
@@ -106,7 +191,7 @@ int DxfTextReader::lineAsInt()
 
 long long DxfTextReader::lineAsLong()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     long long value;
     if (StringHelp::tryParse64(str, value))
     {
@@ -117,9 +202,10 @@ long long DxfTextReader::lineAsLong()
 
 unsigned long long DxfTextReader::lineAsHandle()
 {
-    std::string str = readStringLine();
+    const std::string &str = readLine();
     unsigned long long value;
-    if (StringHelp::tryParseUnsigned64(str, value))
+    //Handles are written as hexadecimal
+    if (StringHelp::tryParseHex64(str, value))
     {
         return value;
     }
@@ -128,17 +214,16 @@ unsigned long long DxfTextReader::lineAsHandle()
 
 std::vector<unsigned char> DxfTextReader::lineAsBinaryChunk()
 {
-    std::string str = readStringLine();
+    std::string_view str = readLine();
 
-    std::vector<unsigned char> bytes(str.length(), 0);
-    for (int i = 0; i < str.length(); ++i)
+    std::vector<unsigned char> bytes(str.length() / 2, 0);
+    for (std::size_t i = 0; i < bytes.size(); ++i)
     {
-        //Create a byte value
-        std::string hex = fmt::format("{}{}", str[i], str[++i]);
-        unsigned char value;
-        if (StringHelp::tryParseUnsigned8(hex, value))
+        //Create a byte value from each hexadecimal pair
+        unsigned long long value;
+        if (StringHelp::tryParseHex64(str.substr(i * 2, 2), value))
         {
-            bytes[i] = value;
+            bytes[i] = (unsigned char) value;
         }
         else
         {
@@ -0,0 +1,111 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <cstring>
+#include <dwg/io/dxf/readers/DxfTextTokenizer_p.h>
+#include <dwg/utils/StringHelp.h>
+
+namespace dwg {
+
+DxfTextTokenizer::DxfTextTokenizer() : _begin(nullptr), _end(nullptr), _current(nullptr) {}
+
+DxfTextTokenizer::DxfTextTokenizer(const char *data, std::size_t size)
+    : _begin(data), _end(data + size), _current(data)
+{
+}
+
+void DxfTextTokenizer::reset()
+{
+    _current = _begin;
+}
+
+void DxfTextTokenizer::seek(std::size_t offset)
+{
+    _current = offset < std::size_t(_end - _begin) ? _begin + offset : _end;
+}
+
+bool DxfTextTokenizer::atEnd() const
+{
+    return _current >= _end;
+}
+
+std::size_t DxfTextTokenizer::offset() const
+{
+    return _current - _begin;
+}
+
+bool DxfTextTokenizer::nextLine(std::string_view &line)
+{
+    if (_current >= _end)
+    {
+        line = std::string_view();
+        return false;
+    }
+
+    const char *start = _current;
+    const char *newLine = static_cast<const char *>(std::memchr(start, '\n', _end - start));
+    const char *stop = newLine ? newLine : _end;
+    _current = newLine ? newLine + 1 : _end;
+
+    //Drop the carriage return of CRLF endings
+    if (stop > start && stop[-1] == '\r')
+    {
+        --stop;
+    }
+
+    line = std::string_view(start, stop - start);
+    return true;
+}
+
+bool DxfTextTokenizer::nextCode(int &code)
+{
+    std::string_view line;
+    if (!nextLine(line))
+    {
+        return false;
+    }
+
+    return StringHelp::tryParse32(line, code);
+}
+
+bool DxfTextTokenizer::next(int &code, std::string_view &value)
+{
+    bool valid = nextCode(code);
+    return nextLine(value) && valid;
+}
+
+std::string_view DxfTextTokenizer::trim(std::string_view str)
+{
+    std::size_t first = 0;
+    std::size_t last = str.size();
+    while (first < last && (str[first] == ' ' || str[first] == '\t' || str[first] == '\r'))
+    {
+        ++first;
+    }
+    while (last > first && (str[last - 1] == ' ' || str[last - 1] == '\t' || str[last - 1] == '\r'))
+    {
+        --last;
+    }
+    return str.substr(first, last - first);
+}
+
+}// namespace dwg
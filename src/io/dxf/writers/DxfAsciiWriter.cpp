@@ -20,38 +20,81 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <algorithm>
+#include <double-conversion/double-conversion.h>
 #include <dwg/GroupCodeValue.h>
 #include <dwg/io/dxf/writers/DxfAsciiWriter_p.h>
-#include <fmt/core.h>
+#include <iterator>
 
 namespace dwg {
 
-DxfAsciiWriter::DxfAsciiWriter(std::fstream *stream, Encoding encoding) : _stream(stream), _encoding(encoding) {}
+DxfAsciiWriter::DxfAsciiWriter(std::fstream *stream, Encoding encoding)
+    : _stream(stream), _encoding(encoding), _doublePrecision(-1)
+{
+}
+
+DxfAsciiWriter::~DxfAsciiWriter()
+{
+    flush();
+}
 
 void DxfAsciiWriter::flush()
 {
-    _stream->flush();
+    drain();
+    if (_stream)
+    {
+        _stream->flush();
+    }
 }
 
 void DxfAsciiWriter::close()
 {
-    _stream->close();
+    drain();
+    if (_stream)
+    {
+        _stream->close();
+    }
+}
+
+IDxfStreamWriter *DxfAsciiWriter::createMemoryWriter() const
+{
+    DxfAsciiWriter *writer = new DxfAsciiWriter(nullptr, _encoding);
+    writer->setDoublePrecision(_doublePrecision);
+    return writer;
+}
+
+void DxfAsciiWriter::writeBuffer(const IDxfStreamWriter *memoryWriter)
+{
+    const fmt::memory_buffer &buffer = static_cast<const DxfAsciiWriter *>(memoryWriter)->_buffer;
+    _buffer.append(buffer.data(), buffer.data() + buffer.size());
+    if (_buffer.size() >= BufferSize)
+    {
+        drain();
+    }
 }
 
 void DxfAsciiWriter::writeDxfCode(int code)
 {
-    if (code < 10)
+    //Group codes are right aligned to three characters
+    if (code >= 0 && code < 10)
     {
-        *_stream << fmt::format("  {}", code) << std::endl;
+        const char line[] = {' ', ' ', char('0' + code)};
+        _buffer.append(line, line + 3);
     }
-    else if (code < 100)
+    else if (code >= 10 && code < 100)
     {
-        *_stream << fmt::format(" {}", code) << std::endl;
+        const char line[] = {' ', char('0' + code / 10), char('0' + code % 10)};
+        _buffer.append(line, line + 3);
+    }
+    else if (code < 10)
+    {
+        fmt::format_to(std::back_inserter(_buffer), "  {}", code);
     }
     else
     {
-        *_stream << fmt::format("{}", code) << std::endl;
+        fmt::format_to(std::back_inserter(_buffer), "{}", code);
     }
+    endLine();
 }
 
 void DxfAsciiWriter::writeValue(int code, DwgVariant value)
@@ -65,43 +108,140 @@ void DxfAsciiWriter::writeValue(int code, DwgVariant value)
         case GroupCodeValueType::String:
         case GroupCodeValueType::Comment:
         case GroupCodeValueType::ExtendedDataString:
-            *_stream << value.convert<std::string>() << std::endl;
+            writeLine(value.convert<std::string>());
             return;
         case GroupCodeValueType::Point3D:
         case GroupCodeValueType::Double:
         case GroupCodeValueType::ExtendedDataDouble:
-            *_stream << fmt::format("{:.15g}", value.convert<double>()) << std::endl;
+            writeDouble(value.convert<double>());
+            endLine();
+            return;
+        case GroupCodeValueType::Byte:
+        case GroupCodeValueType::Int16:
+        case GroupCodeValueType::ExtendedDataInt16:
+            fmt::format_to(std::back_inserter(_buffer), "{}", value.convert<short>());
+            endLine();
             return;
         case GroupCodeValueType::Int32:
         case GroupCodeValueType::ExtendedDataInt32:
-            *_stream << fmt::format("{}", value.convert<int>()) << std::endl;
+            fmt::format_to(std::back_inserter(_buffer), "{}", value.convert<int>());
+            endLine();
             return;
         case GroupCodeValueType::Int64:
-            *_stream << fmt::format("{}", value.convert<long long>()) << std::endl;
+            fmt::format_to(std::back_inserter(_buffer), "{}", value.convert<long long>());
+            endLine();
             return;
         case GroupCodeValueType::Handle:
         case GroupCodeValueType::ObjectId:
         case GroupCodeValueType::ExtendedDataHandle:
-            *_stream << fmt::format("{:X}", value.convert<unsigned long long>()) << std::endl;
+            fmt::format_to(std::back_inserter(_buffer), "{:X}", value.convert<unsigned long long>());
+            endLine();
             return;
         case GroupCodeValueType::Bool:
-            *_stream << fmt::format("{}", value.convert<short>()) << std::endl;
+            fmt::format_to(std::back_inserter(_buffer), "{}", value.convert<short>());
+            endLine();
             return;
         case GroupCodeValueType::Chunk:
         case GroupCodeValueType::ExtendedDataChunk:
             {
+                static constexpr char digits[] = "0123456789ABCDEF";
                 std::vector<unsigned char> arr = value.convert<std::vector<unsigned char>>();
-                for (auto &&v: arr)
+
+                //Hexadecimal pairs written in place, in a single pass
+                std::size_t size = _buffer.size();
+                _buffer.resize(size + arr.size() * 2);
+                char *out = _buffer.data() + size;
+                for (unsigned char v: arr)
                 {
-                    std::string str = fmt::format("{:02X}", v);
-                    _stream->write(str.data(), str.size());
+                    *out++ = digits[v >> 4];
+                    *out++ = digits[v & 0x0F];
                 }
-                *_stream << std::endl;
+                endLine();
                 return;
             }
     }
 
-    *_stream << value.convert<std::string>();
+    writeLine(value.convert<std::string>());
+}
+
+void DxfAsciiWriter::writeStringValue(int, std::string_view value)
+{
+    writeLine(value);
+}
+
+int DxfAsciiWriter::doublePrecision() const
+{
+    return _doublePrecision;
+}
+
+void DxfAsciiWriter::setDoublePrecision(int value)
+{
+    //More digits than a double holds only add noise
+    _doublePrecision = std::min(value, 17);
+}
+
+void DxfAsciiWriter::writeDouble(double value)
+{
+    using namespace double_conversion;
+
+    static const DoubleToStringConverter converter(DoubleToStringConverter::UNIQUE_ZERO, "inf", "nan", 'e',
+                                                   -6, // decimal_in_shortest_low
+                                                   21, // decimal_in_shortest_high
+                                                   0,  // max_leading_padding_zeroes_in_precision_mode
+                                                   0   // max_trailing_padding_zeroes_in_precision_mode
+    );
+
+    char digits[128];
+    StringBuilder builder(digits, sizeof(digits));
+
+    bool fixed = _doublePrecision >= 0 && converter.ToFixed(value, _doublePrecision, &builder);
+    if (!fixed)
+    {
+        //Values too large for the fixed notation also end here
+        builder.Reset();
+        converter.ToShortest(value, &builder);
+    }
+
+    std::string_view str(digits, builder.position());
+    if (fixed && str.find('.') != std::string_view::npos)
+    {
+        //Trailing zeros do not change the value
+        str = str.substr(0, str.find_last_not_of('0') + 1);
+        if (str.back() == '.')
+        {
+            str.remove_suffix(1);
+        }
+        if (str == "-0")
+        {
+            str = "0";
+        }
+    }
+
+    _buffer.append(str.data(), str.data() + str.size());
+}
+
+void DxfAsciiWriter::writeLine(std::string_view str)
+{
+    _buffer.append(str.data(), str.data() + str.size());
+    endLine();
+}
+
+void DxfAsciiWriter::endLine()
+{
+    _buffer.push_back('\n');
+    if (_buffer.size() >= BufferSize)
+    {
+        drain();
+    }
+}
+
+void DxfAsciiWriter::drain()
+{
+    if (_stream && _buffer.size() > 0)
+    {
+        _stream->write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        _buffer.clear();
+    }
 }
 
-}// namespace dwg
\ No newline at end of file
+}// namespace dwg
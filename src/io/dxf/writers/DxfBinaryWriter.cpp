@@ -22,33 +22,50 @@
 
 #include <dwg/GroupCodeValue.h>
 #include <dwg/io/dxf/writers/DxfBinaryWriter_p.h>
-#include <fmt/core.h>
 
 namespace dwg {
 
 DxfBinaryWriter::DxfBinaryWriter(std::fstream *stream, Encoding encoding) : _stream(stream), _encoding(encoding)
 {
+    if (!_stream)
+    {
+        return;
+    }
+
     //string sentinel = "AutoCAD Binary DXF\r\n\0";
     std::vector<unsigned char> sentinel = {65, 117, 116, 111, 67, 65, 68, 32, 66, 105, 110,
                                            97, 114, 121, 32,  68, 88, 70, 13, 10, 26,  0};
 
-    _stream->write(reinterpret_cast<const char *>(sentinel.data()), sentinel.size());
+    writeBytes(sentinel.data(), sentinel.size());
+}
+
+DxfBinaryWriter::~DxfBinaryWriter()
+{
+    flush();
 }
 
 void DxfBinaryWriter::flush()
 {
-    _stream->flush();
+    drain();
+    if (_stream)
+    {
+        _stream->flush();
+    }
 }
 
 void DxfBinaryWriter::close()
 {
-    _stream->close();
+    drain();
+    if (_stream)
+    {
+        _stream->close();
+    }
 }
 
 void DxfBinaryWriter::writeDxfCode(int code)
 {
     short sc = (short) code;
-    _stream->write((const char *) &sc, sizeof(short));
+    writeBytes(&sc, sizeof(short));
 }
 
 void DxfBinaryWriter::writeValue(int code, DwgVariant value)
@@ -64,53 +81,102 @@ void DxfBinaryWriter::writeValue(int code, DwgVariant value)
         case GroupCodeValueType::ExtendedDataString:
             {
                 std::string v = value.convert<std::string>();
-                _stream->write(v.c_str(), v.size());
-                char c = '\0';
-                _stream->write(reinterpret_cast<const char *>(&c), sizeof(char));
+                //Null terminated
+                writeBytes(v.c_str(), v.size() + 1);
                 return;
             }
-            return;
         case GroupCodeValueType::Point3D:
         case GroupCodeValueType::Double:
         case GroupCodeValueType::ExtendedDataDouble:
             {
                 double v = value.convert<double>();
-                _stream->write(reinterpret_cast<const char *>(&v), sizeof(double));
+                writeBytes(&v, sizeof(double));
+                return;
             }
         case GroupCodeValueType::Byte:
         case GroupCodeValueType::Int16:
         case GroupCodeValueType::ExtendedDataInt16:
             {
                 short v = value.convert<short>();
-                _stream->write(reinterpret_cast<const char *>(&v), sizeof(short));
+                writeBytes(&v, sizeof(short));
+                return;
             }
         case GroupCodeValueType::Int32:
         case GroupCodeValueType::ExtendedDataInt32:
             {
                 int v = value.convert<int>();
-                _stream->write(reinterpret_cast<const char *>(&v), sizeof(int));
+                writeBytes(&v, sizeof(int));
+                return;
             }
         case GroupCodeValueType::Int64:
             {
                 long long v = value.convert<long long>();
-                _stream->write(reinterpret_cast<const char *>(&v), sizeof(long long));
+                writeBytes(&v, sizeof(long long));
+                return;
             }
         case GroupCodeValueType::Handle:
         case GroupCodeValueType::ObjectId:
         case GroupCodeValueType::ExtendedDataHandle:
             {
+                //Handles are hexadecimal strings, as in the ASCII format
+                std::string v = fmt::format("{:X}", value.convert<unsigned long long>());
+                writeBytes(v.c_str(), v.size() + 1);
+                return;
             }
         case GroupCodeValueType::Bool:
             {
-                bool v = value.convert<bool>();
-                _stream->write(reinterpret_cast<const char *>(&v), sizeof(bool));
+                unsigned char v = value.convert<bool>() ? 1 : 0;
+                writeBytes(&v, sizeof(unsigned char));
+                return;
             }
         case GroupCodeValueType::Chunk:
         case GroupCodeValueType::ExtendedDataChunk:
             {
                 std::vector<unsigned char> v = value.convert<std::vector<unsigned char>>();
+                unsigned char length = (unsigned char) v.size();
+                writeBytes(&length, sizeof(unsigned char));
+                writeBytes(v.data(), length);
+                return;
             }
     }
 }
 
-}// namespace dwg
\ No newline at end of file
+void DxfBinaryWriter::writeStringValue(int, std::string_view value)
+{
+    //Null terminated
+    const char terminator = '\0';
+    writeBytes(value.data(), value.size());
+    writeBytes(&terminator, 1);
+}
+
+IDxfStreamWriter *DxfBinaryWriter::createMemoryWriter() const
+{
+    return new DxfBinaryWriter(nullptr, _encoding);
+}
+
+void DxfBinaryWriter::writeBuffer(const IDxfStreamWriter *memoryWriter)
+{
+    const fmt::memory_buffer &buffer = static_cast<const DxfBinaryWriter *>(memoryWriter)->_buffer;
+    writeBytes(buffer.data(), buffer.size());
+}
+
+void DxfBinaryWriter::writeBytes(const void *data, std::size_t size)
+{
+    const char *bytes = static_cast<const char *>(data);
+    _buffer.append(bytes, bytes + size);
+    if (_buffer.size() >= BufferSize)
+    {
+        drain();
+    }
+}
+
+void DxfBinaryWriter::drain()
+{
+    if (_stream && _buffer.size() > 0)
+    {
+        _stream->write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        _buffer.clear();
+    }
+}
+
+}// namespace dwg
@@ -32,6 +32,8 @@
 #include <dwg/io/dxf/writers/IDxfStreamWriter_p.h>
 #include <dwg/tables/BlockRecord.h>
 #include <dwg/tables/Layer.h>
+#include <dwg/tables/collections/BlockRecordsTable.h>
+#include <vector>
 
 namespace dwg {
 
@@ -51,13 +53,24 @@ std::string DxfBlocksSectionWriter::sectionName() const
 
 void DxfBlocksSectionWriter::writeSection()
 {
-    auto &&brs = _document->blockRecords();
-    // for (auto &&b: brs)
-    // {
-    //     writeBlock(b->blockEntity());
-    //     processEntities(b);
-    //     writeBlockEnd(b->blockEnd());
-    // }
+    std::vector<BlockRecord *> records;
+    for (auto &&entry: *_document->blockRecords())
+    {
+        BlockRecord *record = object_cast<BlockRecord>(entry.second);
+        if (record)
+        {
+            records.push_back(record);
+        }
+    }
+
+    //Each block is formatted on its own, model and paper space entities are queued in order
+    writeInParallel<DxfBlocksSectionWriter>(records.size(),
+                                            [&records](DxfBlocksSectionWriter &writer, std::size_t i) {
+                                                BlockRecord *b = records[i];
+                                                writer.writeBlock(b->blockEntity());
+                                                writer.processEntities(b);
+                                                writer.writeBlockEnd(b->blockEnd());
+                                            });
 }
 
 void DxfBlocksSectionWriter::writeBlock(Block *block) {}
@@ -82,7 +95,10 @@ void DxfBlocksSectionWriter::processEntities(BlockRecord *b)
 
 void DxfBlocksSectionWriter::writeBlockEnd(BlockEnd *block)
 {
-    _writer->write(DxfCode::Start, block->objectName());
+    if (!block)
+        return;
+
+    _writer->writeToken(DxfCode::Start, block->objectName());
     writeCommonObjectData(block);
     _writer->write(DxfCode::Subclass, DxfSubclassMarker::Entity);
     _writer->write(8, block->layer()->name());
@@ -20,7 +20,9 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/DxfFileToken_p.h>
 #include <dwg/io/dxf/writers/DxfEntitiesSectionWriter_p.h>
+#include <vector>
 
 namespace dwg {
 
@@ -35,9 +37,29 @@ DxfEntitiesSectionWriter::~DxfEntitiesSectionWriter() {}
 
 std::string DxfEntitiesSectionWriter::sectionName() const
 {
-    return std::string();
+    return DxfFileToken::EntitiesSection;
 }
 
-void DxfEntitiesSectionWriter::writeSection() {}
+void DxfEntitiesSectionWriter::writeSection()
+{
+    std::vector<Entity *> entities;
+    entities.reserve(_holder->entities().size());
+    while (!_holder->entities().empty())
+    {
+        entities.push_back(_holder->entities().front());
+        _holder->entities().pop();
+    }
+
+    //Records do not depend on each other once the handles are set
+    writeInParallel<DxfEntitiesSectionWriter>(
+            entities.size(), [&entities](DxfEntitiesSectionWriter &writer, std::size_t i) {
+                writer.writeEntity(entities[i]);
+            });
+}
+
+void DxfEntitiesSectionWriter::append(Entity *entity)
+{
+    writeEntity(entity);
+}
 
 }// namespace dwg
\ No newline at end of file
@@ -40,6 +40,11 @@ DxfHeaderSectionWriter::DxfHeaderSectionWriter(IDxfStreamWriter *writer, CadDocu
 
 DxfHeaderSectionWriter::~DxfHeaderSectionWriter() {}
 
+void DxfHeaderSectionWriter::setHandleSeed(unsigned long long value)
+{
+    _handleSeed = value;
+}
+
 std::string DxfHeaderSectionWriter::sectionName() const
 {
     return DxfFileToken::HeaderSection;
@@ -47,7 +52,7 @@ std::string DxfHeaderSectionWriter::sectionName() const
 
 void DxfHeaderSectionWriter::writeSection()
 {
-    std::map<std::string, CadSystemVariableAttribute> mapAttr = CadSystemVariables::headerMap();
+    auto &&mapAttr = CadSystemVariables::headerMap();
     auto &&configue_variables = _configuration.headerVariables();
     for (auto &&[key, value]: mapAttr)
     {
@@ -68,7 +73,7 @@ void DxfHeaderSectionWriter::writeSection()
 
         if (key == "$HANDSEED")//Not very elegant but by now...
         {
-            _writer->write(DxfCode::Handle, _document->header()->handleSeed());
+            _writer->write(DxfCode::Handle, _handleSeed.value_or(_document->header()->handleSeed()));
             continue;
         }
 
@@ -80,7 +80,7 @@ void DxfObjectsSectionWriter::writeSection()
 void DxfObjectsSectionWriter::writeObject(CadObject *co)
 {
 #define CHECK_OBJECT(T)                                        \
-    if (!dynamic_cast<T *>(co))                                \
+    if (!object_cast<T>(co))                                   \
     {                                                          \
         notify(fmt::format("Object not implemented :{}", #T)); \
     }
@@ -96,27 +96,51 @@ void DxfObjectsSectionWriter::writeObject(CadObject *co)
 
 #undef CHECK_OBJECT
 
-    if (dynamic_cast<XRecord *>(co) && !_configuration.writeXRecords())
+    if (object_cast<XRecord>(co) && !_configuration.writeXRecords())
     {
         return;
     }
 
-    _writer->write(DxfCode::Start, co->objectName());
+    _writer->writeToken(DxfCode::Start, co->objectName());
 
     writeCommonObjectData(co);
+    switch (co->objectType())
+    {
+        case ObjectType::DICTIONARY:
+            writeDictionary(static_cast<CadDictionary *>(co));
+            break;
+        case ObjectType::GROUP:
+            writeGroup(static_cast<Group *>(co));
+            break;
+        case ObjectType::LAYOUT:
+            writeLayout(static_cast<Layout *>(co));
+            break;
+        case ObjectType::MLINESTYLE:
+            writeMLineStyle(static_cast<MLineStyle *>(co));
+            break;
+        case ObjectType::XRECORD:
+            writeXRecord(static_cast<XRecord *>(co));
+            break;
+        default:
+            writeUnlistedObject(co);
+            break;
+    }
+
+    writeExtendedData(co->hasExtendedData() ? co->extendedData() : nullptr);
+}
+
+void DxfObjectsSectionWriter::writeUnlistedObject(CadObject *co)
+{
+    //Objects without an object type of their own
     BookColor *bookColor = dynamic_cast<BookColor *>(co);
     CadDictionary *cadDictionary = dynamic_cast<CadDictionary *>(co);
     DictionaryVariable *dictvar = dynamic_cast<DictionaryVariable *>(co);
     GeoData *geodata = dynamic_cast<GeoData *>(co);
-    Group *group = dynamic_cast<Group *>(co);
     ImageDefinition *imageDefinition = dynamic_cast<ImageDefinition *>(co);
-    Layout *layout = dynamic_cast<Layout *>(co);
-    MLineStyle *mlStyle = dynamic_cast<MLineStyle *>(co);
     MultiLeaderStyle *multiLeaderlStyle = dynamic_cast<MultiLeaderStyle *>(co);
     PlotSettings *plotSettings = dynamic_cast<PlotSettings *>(co);
     Scale *scale = dynamic_cast<Scale *>(co);
     SortEntitiesTable *sortensTable = dynamic_cast<SortEntitiesTable *>(co);
-    XRecord *record = dynamic_cast<XRecord *>(co);
     if (bookColor)
     {
         writeBookColor(bookColor);
@@ -133,22 +157,10 @@ void DxfObjectsSectionWriter::writeObject(CadObject *co)
     {
         writeGeoData(geodata);
     }
-    else if (group)
-    {
-        writeGroup(group);
-    }
     else if (imageDefinition)
     {
         writeImageDefinition(imageDefinition);
     }
-    else if (layout)
-    {
-        writeLayout(layout);
-    }
-    else if (mlStyle)
-    {
-        writeMLineStyle(mlStyle);
-    }
     else if (multiLeaderlStyle)
     {
         writeMultiLeaderStyle(multiLeaderlStyle);
@@ -165,16 +177,10 @@ void DxfObjectsSectionWriter::writeObject(CadObject *co)
     {
         writeSortentsTable(sortensTable);
     }
-    else if (record)
-    {
-        writeXRecord(record);
-    }
     else
     {
         throw std::runtime_error("Object not implemented");
     }
-
-    writeExtendedData(co->extendedData());
 }
 
 void DxfObjectsSectionWriter::writeBookColor(BookColor *color)
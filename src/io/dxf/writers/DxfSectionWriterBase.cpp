@@ -22,6 +22,9 @@
 
 #include <dwg/CadDocument.h>
 #include <dwg/DxfFileToken_p.h>
+#include <dwg/DxfSubclassMarker_p.h>
+#include <dwg/entities/Entity.h>
+#include <dwg/tables/Layer.h>
 #include <dwg/header/CadHeader.h>
 #include <dwg/io/dxf/writers/DxfSectionWriterBase_p.h>
 #include <dwg/io/dxf/writers/IDxfStreamWriter_p.h>
@@ -56,14 +59,38 @@ CadObjectHolder *DxfSectionWriterBase::holder()
     return _holder;
 }
 
-void DxfSectionWriterBase::writeCommonObjectData(CadObject *object) {}
+void DxfSectionWriterBase::writeCommonObjectData(CadObject *object)
+{
+    //The dimension styles keep their handle in 105, 5 is the DIMBLK name
+    if (object->objectType() == ObjectType::DIMSTYLE)
+    {
+        _writer->write(DxfCode::DimVarHandle, object->handle());
+    }
+    else
+    {
+        _writer->write(DxfCode::Handle, object->handle());
+    }
+
+    if (object->owner())
+    {
+        _writer->write(DxfCode::SoftPointerId, object->owner()->handle());
+    }
+}
 
 void DxfSectionWriterBase::writeExtendedData(ExtendedDataDictionary *xdata) {}
 
-void DxfSectionWriterBase::writeCommonEntityData(Entity *entity) {}
+void DxfSectionWriterBase::writeCommonEntityData(Entity *entity)
+{
+    _writer->write(DxfCode::Subclass, DxfSubclassMarker::Entity);
+
+    _writer->writeName(8, entity->layer());
+}
 
 void DxfSectionWriterBase::writeLongTextValue(int code, int subcode, const std::string &text) {}
 
-void DxfSectionWriterBase::notify(const std::string &, Notification notificationType) {}
+void DxfSectionWriterBase::notify(const std::string &message, Notification notificationType)
+{
+    OnNotification(message, notificationType);
+}
 
 }// namespace dwg
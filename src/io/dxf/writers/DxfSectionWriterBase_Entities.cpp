@@ -90,159 +90,148 @@ void DxfSectionWriterBase::writeEntity(Entity *entity)
     assert(entity);
     //TODO: Implement complex entities in a separated branch
 
-    if (dynamic_cast<TableEntry *>(entity) || dynamic_cast<Solid3D *>(entity) || dynamic_cast<UnknownEntity *>(entity))
+    if (object_cast<Solid3D>(entity) || object_cast<UnknownEntity>(entity))
     {
         notify(fmt::format("Entity type not implemented : {entity.GetType().FullName}"));
     }
 
-    _writer->write(DxfCode::Start, entity->objectName());
+    _writer->writeToken(DxfCode::Start, entity->objectName());
 
     writeCommonObjectData(entity);
 
     writeCommonEntityData(entity);
 
-    Arc *arc = dynamic_cast<Arc *>(entity);
-    Circle *circle = dynamic_cast<Circle *>(entity);
-    Dimension *dimension = dynamic_cast<Dimension *>(entity);
-    Ellipse *ellipse = dynamic_cast<Ellipse *>(entity);
-    Face3D *face3D = dynamic_cast<Face3D *>(entity);
-    Hatch *hatch = dynamic_cast<Hatch *>(entity);
-    Insert *insert = dynamic_cast<Insert *>(entity);
-    Leader *leader = dynamic_cast<Leader *>(entity);
-    Line *line = dynamic_cast<Line *>(entity);
-    LwPolyline *lwPolyline = dynamic_cast<LwPolyline *>(entity);
-    Mesh *mesh = dynamic_cast<Mesh *>(entity);
-    MLine *mline = dynamic_cast<MLine *>(entity);
-    MText *mtext = dynamic_cast<MText *>(entity);
-    MultiLeader *multiLeader = dynamic_cast<MultiLeader *>(entity);
-    Point *point = dynamic_cast<Point *>(entity);
-    Polyline *polyline = dynamic_cast<Polyline *>(entity);
-    RasterImage *rasterImage = dynamic_cast<RasterImage *>(entity);
-    Ray *ray = dynamic_cast<Ray *>(entity);
-    Shape *shape = dynamic_cast<Shape *>(entity);
-    Solid *solid = dynamic_cast<Solid *>(entity);
-    Spline *spline = dynamic_cast<Spline *>(entity);
-    TextEntity *text = dynamic_cast<TextEntity *>(entity);
-    Tolerance *tolerance = dynamic_cast<Tolerance *>(entity);
-    Vertex *vertex = dynamic_cast<Vertex *>(entity);
-    Viewport *viewport = dynamic_cast<Viewport *>(entity);
-    Wipeout *wipeout = dynamic_cast<Wipeout *>(entity);
-    XLine *xline = dynamic_cast<XLine *>(entity);
-
-    if (arc)
-    {
-        writeArc(arc);
-    }
-    else if (circle)
-    {
-        writeCircle(circle);
-    }
-    else if (dimension)
-    {
-        writeDimension(dimension);
-    }
-    else if (ellipse)
-    {
-        writeEllipse(ellipse);
-    }
-    else if (face3D)
-    {
-        writeFace3D(face3D);
-    }
-    else if (hatch)
-    {
-        writeHatch(hatch);
-    }
-    else if (insert)
-    {
-        writeInsert(insert);
-    }
-    else if (leader)
-    {
-        writeLeader(leader);
-    }
-    else if (line)
-    {
-        writeLine(line);
-    }
-    else if (lwPolyline)
-    {
-        writeLwPolyline(lwPolyline);
-    }
-    else if (mesh)
+    switch (entity->objectType())
+    {
+        case ObjectType::ARC:
+            writeArc(static_cast<Arc *>(entity));
+            break;
+        case ObjectType::CIRCLE:
+            writeCircle(static_cast<Circle *>(entity));
+            break;
+        case ObjectType::DIMENSION_ORDINATE:
+        case ObjectType::DIMENSION_LINEAR:
+        case ObjectType::DIMENSION_ALIGNED:
+        case ObjectType::DIMENSION_ANG_3_Pt:
+        case ObjectType::DIMENSION_ANG_2_Ln:
+        case ObjectType::DIMENSION_RADIUS:
+        case ObjectType::DIMENSION_DIAMETER:
+            writeDimension(static_cast<Dimension *>(entity));
+            break;
+        case ObjectType::ELLIPSE:
+            writeEllipse(static_cast<Ellipse *>(entity));
+            break;
+        case ObjectType::FACE3D:
+            writeFace3D(static_cast<Face3D *>(entity));
+            break;
+        case ObjectType::HATCH:
+            writeHatch(static_cast<Hatch *>(entity));
+            break;
+        case ObjectType::INSERT:
+        case ObjectType::MINSERT:
+            writeInsert(static_cast<Insert *>(entity));
+            break;
+        case ObjectType::LEADER:
+            writeLeader(static_cast<Leader *>(entity));
+            break;
+        case ObjectType::LINE:
+            writeLine(static_cast<Line *>(entity));
+            break;
+        case ObjectType::LWPOLYLINE:
+            writeLwPolyline(static_cast<LwPolyline *>(entity));
+            break;
+        case ObjectType::MLINE:
+            writeMLine(static_cast<MLine *>(entity));
+            break;
+        case ObjectType::MTEXT:
+            writeMText(static_cast<MText *>(entity));
+            break;
+        case ObjectType::POINT:
+            writePoint(static_cast<Point *>(entity));
+            break;
+        case ObjectType::POLYLINE_2D:
+        case ObjectType::POLYLINE_3D:
+        case ObjectType::POLYLINE_PFACE:
+        case ObjectType::POLYLINE_MESH:
+            writePolyline(static_cast<Polyline *>(entity));
+            break;
+        case ObjectType::RAY:
+            writeRay(static_cast<Ray *>(entity));
+            break;
+        case ObjectType::SHAPE:
+            writeShape(static_cast<Shape *>(entity));
+            break;
+        case ObjectType::SOLID:
+            writeSolid(static_cast<Solid *>(entity));
+            break;
+        case ObjectType::SPLINE:
+            writeSpline(static_cast<Spline *>(entity));
+            break;
+        case ObjectType::TEXT:
+        case ObjectType::ATTRIB:
+        case ObjectType::ATTDEF:
+            writeTextEntity(static_cast<TextEntity *>(entity));
+            break;
+        case ObjectType::TOLERANCE:
+            writeTolerance(static_cast<Tolerance *>(entity));
+            break;
+        case ObjectType::VERTEX_2D:
+        case ObjectType::VERTEX_3D:
+        case ObjectType::VERTEX_MESH:
+        case ObjectType::VERTEX_PFACE:
+        case ObjectType::VERTEX_PFACE_FACE:
+            writeVertex(static_cast<Vertex *>(entity));
+            break;
+        case ObjectType::VIEWPORT:
+            writeViewport(static_cast<Viewport *>(entity));
+            break;
+        case ObjectType::XLINE:
+            writeXLine(static_cast<XLine *>(entity));
+            break;
+        default:
+            writeUnlistedEntity(entity);
+            break;
+    }
+
+    writeExtendedData(entity->hasExtendedData() ? entity->extendedData() : nullptr);
+}
+
+void DxfSectionWriterBase::writeUnlistedEntity(Entity *entity)
+{
+    //Entities without an object type of their own, or reporting a placeholder type.
+    //Cast one type at a time so the first match ends the lookup
+    if (Mesh *mesh = dynamic_cast<Mesh *>(entity))
     {
         writeMesh(mesh);
     }
-    else if (mline)
-    {
-        writeMLine(mline);
-    }
-    else if (mtext)
-    {
-        writeMText(mtext);
-    }
-    else if (multiLeader)
+    else if (MultiLeader *multiLeader = dynamic_cast<MultiLeader *>(entity))
     {
         writeMultiLeader(multiLeader);
     }
-    else if (point)
-    {
-        writePoint(point);
-    }
-    else if (polyline)
-    {
-        writePolyline(polyline);
-    }
-    else if (rasterImage)
+    else if (RasterImage *rasterImage = dynamic_cast<RasterImage *>(entity))
     {
         writeCadImage(rasterImage);
     }
-    else if (ray)
-    {
-        writeRay(ray);
-    }
-    else if (shape)
-    {
-        writeShape(shape);
-    }
-    else if (solid)
-    {
-        writeSolid(solid);
-    }
-    else if (spline)
-    {
-        writeSpline(spline);
-    }
-    else if (text)
+    else if (Wipeout *wipeout = dynamic_cast<Wipeout *>(entity))
     {
-        writeTextEntity(text);
-    }
-    else if (tolerance)
-    {
-        writeTolerance(tolerance);
-    }
-    else if (vertex)
-    {
-        writeVertex(vertex);
+        writeCadImage(wipeout);
     }
-    else if (viewport)
+    else if (Dimension *dimension = dynamic_cast<Dimension *>(entity))
     {
-        writeViewport(viewport);
+        writeDimension(dimension);
     }
-    else if (wipeout)
+    else if (Insert *insert = dynamic_cast<Insert *>(entity))
     {
-        writeCadImage(wipeout);
+        writeInsert(insert);
     }
-    else if (xline)
+    else if (Polyline *polyline = dynamic_cast<Polyline *>(entity))
     {
-        writeXLine(xline);
+        writePolyline(polyline);
     }
     else
     {
         throw std::runtime_error(fmt::format("Entity not implemented {entity.GetType().FullName}"));
     }
-
-    writeExtendedData(entity->extendedData());
 }
 
 void DxfSectionWriterBase::writeArc(Arc *arc)
@@ -291,39 +280,29 @@ void DxfSectionWriterBase::writeDimension(Dimension *dim)
 
     _writer->writeName(3, dim->style());
 
-    DimensionAligned *aligned = dynamic_cast<DimensionAligned *>(dim);
-    DimensionRadius *radius = dynamic_cast<DimensionRadius *>(dim);
-    DimensionDiameter *diameter = dynamic_cast<DimensionDiameter *>(dim);
-    DimensionAngular2Line *angular2Line = dynamic_cast<DimensionAngular2Line *>(dim);
-    DimensionAngular3Pt *angular3Pt = dynamic_cast<DimensionAngular3Pt *>(dim);
-    DimensionOrdinate *ordinate = dynamic_cast<DimensionOrdinate *>(dim);
-    if (aligned)
-    {
-        writeDimensionAligned(aligned);
-    }
-    else if (radius)
-    {
-        writeDimensionRadius(radius);
-    }
-    else if (diameter)
-    {
-        writeDimensionDiameter(diameter);
-    }
-    else if (angular2Line)
-    {
-        writeDimensionAngular2Line(angular2Line);
-    }
-    else if (angular3Pt)
-    {
-        writeDimensionAngular3Pt(angular3Pt);
-    }
-    else if (ordinate)
-    {
-        writeDimensionOrdinate(ordinate);
-    }
-    else
-    {
-        throw std::runtime_error("Dimension type not implemented");
+    switch (dim->objectType())
+    {
+        case ObjectType::DIMENSION_ALIGNED:
+        case ObjectType::DIMENSION_LINEAR:
+            writeDimensionAligned(static_cast<DimensionAligned *>(dim));
+            break;
+        case ObjectType::DIMENSION_RADIUS:
+            writeDimensionRadius(static_cast<DimensionRadius *>(dim));
+            break;
+        case ObjectType::DIMENSION_DIAMETER:
+            writeDimensionDiameter(static_cast<DimensionDiameter *>(dim));
+            break;
+        case ObjectType::DIMENSION_ANG_2_Ln:
+            writeDimensionAngular2Line(static_cast<DimensionAngular2Line *>(dim));
+            break;
+        case ObjectType::DIMENSION_ANG_3_Pt:
+            writeDimensionAngular3Pt(static_cast<DimensionAngular3Pt *>(dim));
+            break;
+        case ObjectType::DIMENSION_ORDINATE:
+            writeDimensionOrdinate(static_cast<DimensionOrdinate *>(dim));
+            break;
+        default:
+            throw std::runtime_error("Dimension type not implemented");
     }
 }
 
@@ -334,7 +313,7 @@ void DxfSectionWriterBase::writeDimensionAligned(DimensionAligned *aligned)
     _writer->write(13, aligned->firstPoint());
     _writer->write(14, aligned->secondPoint());
 
-    DimensionLinear *linear = dynamic_cast<DimensionLinear *>(aligned);
+    DimensionLinear *linear = object_cast<DimensionLinear>(aligned);
     if (linear)
     {
         writeDimensionLinear(linear);
@@ -433,16 +412,20 @@ void DxfSectionWriterBase::writeHatch(Hatch *hatch)
 void DxfSectionWriterBase::writeBoundaryPath(HatchBoundaryPath *path)
 {
     auto writeHatchBoundaryPathEdge = [&](HatchBoundaryPath::HBP_Edge *edge) {
-        if (dynamic_cast<HatchBoundaryPath::HBP_Polyline *>(edge) == nullptr)
+        //Every edge class reports a type of its own
+        using EdgeType = HatchBoundaryPath::HBP_EdgeType;
+        EdgeType type = edge->type();
+        if (type != EdgeType::HBP_Polyline)
         {
-            _writer->write(72, (int) edge->type());
+            _writer->write(72, (int) type);
         }
 
-        auto arc = dynamic_cast<HatchBoundaryPath::HBP_Arc *>(edge);
-        auto ellipse = dynamic_cast<HatchBoundaryPath::HBP_Ellipse *>(edge);
-        auto line = dynamic_cast<HatchBoundaryPath::HBP_Line *>(edge);
-        auto poly = dynamic_cast<HatchBoundaryPath::HBP_Polyline *>(edge);
-        auto spline = dynamic_cast<HatchBoundaryPath::HBP_Spline *>(edge);
+        auto arc = type == EdgeType::HBP_CircularArc ? static_cast<HatchBoundaryPath::HBP_Arc *>(edge) : nullptr;
+        auto ellipse =
+                type == EdgeType::HBP_EllipticArc ? static_cast<HatchBoundaryPath::HBP_Ellipse *>(edge) : nullptr;
+        auto line = type == EdgeType::HBP_Line ? static_cast<HatchBoundaryPath::HBP_Line *>(edge) : nullptr;
+        auto poly = type == EdgeType::HBP_Polyline ? static_cast<HatchBoundaryPath::HBP_Polyline *>(edge) : nullptr;
+        auto spline = type == EdgeType::HBP_Spline ? static_cast<HatchBoundaryPath::HBP_Spline *>(edge) : nullptr;
         if (arc)
         {
             _writer->write(10, arc->center());
@@ -584,7 +567,7 @@ void DxfSectionWriterBase::writeFace3D(Face3D *face)
 
 void DxfSectionWriterBase::writeInsert(Insert *insert)
 {
-    _writer->write(DxfCode::Subclass, insert->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, insert->subclassMarker());
 
     _writer->writeName(2, insert->block());
 
@@ -961,7 +944,7 @@ void DxfSectionWriterBase::writePoint(Point *line)
 
 void DxfSectionWriterBase::writePolyline(Polyline *polyline)
 {
-    _writer->write(DxfCode::Subclass, polyline->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, polyline->subclassMarker());
 
     _writer->write(DxfCode::XCoordinate, 0);
     _writer->write(DxfCode::YCoordinate, 0);
@@ -985,7 +968,7 @@ void DxfSectionWriterBase::writePolyline(Polyline *polyline)
 
 void DxfSectionWriterBase::writeSeqend(Seqend *seqend)
 {
-    _writer->write(0, seqend->objectName());
+    _writer->writeToken(0, seqend->objectName());
     _writer->write(5, seqend->handle());
     _writer->write(330, seqend->owner()->handle());
     _writer->write(DxfCode::Subclass, DxfSubclassMarker::Entity);
@@ -1127,10 +1110,10 @@ void DxfSectionWriterBase::writeTextEntity(TextEntity *text)
         }
     }
 
-    if (dynamic_cast<AttributeBase *>(text))
+    if (object_cast<AttributeBase>(text))
     {
-        AttributeEntity *att = dynamic_cast<AttributeEntity *>(text);
-        AttributeDefinition *attdef = dynamic_cast<AttributeDefinition *>(text);
+        AttributeEntity *att = object_cast<AttributeEntity>(text);
+        AttributeDefinition *attdef = object_cast<AttributeDefinition>(text);
         if (att)
         {
             _writer->write(DxfCode::Subclass, DxfSubclassMarker::Attribute);
@@ -1151,7 +1134,7 @@ void DxfSectionWriterBase::writeTextEntity(TextEntity *text)
 
 void DxfSectionWriterBase::writeTolerance(Tolerance *tolerance)
 {
-    _writer->write(DxfCode::Subclass, tolerance->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, tolerance->subclassMarker());
 
     _writer->writeName(3, tolerance->style());
 
@@ -1186,7 +1169,7 @@ void DxfSectionWriterBase::writeAttributeBase(AttributeBase *att)
 void DxfSectionWriterBase::writeVertex(Vertex *v)
 {
     _writer->write(DxfCode::Subclass, DxfSubclassMarker::Vertex);
-    _writer->write(DxfCode::Subclass, v->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, v->subclassMarker());
 
     _writer->write(10, v->location());
 
@@ -1194,7 +1177,7 @@ void DxfSectionWriterBase::writeVertex(Vertex *v)
     _writer->write(41, v->endWidth());
     _writer->write(42, v->bulge());
 
-    _writer->write(70, v->flags());
+    _writer->write(70, (short) v->flags());
 
     _writer->write(50, v->curveTangent());
 }
@@ -1254,7 +1237,7 @@ void DxfSectionWriterBase::writeViewport(Viewport *vp)
 
 void DxfSectionWriterBase::writeCadImage(CadWipeoutBase *image)
 {
-    _writer->write(DxfCode::Subclass, image->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, image->subclassMarker());
 
     _writer->write(90, image->classVersion());
 
@@ -24,12 +24,26 @@
 #include <dwg/GroupCodeValue.h>
 #include <dwg/IHandledCadObject.h>
 #include <dwg/INamedCadObject.h>
+#include <dwg/io/dxf/DxfCaretEscape_p.h>
 #include <dwg/io/dxf/writers/DxfStreamWriterBase_p.h>
+#include <dwg/utils/DateTime.h>
 #include <dwg/utils/EndianConverter.h>
-#include <dwg/utils/StringHelp.h>
 
 namespace dwg {
 
+static bool isStringGroupCode(int code)
+{
+    switch (GroupCodeValue::transformValue(code))
+    {
+        case GroupCodeValueType::String:
+        case GroupCodeValueType::Comment:
+        case GroupCodeValueType::ExtendedDataString:
+            return true;
+        default:
+            return false;
+    }
+}
+
 DxfStreamWriterBase::DxfStreamWriterBase() {}
 
 DxfStreamWriterBase::~DxfStreamWriterBase() {}
@@ -56,23 +70,74 @@ void DxfStreamWriterBase::write(int code, DwgVariant value, DxfClassMap *clsmap)
     {
     }
 
+    if (value.type() == typeid(XYZ) || value.type() == typeid(XY))
+    {
+        writeCoordinate(code, value);
+        return;
+    }
+
+    //Dates are written as julian days, time spans as days
+    if (value.type() == typeid(DateTime))
+    {
+        value = value.extract<DateTime>().julianDay();
+    }
+    else if (value.type() == typeid(Timespan))
+    {
+        value = value.extract<Timespan>().totalMicroseconds() / 86400000000.0;
+    }
+
     writeDxfCode(code);
 
-    if (value.isString())
+    if (!value.isString() || !isStringGroupCode(code))
     {
-        std::string s = value.convert<std::string>();
-        s = StringHelp::replace(s, "^", "^ ");
-        s = StringHelp::replace(s, "\n", "^J");
-        s = StringHelp::replace(s, "\r", "^M");
-        s = StringHelp::replace(s, "\t", "^I");
-        writeValue(code, s);
+        writeValue(code, value);
+        return;
+    }
+
+    //Narrow strings are written from the variant storage, without a copy
+    if (value.type() == typeid(std::string))
+    {
+        writeEscapedString(code, value.extract<std::string>());
     }
     else
     {
-        writeValue(code, value);
+        writeEscapedString(code, value.convert<std::string>());
     }
 }
 
+void DxfStreamWriterBase::writeCoordinate(int code, const DwgVariant &value)
+{
+    //The components go with the group code of the first one plus 10 per axis
+    if (value.type() == typeid(XY))
+    {
+        const XY &xy = value.extract<XY>();
+        writeDxfCode(code);
+        writeValue(code, xy.X);
+        writeDxfCode(code + 10);
+        writeValue(code + 10, xy.Y);
+        return;
+    }
+
+    const XYZ &xyz = value.extract<XYZ>();
+    writeDxfCode(code);
+    writeValue(code, xyz.X);
+    writeDxfCode(code + 10);
+    writeValue(code + 10, xyz.Y);
+    writeDxfCode(code + 20);
+    writeValue(code + 20, xyz.Z);
+}
+
+void DxfStreamWriterBase::writeToken(DxfCode code, std::string_view value)
+{
+    writeToken((int) code, value);
+}
+
+void DxfStreamWriterBase::writeToken(int code, std::string_view value)
+{
+    writeDxfCode(code);
+    writeEscapedString(code, value);
+}
+
 void DxfStreamWriterBase::writeTrueColor(int code, const Color &color, DxfClassMap *clsmap)
 {
     unsigned char arr[4] = {0};
@@ -124,4 +189,18 @@ void DxfStreamWriterBase::writeName(int code, INamedCadObject *value, DxfClassMa
     }
 }
 
+void DxfStreamWriterBase::writeEscapedString(int code, std::string_view value)
+{
+    //Single scan, the value is only copied when it has something to escape
+    std::size_t first = DxfCaretEscape::findEscaped(value);
+    if (first == std::string_view::npos)
+    {
+        writeStringValue(code, value);
+    }
+    else
+    {
+        writeStringValue(code, DxfCaretEscape::escape(value, first));
+    }
+}
+
 }// namespace dwg
\ No newline at end of file
@@ -78,13 +78,13 @@ void DxfTablesSectionWriter::writeSection()
 void DxfTablesSectionWriter::writeTable(Table *table, const std::string &subclass)
 {
     _writer->write(DxfCode::Start, DxfFileToken::TableEntry_);
-    _writer->write(DxfCode::SymbolTableName, table->objectName());
+    _writer->writeToken(DxfCode::SymbolTableName, table->objectName());
 
     writeCommonObjectData(table);
 
     _writer->write(DxfCode::Subclass, DxfSubclassMarker::Table);
 
-    _writer->write(70, table->size());
+    _writer->write(70, (short) table->size());
 
     if (!subclass.empty())
     {
@@ -101,14 +101,14 @@ void DxfTablesSectionWriter::writeTable(Table *table, const std::string &subclas
 
 void DxfTablesSectionWriter::writeEntry(TableEntry *entry)
 {
-    _writer->write(DxfCode::Start, entry->objectName());
+    _writer->writeToken(DxfCode::Start, entry->objectName());
 
     writeCommonObjectData(entry);
 
     _writer->write(DxfCode::Subclass, DxfSubclassMarker::TableRecord);
-    _writer->write(DxfCode::Subclass, entry->subclassMarker());
+    _writer->writeToken(DxfCode::Subclass, entry->subclassMarker());
 
-    auto ts = dynamic_cast<TextStyle *>(entry);
+    auto ts = object_cast<TextStyle>(entry);
     if (ts && ts->isShapeFile())
     {
         _writer->write(DxfCode::SymbolTableName, std::string());
@@ -120,51 +120,37 @@ void DxfTablesSectionWriter::writeEntry(TableEntry *entry)
 
     _writer->write(70, (int) entry->flags());
 
-    BlockRecord *block = dynamic_cast<BlockRecord *>(entry);
-    DimensionStyle *style = dynamic_cast<DimensionStyle *>(entry);
-    Layer *layer = dynamic_cast<Layer *>(entry);
-    LineType *ltype = dynamic_cast<LineType *>(entry);
-    TextStyle *textStyle = dynamic_cast<TextStyle *>(entry);
-    UCS *ucs = dynamic_cast<UCS *>(entry);
-    View *view = dynamic_cast<View *>(entry);
-    VPort *vport = dynamic_cast<VPort *>(entry);
-    if (block)
-    {
-        writeBlockRecord(block, nullptr);
-    }
-    else if (style)
-    {
-        writeDimensionStyle(style, nullptr);
-    }
-    else if (layer)
-    {
-        writeLayer(layer, nullptr);
-    }
-    else if (ltype)
-    {
-        writeLineType(ltype, nullptr);
-    }
-    else if (textStyle)
-    {
-        writeTextStyle(textStyle, nullptr);
-    }
-    else if (ucs)
-    {
-        writeUcs(ucs, nullptr);
-    }
-    else if (view)
-    {
-        writeView(view, nullptr);
-    }
-    else if (vport)
-    {
-        writeVPort(vport, nullptr);
-    }
-    else
+    switch (entry->objectType())
     {
+        case ObjectType::BLOCK_HEADER:
+            writeBlockRecord(static_cast<BlockRecord *>(entry), nullptr);
+            break;
+        case ObjectType::DIMSTYLE:
+            writeDimensionStyle(static_cast<DimensionStyle *>(entry), nullptr);
+            break;
+        case ObjectType::LAYER:
+            writeLayer(static_cast<Layer *>(entry), nullptr);
+            break;
+        case ObjectType::LTYPE:
+            writeLineType(static_cast<LineType *>(entry), nullptr);
+            break;
+        case ObjectType::STYLE:
+            writeTextStyle(static_cast<TextStyle *>(entry), nullptr);
+            break;
+        case ObjectType::UCS:
+            writeUcs(static_cast<UCS *>(entry), nullptr);
+            break;
+        case ObjectType::VIEW:
+            writeView(static_cast<View *>(entry), nullptr);
+            break;
+        case ObjectType::VPORT:
+            writeVPort(static_cast<VPort *>(entry), nullptr);
+            break;
+        default:
+            break;
     }
 
-    writeExtendedData(entry->extendedData());
+    writeExtendedData(entry->hasExtendedData() ? entry->extendedData() : nullptr);
 }
 
 void DxfTablesSectionWriter::writeBlockRecord(BlockRecord *block, DxfClassMap *clsmap)
@@ -37,7 +37,7 @@ double DimensionPlaceHolder::measurement() const
     return 0.0;
 }
 
-std::string DimensionPlaceHolder::objectName() const
+std::string_view DimensionPlaceHolder::objectName() const
 {
     return DxfFileToken::EntityDimension;
 }
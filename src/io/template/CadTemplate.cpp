@@ -20,32 +20,52 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/io/template/CadTemplate_p.h>
 
 namespace dwg {
 
-CadTemplate::CadTemplate(CadObject *obj) {}
+CadTemplate::CadTemplate(CadObject *obj) : _object(obj) {}
+
+void *CadTemplate::operator new(std::size_t size)
+{
+    return CadMemoryScope::allocate(size, CadMemoryScope::templateResource());
+}
+
+void CadTemplate::operator delete(void *ptr, std::size_t size)
+{
+    CadMemoryScope::deallocate(ptr, size);
+}
 
 CadObject *CadTemplate::cadObject() const
 {
-    return nullptr;
+    return _object;
 }
 
-void CadTemplate::setCadObject(CadObject *v) {}
+void CadTemplate::setCadObject(CadObject *v)
+{
+    _object = v;
+}
 
 std::optional<unsigned long long> CadTemplate::ownerHandle() const
 {
-    return std::nullopt;
+    return _ownerHandle;
 }
 
-void CadTemplate::setOwnerHandle(unsigned long long) {}
+void CadTemplate::setOwnerHandle(unsigned long long value)
+{
+    _ownerHandle = value;
+}
 
 std::optional<unsigned long long> CadTemplate::xdictHandle() const
 {
-    return std::nullopt;
+    return _xdictHandle;
 }
 
-void CadTemplate::setXDictHandle(unsigned long long) {}
+void CadTemplate::setXDictHandle(unsigned long long value)
+{
+    _xdictHandle = value;
+}
 
 
 std::vector<unsigned long long> CadTemplate::reactorsHandles() const
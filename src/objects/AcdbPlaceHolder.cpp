@@ -35,12 +35,12 @@ ObjectType AcdbPlaceHolder::objectType() const
     return ObjectType::ACDBPLACEHOLDER;
 }
 
-std::string AcdbPlaceHolder::objectName() const
+std::string_view AcdbPlaceHolder::objectName() const
 {
     return DxfFileToken::ObjectPlaceholder;
 }
 
-std::string AcdbPlaceHolder::subclassMarker() const
+std::string_view AcdbPlaceHolder::subclassMarker() const
 {
     return DxfSubclassMarker::AcDbPlaceHolder;
 }
@@ -39,17 +39,17 @@ ObjectType BookColor::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string BookColor::objectName() const
+std::string_view BookColor::objectName() const
 {
     return DxfFileToken::ObjectDBColor;
 }
 
-std::string BookColor::subclassMarker() const
+std::string_view BookColor::subclassMarker() const
 {
     return DxfSubclassMarker::DbColor;
 }
 
-std::string BookColor::name() const
+const std::string &BookColor::name() const
 {
     return _name;
 }
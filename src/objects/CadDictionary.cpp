@@ -21,12 +21,14 @@
  */
 
 #include <assert.h>
+#include <dwg/CadDocument.h>
 #include <dwg/DxfFileToken_p.h>
 #include <dwg/DxfSubclassMarker_p.h>
 #include <dwg/objects/CadDictionary.h>
 #include <dwg/objects/MLineStyle.h>
 #include <dwg/objects/MultiLeaderStyle.h>
 #include <dwg/objects/Scale.h>
+#include <fmt/core.h>
 #include <stdexcept>
 
 namespace dwg {
@@ -107,19 +109,25 @@ CadDictionary::CadDictionary() {}
 
 CadDictionary::CadDictionary(const std::string &name) : NonGraphicalObject(name) {}
 
-CadDictionary::~CadDictionary() {}
+CadDictionary::~CadDictionary()
+{
+    for (auto &&[key, value]: _entries)
+    {
+        releaseKey(key);
+    }
+}
 
 ObjectType CadDictionary::objectType() const
 {
     return ObjectType::DICTIONARY;
 }
 
-std::string CadDictionary::objectName() const
+std::string_view CadDictionary::objectName() const
 {
     return DxfFileToken::ObjectDictionary;
 }
 
-std::string CadDictionary::subclassMarker() const
+std::string_view CadDictionary::subclassMarker() const
 {
     return DxfSubclassMarker::Dictionary;
 }
@@ -134,6 +142,18 @@ std::vector<CadObject *> CadDictionary::rawCadObjects() const
     return objects;
 }
 
+void CadDictionary::assignDocument(CadDocument *doc)
+{
+    moveKeys(&doc->stringPool());
+    NonGraphicalObject::assignDocument(doc);
+}
+
+void CadDictionary::unassignDocument()
+{
+    moveKeys(&_keys);
+    NonGraphicalObject::unassignDocument();
+}
+
 bool CadDictionary::hardOwnerFlag() const
 {
     return _hardOwnerFlag;
@@ -156,7 +176,7 @@ void CadDictionary::setClonningFlags(DictionaryCloningFlags value)
 
 CadObject *CadDictionary::operator[](const std::string &key)
 {
-    return nullptr;
+    return value(key);
 }
 
 void CadDictionary::add(const std::string &key, NonGraphicalObject *value)
@@ -165,10 +185,17 @@ void CadDictionary::add(const std::string &key, NonGraphicalObject *value)
     {
         throw std::runtime_error("");
     }
+    if (_names.contains(key))
+    {
+        throw std::runtime_error(fmt::format("Item with the same key: {} already exists", key));
+    }
+
+    std::string_view k = internKey(key);
+    _names.insert(k, value);
+    _entries.insert({k, value});
     value->setOwner(this);
     value->OnNameChanged.add(this, &CadDictionary::onEntryNameChanged);
-    OnAdd(value);
-    _entries.insert({key, value});
+    notifyAdded(value);
 }
 
 void CadDictionary::add(NonGraphicalObject *value)
@@ -190,11 +217,7 @@ bool CadDictionary::tryAdd(NonGraphicalObject *value)
 
 bool CadDictionary::containsKey(const std::string &key) const
 {
-    auto it = _entries.find(key);
-    if (it == _entries.end())
-        return false;
-    else
-        return true;
+    return _names.contains(key);
 }
 
 bool CadDictionary::remove(const std::string &key, NonGraphicalObject **item)
@@ -211,39 +234,85 @@ void CadDictionary::clear() {}
 
 NonGraphicalObject *CadDictionary::value(const std::string &name) const
 {
-    auto it = _entries.find(name);
-    if (it != _entries.end())
-    {
-        return it->second;
-    }
-    return nullptr;
+    return static_cast<NonGraphicalObject *>(_names.find(name));
 }
 
-bool CadDictionary::StringComparerOrdinalIgnoreCase::operator()(const std::string &lhs, const std::string &rhs) const
+bool CadDictionary::StringComparerOrdinalIgnoreCase::operator()(std::string_view lhs, std::string_view rhs) const
 {
-    auto cmp = [](char a, char b) {
-        return std::tolower(static_cast<unsigned char>(a)) < std::tolower(static_cast<unsigned char>(b));
-    };
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), cmp);
+    return CadNameIndex::less(lhs, rhs);
 }
 
 CadDictionary *CadDictionary::ensureCadDictionaryExist(const std::string &name)
 {
-    CadDictionary *entry = nullptr;
-    auto it = _entries.find(name);
-    if (it != _entries.end())
+    CadDictionary *entry = object_cast<CadDictionary>(value(name));
+    if (entry)
     {
-        entry = dynamic_cast<CadDictionary *>(it->second);
-        if (entry)
-        {
-            return entry;
-        }
+        return entry;
     }
     entry = new CadDictionary(name);
     add(entry);
     return entry;
 }
 
-void CadDictionary::onEntryNameChanged(const std::string &olName, const std::string &newName) {}
+void CadDictionary::onEntryNameChanged(NonGraphicalObject *entry, const std::string &olName,
+                                       const std::string &newName)
+{
+    //Entries added under another key keep it
+    if (_names.find(olName) != entry)
+    {
+        return;
+    }
+
+    //Called before the entry takes the new name, throwing keeps the name and the key in step
+    std::string_view key = internKey(newName);
+    if (!_names.rename(olName, key))
+    {
+        releaseKey(key);
+        throw std::runtime_error(fmt::format("Item with the same key: {} already exists", newName));
+    }
+
+    auto node = _entries.extract(olName);
+    assert(!node.empty() && "The entries and the name index are out of sync");
+    releaseKey(node.key());
+    node.key() = key;
+    _entries.insert(std::move(node));
+}
+
+std::string_view CadDictionary::internKey(std::string_view key)
+{
+    return *_keyPool->intern(key);
+}
+
+void CadDictionary::releaseKey(std::string_view key)
+{
+    _keyPool->release(_keyPool->find(key));
+}
+
+void CadDictionary::moveKeys(CadStringPool *pool)
+{
+    if (pool == _keyPool)
+    {
+        return;
+    }
+
+    //Both containers view the keys, they are rebuilt on the strings of the new pool
+    std::map<std::string_view, NonGraphicalObject *, StringComparerOrdinalIgnoreCase> entries;
+    CadNameIndex names;
+    names.reserve(_entries.size());
+    for (auto &&[key, value]: _entries)
+    {
+        std::string_view moved = *pool->intern(key);
+        entries.emplace(moved, value);
+        names.insert(moved, value);
+    }
+
+    for (auto &&[key, value]: _entries)
+    {
+        releaseKey(key);
+    }
+    _entries.swap(entries);
+    _names = std::move(names);
+    _keyPool = pool;
+}
 
 }// namespace dwg
\ No newline at end of file
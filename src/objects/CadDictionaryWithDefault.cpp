@@ -33,12 +33,12 @@ ObjectType CadDictionaryWithDefault::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string CadDictionaryWithDefault::objectName() const
+std::string_view CadDictionaryWithDefault::objectName() const
 {
     return DxfFileToken::ObjectDictionaryWithDefault;
 }
 
-std::string CadDictionaryWithDefault::subclassMarker() const
+std::string_view CadDictionaryWithDefault::subclassMarker() const
 {
     return DxfSubclassMarker::DictionaryWithDefault;
 }
@@ -35,12 +35,12 @@ ObjectType DictionaryVariable::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string DictionaryVariable::objectName() const
+std::string_view DictionaryVariable::objectName() const
 {
     return DxfFileToken::ObjectDictionaryVar;
 }
 
-std::string DictionaryVariable::subclassMarker() const
+std::string_view DictionaryVariable::subclassMarker() const
 {
     return DxfSubclassMarker::DictionaryVariables;
 }
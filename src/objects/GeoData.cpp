@@ -35,12 +35,12 @@ ObjectType GeoData::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string GeoData::objectName() const
+std::string_view GeoData::objectName() const
 {
     return DxfFileToken::ObjectGeoData;
 }
 
-std::string GeoData::subclassMarker() const
+std::string_view GeoData::subclassMarker() const
 {
     return DxfSubclassMarker::GeoData;
 }
@@ -35,12 +35,12 @@ ObjectType Group::objectType() const
     return ObjectType::GROUP;
 }
 
-std::string Group::objectName() const
+std::string_view Group::objectName() const
 {
     return DxfFileToken::TableGroup;
 }
 
-std::string Group::subclassMarker() const
+std::string_view Group::subclassMarker() const
 {
     return DxfSubclassMarker::Group;
 }
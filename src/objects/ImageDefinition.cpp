@@ -35,12 +35,12 @@ ObjectType ImageDefinition::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string ImageDefinition::objectName() const
+std::string_view ImageDefinition::objectName() const
 {
     return DxfFileToken::ObjectImageDefinition;
 }
 
-std::string ImageDefinition::subclassMarker() const
+std::string_view ImageDefinition::subclassMarker() const
 {
     return DxfSubclassMarker::RasterImageDef;
 }
@@ -37,12 +37,12 @@ ObjectType ImageDefinitionReactor::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string ImageDefinitionReactor::objectName() const
+std::string_view ImageDefinitionReactor::objectName() const
 {
     return DxfFileToken::ObjectImageDefinitionReactor;
 }
 
-std::string ImageDefinitionReactor::subclassMarker() const
+std::string_view ImageDefinitionReactor::subclassMarker() const
 {
     return DxfSubclassMarker::RasterImageDefReactor;
 }
@@ -47,12 +47,12 @@ ObjectType Layout::objectType() const
     return ObjectType::LAYOUT;
 }
 
-std::string Layout::objectName() const
+std::string_view Layout::objectName() const
 {
     return DxfFileToken::ObjectLayout;
 }
 
-std::string Layout::subclassMarker() const
+std::string_view Layout::subclassMarker() const
 {
     return DxfSubclassMarker::Layout;
 }
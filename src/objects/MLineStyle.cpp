@@ -45,12 +45,12 @@ ObjectType MLineStyle::objectType() const
     return ObjectType::MLINESTYLE;
 }
 
-std::string MLineStyle::objectName() const
+std::string_view MLineStyle::objectName() const
 {
     return DxfFileToken::ObjectMLineStyle;
 }
 
-std::string MLineStyle::subclassMarker() const
+std::string_view MLineStyle::subclassMarker() const
 {
     return DxfSubclassMarker::MLineStyle;
 }
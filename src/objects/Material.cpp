@@ -35,12 +35,12 @@ ObjectType Material::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string Material::objectName() const
+std::string_view Material::objectName() const
 {
     return DxfFileToken::ObjectMaterial;
 }
 
-std::string Material::subclassMarker() const
+std::string_view Material::subclassMarker() const
 {
     return DxfSubclassMarker::Material;
 }
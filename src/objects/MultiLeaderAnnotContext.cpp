@@ -35,12 +35,12 @@ ObjectType MultiLeaderAnnotContext::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string MultiLeaderAnnotContext::objectName() const
+std::string_view MultiLeaderAnnotContext::objectName() const
 {
     return DxfFileToken::ObjectMLeaderContextData;
 }
 
-std::string MultiLeaderAnnotContext::subclassMarker() const
+std::string_view MultiLeaderAnnotContext::subclassMarker() const
 {
     return DxfSubclassMarker::MultiLeaderAnnotContext;
 }
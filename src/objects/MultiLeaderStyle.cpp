@@ -55,12 +55,12 @@ ObjectType MultiLeaderStyle::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string MultiLeaderStyle::objectName() const
+std::string_view MultiLeaderStyle::objectName() const
 {
     return DxfFileToken::ObjectMLeaderStyle;
 }
 
-std::string MultiLeaderStyle::subclassMarker() const
+std::string_view MultiLeaderStyle::subclassMarker() const
 {
     return DxfSubclassMarker::MLeaderStyle;
 }
@@ -30,14 +30,14 @@ NonGraphicalObject::NonGraphicalObject(const std::string &name) : _name(name) {}
 
 NonGraphicalObject::~NonGraphicalObject() {}
 
-std::string NonGraphicalObject::name() const
+const std::string &NonGraphicalObject::name() const
 {
     return _name;
 }
 
 void NonGraphicalObject::setName(const std::string &value)
 {
-    OnNameChanged(_name, value);
+    OnNameChanged(this, _name, value);
     _name = value;
 }
 
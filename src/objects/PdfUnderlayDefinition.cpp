@@ -27,7 +27,7 @@ namespace dwg {
 
 PdfUnderlayDefinition::PdfUnderlayDefinition() {}
 
-std::string PdfUnderlayDefinition::objectName() const
+std::string_view PdfUnderlayDefinition::objectName() const
 {
     return DxfFileToken::ObjectPdfDefinition;
 }
@@ -36,12 +36,12 @@ ObjectType PlotSettings::objectType() const
     return ObjectType::INVALID;
 }
 
-std::string PlotSettings::objectName() const
+std::string_view PlotSettings::objectName() const
 {
     return DxfFileToken::ObjectPlotSettings;
 }
 
-std::string PlotSettings::subclassMarker() const
+std::string_view PlotSettings::subclassMarker() const
 {
     return DxfSubclassMarker::PlotSettings;
 }
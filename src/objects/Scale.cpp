@@ -44,12 +44,12 @@ ObjectType Scale::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string Scale::objectName() const
+std::string_view Scale::objectName() const
 {
     return DxfFileToken::ObjectScale;
 }
 
-std::string Scale::subclassMarker() const
+std::string_view Scale::subclassMarker() const
 {
     return DxfSubclassMarker::Scale;
 }
@@ -39,12 +39,12 @@ ObjectType SortEntitiesTable::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string SortEntitiesTable::objectName() const
+std::string_view SortEntitiesTable::objectName() const
 {
     return DxfFileToken::ObjectSortEntsTable;
 }
 
-std::string SortEntitiesTable::subclassMarker() const
+std::string_view SortEntitiesTable::subclassMarker() const
 {
     return DxfSubclassMarker::SortentsTable;
 }
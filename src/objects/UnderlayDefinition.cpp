@@ -34,7 +34,7 @@ ObjectType UnderlayDefinition::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string UnderlayDefinition::subclassMarker() const
+std::string_view UnderlayDefinition::subclassMarker() const
 {
     return DxfSubclassMarker::UnderlayDefinition;
 }
@@ -40,7 +40,7 @@ ObjectType UnknownNonGraphicalObject::objectType() const
     return ObjectType::UNDEFINED;
 }
 
-std::string UnknownNonGraphicalObject::objectName() const
+std::string_view UnknownNonGraphicalObject::objectName() const
 {
     if (!_dxfClass)
     {
@@ -52,7 +52,7 @@ std::string UnknownNonGraphicalObject::objectName() const
     }
 }
 
-std::string UnknownNonGraphicalObject::subclassMarker() const
+std::string_view UnknownNonGraphicalObject::subclassMarker() const
 {
     if (!_dxfClass)
     {
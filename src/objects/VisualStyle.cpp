@@ -32,12 +32,12 @@ ObjectType VisualStyle::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string VisualStyle::objectName() const
+std::string_view VisualStyle::objectName() const
 {
     return DxfFileToken::ObjectVisualStyle;
 }
 
-std::string VisualStyle::subclassMarker() const
+std::string_view VisualStyle::subclassMarker() const
 {
     return DxfSubclassMarker::VisualStyle;
 }
@@ -37,12 +37,12 @@ ObjectType XRecord::objectType() const
     return ObjectType::XRECORD;
 }
 
-std::string XRecord::objectName() const
+std::string_view XRecord::objectName() const
 {
     return DxfFileToken::ObjectXRecord;
 }
 
-std::string XRecord::subclassMarker() const
+std::string_view XRecord::subclassMarker() const
 {
     return DxfSubclassMarker::XRecord;
 }
@@ -30,7 +30,7 @@ Block1PtParameter::Block1PtParameter() {}
 
 Block1PtParameter::~Block1PtParameter() {}
 
-std::string Block1PtParameter::subclassMarker() const
+std::string_view Block1PtParameter::subclassMarker() const
 {
     return DxfSubclassMarker::Block1PtParameter;
 }
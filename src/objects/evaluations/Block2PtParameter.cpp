@@ -29,7 +29,7 @@ Block2PtParameter::Block2PtParameter() {}
 
 Block2PtParameter::~Block2PtParameter() {}
 
-std::string Block2PtParameter::subclassMarker() const
+std::string_view Block2PtParameter::subclassMarker() const
 {
     return DxfSubclassMarker::Block2PtParameter;
 }
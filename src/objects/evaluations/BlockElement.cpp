@@ -29,7 +29,7 @@ BlockElement::BlockElement() {}
 
 BlockElement::~BlockElement() {}
 
-std::string BlockElement::subclassMarker() const
+std::string_view BlockElement::subclassMarker() const
 {
     return DxfSubclassMarker::BlockElement;
 }
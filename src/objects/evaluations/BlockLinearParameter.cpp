@@ -35,12 +35,12 @@ ObjectType BlockLinearParameter::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string BlockLinearParameter::objectName() const
+std::string_view BlockLinearParameter::objectName() const
 {
     return DxfFileToken::ObjectBlockLinearParameter;
 }
 
-std::string BlockLinearParameter::subclassMarker() const
+std::string_view BlockLinearParameter::subclassMarker() const
 {
     return DxfSubclassMarker::BlockLinearParameter;
 }
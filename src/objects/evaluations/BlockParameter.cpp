@@ -29,7 +29,7 @@ BlockParameter::BlockParameter() {}
 
 BlockParameter::~BlockParameter() {}
 
-std::string BlockParameter::subclassMarker() const
+std::string_view BlockParameter::subclassMarker() const
 {
     return DxfSubclassMarker::BlockParameter;
 }
@@ -34,7 +34,7 @@ ObjectType EvaluationExpression::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string EvaluationExpression::subclassMarker() const
+std::string_view EvaluationExpression::subclassMarker() const
 {
     return DxfSubclassMarker::EvalGraphExpr;
 }
@@ -35,12 +35,12 @@ ObjectType EvaluationGraph::objectType() const
     return ObjectType::UNLISTED;
 }
 
-std::string EvaluationGraph::objectName() const
+std::string_view EvaluationGraph::objectName() const
 {
     return DxfFileToken::ObjectEvalGraph;
 }
 
-std::string EvaluationGraph::subclassMarker() const
+std::string_view EvaluationGraph::subclassMarker() const
 {
     return DxfSubclassMarker::EvalGraph;
 }
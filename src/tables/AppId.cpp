@@ -42,12 +42,12 @@ ObjectType AppId::objectType() const
     return ObjectType::APPID;
 }
 
-std::string AppId::objectName() const
+std::string_view AppId::objectName() const
 {
     return DxfFileToken::TableAppId;
 }
 
-std::string AppId::subclassMarker() const
+std::string_view AppId::subclassMarker() const
 {
     return DxfSubclassMarker::ApplicationId;
 }
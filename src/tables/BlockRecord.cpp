@@ -71,12 +71,12 @@ ObjectType BlockRecord::objectType() const
     return ObjectType::BLOCK_HEADER;
 }
 
-std::string BlockRecord::objectName() const
+std::string_view BlockRecord::objectName() const
 {
     return DxfFileToken::TableBlockRecord;
 }
 
-std::string BlockRecord::subclassMarker() const
+std::string_view BlockRecord::subclassMarker() const
 {
     return DxfSubclassMarker::BlockRecord;
 }
@@ -185,7 +185,10 @@ void BlockRecord::assignDocument(CadDocument *doc)
     doc->registerCollection(_entities);
 }
 
-void BlockRecord::unassignDocument() {}
+void BlockRecord::unassignDocument()
+{
+    TableEntry::unassignDocument();
+}
 
 EntityCollection *BlockRecord::entities()
 {
@@ -43,12 +43,12 @@ ObjectType DimensionStyle::objectType() const
     return ObjectType::DIMSTYLE;
 }
 
-std::string DimensionStyle::objectName() const
+std::string_view DimensionStyle::objectName() const
 {
     return DxfFileToken::TableDimstyle;
 }
 
-std::string DimensionStyle::subclassMarker() const
+std::string_view DimensionStyle::subclassMarker() const
 {
     return DxfSubclassMarker::DimensionStyle;
 }
@@ -844,9 +844,15 @@ LineType *DimensionStyle::lineTypeExt2() const
 
 void DimensionStyle::setLineTypeExt2(LineType *) {}
 
-void DimensionStyle::assignDocument(CadDocument *doc) {}
+void DimensionStyle::assignDocument(CadDocument *doc)
+{
+    TableEntry::assignDocument(doc);
+}
 
-void DimensionStyle::unassignDocument() {}
+void DimensionStyle::unassignDocument()
+{
+    TableEntry::unassignDocument();
+}
 
 std::vector<std::string> DimensionStyle::getDimStylePrefixAndSuffix(const std::string &text, char start, char end,
                                                                     std::string &prefix, std::string &suffix)
@@ -52,12 +52,12 @@ ObjectType Layer::objectType() const
     return ObjectType::LAYER;
 }
 
-std::string Layer::objectName() const
+std::string_view Layer::objectName() const
 {
     return DxfFileToken::TableLayer;
 }
 
-std::string Layer::subclassMarker() const
+std::string_view Layer::subclassMarker() const
 {
     return DxfSubclassMarker::Layer;
 }
@@ -146,8 +146,14 @@ void Layer::setIsOn(bool value)
     _isOn = value;
 }
 
-void Layer::assignDocument(CadDocument *doc) {}
+void Layer::assignDocument(CadDocument *doc)
+{
+    TableEntry::assignDocument(doc);
+}
 
-void Layer::unassignDocument() {}
+void Layer::unassignDocument()
+{
+    TableEntry::unassignDocument();
+}
 
 }// namespace dwg
\ No newline at end of file
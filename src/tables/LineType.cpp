@@ -53,12 +53,12 @@ ObjectType LineType::objectType() const
     return ObjectType::LTYPE;
 }
 
-std::string LineType::objectName() const
+std::string_view LineType::objectName() const
 {
     return DxfFileToken::TableLinetype;
 }
 
-std::string LineType::subclassMarker() const
+std::string_view LineType::subclassMarker() const
 {
     return DxfSubclassMarker::Linetype;
 }
@@ -22,6 +22,7 @@
 
 #include <assert.h>
 #include <dwg/DxfFileToken_p.h>
+#include <dwg/CadDocument.h>
 #include <dwg/DxfSubclassMarker_p.h>
 #include <dwg/tables/TableEntry.h>
 #include <fmt/core.h>
@@ -32,14 +33,14 @@ TableEntry::TableEntry(const std::string &name) : _name(name), _flags(StandardFl
 
 TableEntry::~TableEntry() {}
 
-std::string TableEntry::subclassMarker() const
+std::string_view TableEntry::subclassMarker() const
 {
     return DxfSubclassMarker::TableRecord;
 }
 
-std::string TableEntry::name() const
+const std::string &TableEntry::name() const
 {
-    return _name;
+    return _internedName ? *_internedName : _name;
 }
 
 void TableEntry::setName(const std::string &value)
@@ -48,8 +49,54 @@ void TableEntry::setName(const std::string &value)
     {
         throw std::invalid_argument("The Table Entry must have a name");
     }
-    OnNameChanged(_name, value);
-    _name = value;
+    OnNameChanged(this, name(), value);
+    if (_internedName)
+    {
+        CadStringPool &pool = document()->stringPool();
+        const std::string *previous = _internedName;
+        _internedName = pool.intern(value);
+        pool.release(previous);
+    }
+    else
+    {
+        _name = value;
+    }
+}
+
+bool TableEntry::sameName(const TableEntry *other) const
+{
+    if (_internedName && other->_internedName && document() == other->document())
+    {
+        return _internedName == other->_internedName;
+    }
+    return name() == other->name();
+}
+
+void TableEntry::assignDocument(CadDocument *doc)
+{
+    std::string_view current = _internedName ? std::string_view(*_internedName) : std::string_view(_name);
+    const std::string *interned = doc->stringPool().intern(current);
+    if (_internedName)
+    {
+        document()->stringPool().release(_internedName);
+    }
+
+    CadObject::assignDocument(doc);
+
+    //The document keeps the only copy of the name
+    _internedName = interned;
+    std::string().swap(_name);
+}
+
+void TableEntry::unassignDocument()
+{
+    if (_internedName)
+    {
+        _name = *_internedName;
+        document()->stringPool().release(_internedName);
+        _internedName = nullptr;
+    }
+    CadObject::unassignDocument();
 }
 
 StandardFlags TableEntry::flags() const
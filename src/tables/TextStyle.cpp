@@ -42,12 +42,12 @@ ObjectType TextStyle::objectType() const
     return ObjectType::STYLE;
 }
 
-std::string TextStyle::objectName() const
+std::string_view TextStyle::objectName() const
 {
     return DxfFileToken::TableStyle;
 }
 
-std::string TextStyle::subclassMarker() const
+std::string_view TextStyle::subclassMarker() const
 {
     return DxfSubclassMarker::TextStyle;
 }
@@ -37,12 +37,12 @@ ObjectType UCS::objectType() const
     return ObjectType::UCS;
 }
 
-std::string UCS::objectName() const
+std::string_view UCS::objectName() const
 {
     return DxfFileToken::TableUcs;
 }
 
-std::string UCS::subclassMarker() const
+std::string_view UCS::subclassMarker() const
 {
     return DxfSubclassMarker::Ucs;
 }
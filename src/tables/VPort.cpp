@@ -42,12 +42,12 @@ ObjectType VPort::objectType() const
     return ObjectType::VPORT;
 }
 
-std::string VPort::objectName() const
+std::string_view VPort::objectName() const
 {
     return DxfFileToken::TableVport;
 }
 
-std::string VPort::subclassMarker() const
+std::string_view VPort::subclassMarker() const
 {
     return DxfSubclassMarker::VPort;
 }
@@ -35,12 +35,12 @@ ObjectType View::objectType() const
     return ObjectType::VIEW;
 }
 
-std::string View::objectName() const
+std::string_view View::objectName() const
 {
     return DxfFileToken::TableView;
 }
 
-std::string View::subclassMarker() const
+std::string_view View::subclassMarker() const
 {
     return DxfSubclassMarker::View;
 }
@@ -37,7 +37,7 @@ ObjectType AppIdsTable::objectType() const
     return ObjectType::APPID_CONTROL_OBJ;
 }
 
-std::string AppIdsTable::objectName() const
+std::string_view AppIdsTable::objectName() const
 {
     return DxfFileToken::TableAppId;
 }
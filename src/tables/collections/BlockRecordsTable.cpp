@@ -37,7 +37,7 @@ ObjectType BlockRecordsTable::objectType() const
     return ObjectType::BLOCK_CONTROL_OBJ;
 }
 
-std::string BlockRecordsTable::objectName() const
+std::string_view BlockRecordsTable::objectName() const
 {
     return DxfFileToken::TableBlockRecord;
 }
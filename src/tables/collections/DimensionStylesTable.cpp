@@ -37,7 +37,7 @@ ObjectType DimensionStylesTable::objectType() const
     return ObjectType::DIMSTYLE_CONTROL_OBJ;
 }
 
-std::string DimensionStylesTable::objectName() const
+std::string_view DimensionStylesTable::objectName() const
 {
     return DxfFileToken::TableDimstyle;
 }
@@ -37,7 +37,7 @@ ObjectType LayersTable::objectType() const
     return ObjectType::LAYER_CONTROL_OBJ;
 }
 
-std::string LayersTable::objectName() const
+std::string_view LayersTable::objectName() const
 {
     return DxfFileToken::TableLayer;
 }
@@ -37,7 +37,7 @@ ObjectType LineTypesTable::objectType() const
     return ObjectType::LTYPE_CONTROL_OBJ;
 }
 
-std::string LineTypesTable::objectName() const
+std::string_view LineTypesTable::objectName() const
 {
     return DxfFileToken::TableLinetype;
 }
@@ -26,6 +26,7 @@
 #include <dwg/tables/TableEntry.h>
 #include <dwg/tables/collections/Table.h>
 #include <fmt/core.h>
+#include <stdexcept>
 
 namespace dwg {
 
@@ -33,18 +34,24 @@ Table::Table() {}
 
 Table::Table(CadDocument *document)
 {
+    //The document registers the table once it is constructed, objectType() is not available here
     _owner = document;
-    document->registerCollection(this);
 }
 
-Table::~Table() {}
+Table::~Table()
+{
+    for (auto &&[key, entry]: _entries)
+    {
+        releaseKey(key);
+    }
+}
 
-std::string Table::objectName() const
+std::string_view Table::objectName() const
 {
     return DxfFileToken::TableEntry_;
 }
 
-std::string Table::subclassMarker() const
+std::string_view Table::subclassMarker() const
 {
     return DxfSubclassMarker::Table;
 }
@@ -61,8 +68,7 @@ std::size_t Table::size() const
 
 Table::pointer Table::operator[](const std::string &key)
 {
-    auto _it = _entries.find(key);
-    return (_it != _entries.end()) ? _it->second : nullptr;
+    return value(key);
 }
 
 void Table::add(pointer v)
@@ -75,18 +81,18 @@ void Table::add(pointer v)
 
 bool Table::contains(const std::string &key) const
 {
-    auto _it = _entries.find(key);
-    return (_it != _entries.end()) ? true : false;
+    return _names.contains(key);
 }
 
 Table::pointer Table::value(const std::string &key) const
 {
-    auto _it = _entries.find(key);
-    return (_it != _entries.end()) ? _it->second : nullptr;
+    return static_cast<pointer>(_names.find(key));
 }
 
 void Table::createDefaultEntries()
 {
+    //The entries reach the document in one OnAddRange
+    suspendNotifications();
     auto ns = defaultEntries();
     for (auto &&entry: ns)
     {
@@ -95,26 +101,57 @@ void Table::createDefaultEntries()
 
         push_back(entry, createEntry(entry));
     }
+    resumeNotifications();
+}
+
+void Table::assignDocument(CadDocument *doc)
+{
+    moveKeys(&doc->stringPool());
+    CadObject::assignDocument(doc);
+}
+
+void Table::unassignDocument()
+{
+    moveKeys(&_keys);
+    CadObject::unassignDocument();
 }
 
 void Table::addHandlePrefix(pointer v)
 {
     assert(v);
-    v->setOwner(this);
-    v->OnNameChanged.add(this, &Table::onEntryNameChanged);
 
-    OnAdd(v);
+    //The handle is part of the key, the notification that would assign it may be held back
+    if (v->handle() == 0 && document())
+    {
+        v->setHandle(document()->reserveHandle());
+    }
 
-    std::string k = fmt::format("{}:{}", v->handle(), v->name());
+    std::string_view k = internKey(fmt::format("{}:{}", v->handle(), v->name()));
+    if (!_names.insert(k, v))
+    {
+        //Already registered under its handle
+        releaseKey(k);
+        return;
+    }
     _entries.insert({k, v});
+    v->setOwner(this);
+    v->OnNameChanged.add(this, &Table::onEntryNameChanged);
+    notifyAdded(v);
 }
 
 void Table::push_back(const std::string &n, pointer v)
 {
-    _entries.insert({n, v});
+    if (_names.contains(n))
+    {
+        throw std::runtime_error(fmt::format("Item with the same key: {} already exists", n));
+    }
+
+    std::string_view key = internKey(n);
+    _names.insert(key, v);
+    _entries.insert({key, v});
     v->setOwner(this);
     v->OnNameChanged.add(this, &Table::onEntryNameChanged);
-    OnAdd(v);
+    notifyAdded(v);
 }
 
 std::vector<std::string> Table::defaultEntries() const
@@ -133,6 +170,76 @@ std::string Table::createName() const
     return fmt::format("{}_{}", name, i);
 }
 
-void Table::onEntryNameChanged(const std::string &oldname, const std::string &newname) {}
+void Table::onEntryNameChanged(TableEntry *entry, const std::string &oldname, const std::string &newname)
+{
+    //Entries added with a handle prefix keep it in their key
+    std::string oldKey = oldname;
+    std::string newKey = newname;
+    if (_names.find(oldKey) != entry)
+    {
+        oldKey = fmt::format("{}:{}", entry->handle(), oldname);
+        newKey = fmt::format("{}:{}", entry->handle(), newname);
+        if (_names.find(oldKey) != entry)
+        {
+            return;
+        }
+    }
+
+    //Called before the entry takes the new name, throwing keeps the name and the key in step
+    std::string_view key = internKey(newKey);
+    if (!_names.rename(oldKey, key))
+    {
+        releaseKey(key);
+        throw std::runtime_error(fmt::format("Item with the same key: {} already exists", newname));
+    }
+
+    auto node = _entries.extract(oldKey);
+    assert(!node.empty() && "The entries and the name index are out of sync");
+    releaseKey(node.key());
+    node.key() = key;
+    _entries.insert(std::move(node));
+}
+
+bool Table::StringComparerOrdinalIgnoreCase::operator()(std::string_view lhs, std::string_view rhs) const
+{
+    return CadNameIndex::less(lhs, rhs);
+}
+
+std::string_view Table::internKey(std::string_view key)
+{
+    return *_keyPool->intern(key);
+}
+
+void Table::releaseKey(std::string_view key)
+{
+    _keyPool->release(_keyPool->find(key));
+}
+
+void Table::moveKeys(CadStringPool *pool)
+{
+    if (pool == _keyPool)
+    {
+        return;
+    }
+
+    //Both containers view the keys, they are rebuilt on the strings of the new pool
+    map_type entries;
+    CadNameIndex names;
+    names.reserve(_entries.size());
+    for (auto &&[key, entry]: _entries)
+    {
+        std::string_view moved = *pool->intern(key);
+        entries.emplace(moved, entry);
+        names.insert(moved, entry);
+    }
+
+    for (auto &&[key, entry]: _entries)
+    {
+        releaseKey(key);
+    }
+    _entries.swap(entries);
+    _names = std::move(names);
+    _keyPool = pool;
+}
 
 }// namespace dwg
\ No newline at end of file
@@ -37,7 +37,7 @@ ObjectType TextStylesTable::objectType() const
     return ObjectType::STYLE_CONTROL_OBJ;
 }
 
-std::string TextStylesTable::objectName() const
+std::string_view TextStylesTable::objectName() const
 {
     return DxfFileToken::TableStyle;
 }
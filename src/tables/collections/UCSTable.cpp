@@ -37,7 +37,7 @@ ObjectType UCSTable::objectType() const
     return ObjectType::UCS_CONTROL_OBJ;
 }
 
-std::string UCSTable::objectName() const
+std::string_view UCSTable::objectName() const
 {
     return DxfFileToken::TableUcs;
 }
@@ -38,7 +38,7 @@ ObjectType VPortsTable::objectType() const
     return ObjectType::VPORT_CONTROL_OBJ;
 }
 
-std::string VPortsTable::objectName() const
+std::string_view VPortsTable::objectName() const
 {
     return DxfFileToken::TableVport;
 }
@@ -37,7 +37,7 @@ ObjectType ViewsTable::objectType() const
     return ObjectType::VIEW_CONTROL_OBJ;
 }
 
-std::string ViewsTable::objectName() const
+std::string_view ViewsTable::objectName() const
 {
     return DxfFileToken::TableView;
 }
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <assert.h>
 #include <cctype>
+#include <charconv>
 #include <double-conversion/double-conversion.h>
 #include <dwg/utils/StringHelp.h>
 #include <fmt/core.h>
@@ -38,154 +39,55 @@
 
 namespace dwg {
 
-template<typename R, typename F, typename S>
-bool safeMultiply(R &result, F f, S s)
+static std::string_view trimNumber(std::string_view str)
 {
-    if ((f == 0) || (s == 0))
-    {
-        result = 0;
-        return true;
-    }
-
-    if (f > 0)
-    {
-        if (s > 0)
-        {
-            if (f > (std::numeric_limits<R>::max() / s))
-                return false;
-        }
-        else
-        {
-            if (s < (std::numeric_limits<R>::min() / f))
-                return false;
-        }
-    }
-    else
-    {
-        if (s > 0)
-        {
-            if (f < (std::numeric_limits<R>::min() / s))
-                return false;
-        }
-        else
-        {
-            if (s < (std::numeric_limits<R>::max() / f))
-                return false;
-        }
-    }
-    result = f * s;
-    return true;
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front())))
+        str.remove_prefix(1);
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back())))
+        str.remove_suffix(1);
+    return str;
 }
 
 template<typename I>
-bool strToInt(const char *pStr, I &outResult, short base)
+static bool strToInt(std::string_view str, I &outResult, int base)
 {
-    assert(base == 2 || base == 8 || base == 10 || base == 16);
-
-    if (!pStr)
-        return false;
-    while (std::isspace(*pStr)) ++pStr;
-    if ((*pStr == '\0') || ((*pStr == '-') && ((base != 10) || (std::is_unsigned<I>::value))))
-        return false;
-
-    bool negative = false;
-    if ((base == 10) && (*pStr == '-'))
-    {
-        if (!std::numeric_limits<I>::is_signed)
-            return false;
-        negative = true;
-        ++pStr;
-    }
-    else if (*pStr == '+')
-        ++pStr;
-
-    // numbers are parsed as unsigned, for negative numbers the sign is applied after parsing
-    // overflow is checked in every parse step
-    uintmax_t limitCheck = std::numeric_limits<I>::max();
-    if (negative)
-        ++limitCheck;
-    uintmax_t result = 0;
-    unsigned char add = 0;
-    for (; *pStr != '\0'; ++pStr)
+    str = trimNumber(str);
+    if (!str.empty() && str.front() == '+')
     {
-        if (result > (limitCheck / base))
-            return false;
-        if (!safeMultiply(result, result, base))
-            return false;
-        switch (*pStr)
-        {
-            case '0':
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-                add = (*pStr - '0');
-                break;
-
-            case '8':
-            case '9':
-                if ((base == 10) || (base == 0x10))
-                    add = (*pStr - '0');
-                else
-                    return false;
-                break;
-
-            case 'a':
-            case 'b':
-            case 'c':
-            case 'd':
-            case 'e':
-            case 'f':
-                if (base != 0x10)
-                    return false;
-                add = (*pStr - 'a') + 10;
-                break;
-
-            case 'A':
-            case 'B':
-            case 'C':
-            case 'D':
-            case 'E':
-            case 'F':
-                if (base != 0x10)
-                    return false;
-                add = (*pStr - 'A') + 10;
-                break;
-
-            default:
-                return false;
-        }
-        if ((limitCheck - static_cast<uintmax_t>(result)) < add)
+        str.remove_prefix(1);
+        if (!str.empty() && (str.front() == '+' || str.front() == '-'))
             return false;
-        result += add;
     }
+    if (str.empty())
+        return false;
 
-    if (negative && (base == 10))
-        outResult = static_cast<I>(-result);
-    else
-        outResult = static_cast<I>(result);
+    // std::from_chars is locale independent and does not allocate
+    I result;
+    const char *last = str.data() + str.size();
+    auto [ptr, ec] = std::from_chars(str.data(), last, result, base);
+    if (ec != std::errc() || ptr != last)
+        return false;
 
+    outResult = result;
     return true;
 }
 
-static bool strToDouble(const std::string &str, double &result)
+static bool strToDouble(std::string_view str, double &result)
 {
+    str = trimNumber(str);
     if (str.empty())
         return false;
 
     using namespace double_conversion;
 
-    StringToDoubleConverter converter(StringToDoubleConverter::NO_FLAGS,
-                                      0.0,    // empty_string_value
-                                      0.0,    // junk_string_value
-                                      nullptr,// null pointer for error flag
-                                      nullptr // null pointer for error flag
+    static const StringToDoubleConverter converter(StringToDoubleConverter::NO_FLAGS,
+                                                   0.0,    // empty_string_value
+                                                   0.0,    // junk_string_value
+                                                   nullptr,// null pointer for error flag
+                                                   nullptr // null pointer for error flag
     );
 
-    const char *start = str.c_str();
+    const char *start = str.data();
     int length = static_cast<int>(str.length());
     int processed_characters = 0;
 
@@ -231,7 +133,7 @@ std::string StringHelp::replace(const std::string &str, const std::string &from,
     return result;
 }
 
-char StringHelp::parse8(const std::string &str)
+char StringHelp::parse8(std::string_view str)
 {
     char result;
     if (tryParse8(str, result))
@@ -240,12 +142,12 @@ char StringHelp::parse8(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid integer", str));
 }
 
-bool StringHelp::tryParse8(const std::string &str, char &value)
+bool StringHelp::tryParse8(std::string_view str, char &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-short StringHelp::parse16(const std::string &str)
+short StringHelp::parse16(std::string_view str)
 {
     short result;
     if (tryParse16(str, result))
@@ -254,12 +156,12 @@ short StringHelp::parse16(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid integer", str));
 }
 
-bool StringHelp::tryParse16(const std::string &str, short &value)
+bool StringHelp::tryParse16(std::string_view str, short &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-int StringHelp::parse32(const std::string &str)
+int StringHelp::parse32(std::string_view str)
 {
     int result;
     if (tryParse32(str, result))
@@ -268,12 +170,12 @@ int StringHelp::parse32(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid integer", str));
 }
 
-bool StringHelp::tryParse32(const std::string &str, int &value)
+bool StringHelp::tryParse32(std::string_view str, int &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-long long StringHelp::parse64(const std::string &str)
+long long StringHelp::parse64(std::string_view str)
 {
     long long result;
     if (tryParse64(str, result))
@@ -282,12 +184,12 @@ long long StringHelp::parse64(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid unsigned integer", str));
 }
 
-bool StringHelp::tryParse64(const std::string &str, long long &value)
+bool StringHelp::tryParse64(std::string_view str, long long &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-unsigned char StringHelp::parseUnsigned8(const std::string &str)
+unsigned char StringHelp::parseUnsigned8(std::string_view str)
 {
     unsigned char result;
     if (tryParseUnsigned8(str, result))
@@ -296,12 +198,12 @@ unsigned char StringHelp::parseUnsigned8(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid unsigned integer", str));
 }
 
-bool StringHelp::tryParseUnsigned8(const std::string &, unsigned char &)
+bool StringHelp::tryParseUnsigned8(std::string_view str, unsigned char &value)
 {
-    return false;
+    return strToInt(str, value, 10);
 }
 
-unsigned short StringHelp::parseUnsigned16(const std::string &str)
+unsigned short StringHelp::parseUnsigned16(std::string_view str)
 {
     unsigned short result;
     if (tryParseUnsigned16(str, result))
@@ -310,12 +212,12 @@ unsigned short StringHelp::parseUnsigned16(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid unsigned integer", str));
 }
 
-bool StringHelp::tryParseUnsigned16(const std::string &, unsigned short &)
+bool StringHelp::tryParseUnsigned16(std::string_view str, unsigned short &value)
 {
-    return false;
+    return strToInt(str, value, 10);
 }
 
-unsigned int StringHelp::parseUnsigned32(const std::string &str)
+unsigned int StringHelp::parseUnsigned32(std::string_view str)
 {
     unsigned int result;
     if (tryParseUnsigned32(str, result))
@@ -324,12 +226,12 @@ unsigned int StringHelp::parseUnsigned32(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid unsigned integer", str));
 }
 
-bool StringHelp::tryParseUnsigned32(const std::string &str, unsigned int &value)
+bool StringHelp::tryParseUnsigned32(std::string_view str, unsigned int &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-unsigned long long StringHelp::parseUnsigned64(const std::string &str)
+unsigned long long StringHelp::parseUnsigned64(std::string_view str)
 {
     unsigned long long result;
     if (tryParseUnsigned64(str, result))
@@ -338,12 +240,12 @@ unsigned long long StringHelp::parseUnsigned64(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid unsigned integer", str));
 }
 
-bool StringHelp::tryParseUnsigned64(const std::string &str, unsigned long long &value)
+bool StringHelp::tryParseUnsigned64(std::string_view str, unsigned long long &value)
 {
-    return strToInt(str.c_str(), value, 10U);
+    return strToInt(str, value, 10);
 }
 
-unsigned long long StringHelp::parseHex64(const std::string &str)
+unsigned long long StringHelp::parseHex64(std::string_view str)
 {
     unsigned long long result;
     if (tryParseHex64(str, result))
@@ -352,15 +254,15 @@ unsigned long long StringHelp::parseHex64(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid hexadecimal integer", str));
 }
 
-bool StringHelp::tryParseHex64(const std::string &str, unsigned long long &value)
+bool StringHelp::tryParseHex64(std::string_view str, unsigned long long &value)
 {
-    int offset = 0;
+    str = trimNumber(str);
     if (str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
-        offset = 2;
-    return strToInt(str.c_str() + offset, value, 16U);
+        str.remove_prefix(2);
+    return strToInt(str, value, 16);
 }
 
-double StringHelp::parseFloat(const std::string &str)
+double StringHelp::parseFloat(std::string_view str)
 {
     double result;
     if (tryParseFloat(str, result))
@@ -369,9 +271,9 @@ double StringHelp::parseFloat(const std::string &str)
         throw std::runtime_error(fmt::format("{} is not a valid floating-point number", str));
 }
 
-bool StringHelp::tryParseFloat(const std::string &str, double &value)
+bool StringHelp::tryParseFloat(std::string_view str, double &value)
 {
-    return strToDouble(str.c_str(), value);
+    return strToDouble(str, value);
 }
 
 bool StringHelp::parseBool(const std::string &str)
@@ -20,12 +20,23 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/xdata/ExtendedDataDictionary.h>
 
 namespace dwg {
 
 ExtendedDataDictionary::ExtendedDataDictionary(CadObject *owner) {}
 
+void *ExtendedDataDictionary::operator new(std::size_t size)
+{
+    return CadMemoryScope::allocate(size, CadMemoryScope::objectResource());
+}
+
+void ExtendedDataDictionary::operator delete(void *ptr, std::size_t size)
+{
+    CadMemoryScope::deallocate(ptr, size);
+}
+
 void ExtendedDataDictionary::add(AppId *app) {}
 
 void ExtendedDataDictionary::add(AppId *app, ExtendedData *extendedData) {}
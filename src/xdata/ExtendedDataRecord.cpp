@@ -20,11 +20,22 @@
  * For more information, visit the project's homepage or contact the author.
  */
 
+#include <dwg/CadMemoryScope_p.h>
 #include <dwg/xdata/ExtendedDataRecord.h>
 
 namespace dwg {
 
 /* --------------------------- ExtendedDataRecord --------------------------- */
+void *ExtendedDataRecord::operator new(std::size_t size)
+{
+    return CadMemoryScope::allocate(size, CadMemoryScope::objectResource());
+}
+
+void ExtendedDataRecord::operator delete(void *ptr, std::size_t size)
+{
+    CadMemoryScope::deallocate(ptr, size);
+}
+
 DxfCode ExtendedDataRecord::code() const
 {
     return _code;
@@ -0,0 +1,124 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadHandleIndex.h>
+#include <dwg/IHandledCadObject.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace dwg;
+
+namespace {
+
+class HandledObject : public IHandledCadObject
+{
+public:
+    HandledObject(unsigned long long handle) : _handle(handle) {}
+
+    unsigned long long handle() const override
+    {
+        return _handle;
+    }
+
+private:
+    unsigned long long _handle;
+};
+
+}// namespace
+
+TEST(CadHandleIndexTest, Insert_FindsEveryHandle)
+{
+    std::vector<HandledObject> objects;
+    for (unsigned long long h = 0; h < 1000; ++h)
+    {
+        objects.emplace_back(h * 3);
+    }
+
+    CadHandleIndex index;
+    for (auto &&o: objects)
+    {
+        EXPECT_TRUE(index.insert(o.handle(), &o));
+    }
+
+    EXPECT_EQ(index.size(), objects.size());
+    for (auto &&o: objects)
+    {
+        EXPECT_EQ(index.find(o.handle()), &o);
+    }
+    EXPECT_EQ(index.find(1), nullptr);
+    EXPECT_FALSE(index.contains(3001));
+}
+
+TEST(CadHandleIndexTest, Insert_DuplicateHandleIsRejected)
+{
+    HandledObject a(0x1F), b(0x1F);
+
+    CadHandleIndex index;
+    EXPECT_TRUE(index.insert(a.handle(), &a));
+    EXPECT_FALSE(index.insert(b.handle(), &b));
+    EXPECT_EQ(index.find(0x1F), &a);
+    EXPECT_EQ(index.size(), 1);
+}
+
+TEST(CadHandleIndexTest, Remove_KeepsOtherHandlesReachable)
+{
+    std::vector<HandledObject> objects;
+    for (unsigned long long h = 1; h <= 500; ++h)
+    {
+        objects.emplace_back(h);
+    }
+
+    CadHandleIndex index;
+    for (auto &&o: objects)
+    {
+        index.insert(o.handle(), &o);
+    }
+
+    for (auto &&o: objects)
+    {
+        if (o.handle() % 2 == 0)
+        {
+            EXPECT_TRUE(index.remove(o.handle()));
+        }
+    }
+    EXPECT_FALSE(index.remove(2));
+    EXPECT_EQ(index.size(), 250);
+
+    for (auto &&o: objects)
+    {
+        EXPECT_EQ(index.find(o.handle()), o.handle() % 2 == 0 ? nullptr : &o);
+    }
+}
+
+TEST(CadHandleIndexTest, Clear_RemovesAll)
+{
+    HandledObject a(0);
+
+    CadHandleIndex index;
+    index.reserve(10000);
+    index.insert(a.handle(), &a);
+    EXPECT_EQ(index.find(0), &a);
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_EQ(index.find(0), nullptr);
+}
@@ -0,0 +1,153 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadDocument.h>
+#include <dwg/CadNameIndex.h>
+#include <dwg/tables/AppId.h>
+#include <dwg/tables/Layer.h>
+#include <dwg/tables/collections/LayersTable.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace dwg;
+
+TEST(CadNameIndexTest, Find_IgnoresAsciiCase)
+{
+    AppId acad("ACAD");
+    AppId custom("MyApp");
+
+    CadNameIndex index;
+    EXPECT_TRUE(index.insert(acad.name(), &acad));
+    EXPECT_TRUE(index.insert(custom.name(), &custom));
+    EXPECT_FALSE(index.insert("acad", &custom));
+
+    EXPECT_EQ(index.find("acad"), &acad);
+    EXPECT_EQ(index.find("Acad"), &acad);
+    EXPECT_EQ(index.find("MYAPP"), &custom);
+    EXPECT_EQ(index.find("MyApp2"), nullptr);
+    EXPECT_EQ(index.size(), 2u);
+}
+
+TEST(CadNameIndexTest, Insert_FindsEveryName)
+{
+    std::vector<std::unique_ptr<AppId>> entries;
+    CadNameIndex index;
+    for (int i = 0; i < 1000; ++i)
+    {
+        entries.emplace_back(new AppId("Layer_" + std::to_string(i)));
+        EXPECT_TRUE(index.insert(entries.back()->name(), entries.back().get()));
+    }
+
+    EXPECT_EQ(index.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(index.find("LAYER_" + std::to_string(i)), entries[i].get());
+    }
+}
+
+TEST(CadNameIndexTest, Remove_KeepsOtherNames)
+{
+    std::vector<std::unique_ptr<AppId>> entries;
+    CadNameIndex index;
+    for (int i = 0; i < 200; ++i)
+    {
+        entries.emplace_back(new AppId(std::to_string(i)));
+        index.insert(entries.back()->name(), entries.back().get());
+    }
+
+    for (int i = 0; i < 200; i += 2)
+    {
+        EXPECT_TRUE(index.remove(std::to_string(i)));
+    }
+    EXPECT_FALSE(index.remove("0"));
+
+    EXPECT_EQ(index.size(), 100u);
+    for (int i = 0; i < 200; ++i)
+    {
+        EXPECT_EQ(index.find(std::to_string(i)), i % 2 ? entries[i].get() : nullptr);
+    }
+}
+
+TEST(CadNameIndexTest, Rename_MovesTheEntry)
+{
+    AppId a("A");
+    AppId b("B");
+
+    CadNameIndex index;
+    index.insert("A", &a);
+    index.insert("B", &b);
+
+    EXPECT_FALSE(index.rename("A", "b"));
+    EXPECT_FALSE(index.rename("C", "D"));
+
+    EXPECT_TRUE(index.rename("A", "a"));
+    EXPECT_EQ(index.find("A"), &a);
+
+    EXPECT_TRUE(index.rename("a", "C"));
+    EXPECT_EQ(index.find("a"), nullptr);
+    EXPECT_EQ(index.find("c"), &a);
+    EXPECT_EQ(index.size(), 2u);
+}
+
+TEST(CadNameIndexTest, Table_RejectsTakenNames)
+{
+    CadDocument doc;
+    Layer *walls = new Layer("Walls");
+    Layer *doors = new Layer("Doors");
+    std::unique_ptr<Layer> duplicate = std::make_unique<Layer>("WALLS");
+
+    doc.layers()->add(walls);
+    doc.layers()->add(doors);
+    EXPECT_THROW(doc.layers()->add(duplicate.get()), std::runtime_error);
+    EXPECT_EQ(duplicate->owner(), nullptr);
+
+    //The writers iterate the table, every entry in it is reachable by its name
+    std::size_t count = 0;
+    for (auto &&[key, entry]: *doc.layers())
+    {
+        EXPECT_EQ(doc.layers()->value(entry->name()), entry);
+        count++;
+    }
+    EXPECT_EQ(count, doc.layers()->size());
+    EXPECT_EQ(doc.layers()->value("walls"), walls);
+
+    EXPECT_THROW(walls->setName("DOORS"), std::runtime_error);
+    EXPECT_EQ(walls->name(), "Walls");
+    EXPECT_EQ(doc.layers()->value("Walls"), walls);
+    EXPECT_EQ(doc.layers()->value("Doors"), doors);
+
+    walls->setName("Windows");
+    EXPECT_EQ(doc.layers()->value("WINDOWS"), walls);
+    EXPECT_EQ(doc.layers()->value("Walls"), nullptr);
+    EXPECT_EQ(doc.stringPool().find("Walls"), nullptr);
+}
+
+TEST(CadNameIndexTest, Less_OrdersFoldedNames)
+{
+    EXPECT_TRUE(CadNameIndex::less("abc", "ABD"));
+    EXPECT_FALSE(CadNameIndex::less("ABC", "abc"));
+    EXPECT_FALSE(CadNameIndex::less("abc", "ABC"));
+    EXPECT_TRUE(CadNameIndex::less("ab", "ABC"));
+    EXPECT_EQ(CadNameIndex::hash("Layer"), CadNameIndex::hash("LAYER"));
+}
@@ -0,0 +1,84 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadStringPool.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dwg;
+
+TEST(CadStringPoolTest, Intern_SameValueSamePointer)
+{
+    CadStringPool pool;
+    std::string name = "Layer1";
+
+    const std::string *a = pool.intern("Layer1");
+    const std::string *b = pool.intern(name);
+    const std::string *c = pool.intern("layer1");
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(*a, "Layer1");
+    EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(CadStringPoolTest, Intern_PointersSurviveGrowth)
+{
+    CadStringPool pool;
+    const std::string *first = pool.intern("0");
+    for (int i = 1; i < 1000; ++i)
+    {
+        pool.intern(std::to_string(i));
+    }
+
+    EXPECT_EQ(pool.intern("0"), first);
+    EXPECT_EQ(*first, "0");
+    EXPECT_EQ(pool.size(), 1000u);
+}
+
+TEST(CadStringPoolTest, Release_RemovesWithLastReference)
+{
+    CadStringPool pool;
+    const std::string *a = pool.intern("Layer1");
+    const std::string *b = pool.intern("Layer1");
+
+    pool.release(a);
+    EXPECT_EQ(pool.find("Layer1"), b);
+
+    pool.release(b);
+    EXPECT_EQ(pool.find("Layer1"), nullptr);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(CadStringPoolTest, Find_DoesNotIntern)
+{
+    CadStringPool pool;
+    EXPECT_EQ(pool.find("Standard"), nullptr);
+    EXPECT_EQ(pool.size(), 0u);
+
+    const std::string *standard = pool.intern("Standard");
+    EXPECT_EQ(pool.find("Standard"), standard);
+
+    pool.clear();
+    EXPECT_EQ(pool.size(), 0u);
+    EXPECT_EQ(pool.find("Standard"), nullptr);
+}
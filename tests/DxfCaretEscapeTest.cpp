@@ -0,0 +1,88 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/io/dxf/DxfCaretEscape_p.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dwg;
+
+TEST(DxfCaretEscapeTest, Escape_WritesTheCaretEscapes)
+{
+    EXPECT_EQ(DxfCaretEscape::escape("a\nb"), "a^Jb");
+    EXPECT_EQ(DxfCaretEscape::escape("a\rb"), "a^Mb");
+    EXPECT_EQ(DxfCaretEscape::escape("a\tb"), "a^Ib");
+    EXPECT_EQ(DxfCaretEscape::escape("^"), "^ ");
+    EXPECT_EQ(DxfCaretEscape::escape("line one\r\nline two^2\t"), "line one^M^Jline two^ 2^I");
+}
+
+TEST(DxfCaretEscapeTest, Escape_KeepsPlainStrings)
+{
+    EXPECT_EQ(DxfCaretEscape::escape(""), "");
+    EXPECT_EQ(DxfCaretEscape::escape("Layer 0 - plain text without escapes"),
+              "Layer 0 - plain text without escapes");
+    EXPECT_EQ(DxfCaretEscape::findEscaped("Layer 0 - plain text without escapes"), std::string_view::npos);
+}
+
+TEST(DxfCaretEscapeTest, FindEscaped_FindsTheFirstInEveryPosition)
+{
+    //Covers the word at a time scan and the tail, with bytes close to the escaped ones around
+    for (char c: {'^', '\n', '\r', '\t'})
+    {
+        for (std::size_t i = 0; i < 40; ++i)
+        {
+            std::string str(40, ']');
+            str[i] = c;
+            if (i + 1 < str.size())
+            {
+                str[i + 1] = '\x0E';
+            }
+            EXPECT_EQ(DxfCaretEscape::findEscaped(str), i);
+        }
+    }
+    EXPECT_EQ(DxfCaretEscape::findEscaped(std::string(40, '\x0E')), std::string_view::npos);
+    EXPECT_EQ(DxfCaretEscape::findEscaped(std::string(40, '_')), std::string_view::npos);
+}
+
+TEST(DxfCaretEscapeTest, Unescape_ReadsTheCaretEscapes)
+{
+    EXPECT_EQ(DxfCaretEscape::unescape("a^Jb^Mc^Id^ e"), "a\nb\rc\td^e");
+    EXPECT_EQ(DxfCaretEscape::unescape("no escapes"), "no escapes");
+    //A caret without a known escape after it is kept
+    EXPECT_EQ(DxfCaretEscape::unescape("x^2"), "x^2");
+    EXPECT_EQ(DxfCaretEscape::unescape("end^"), "end^");
+}
+
+TEST(DxfCaretEscapeTest, RoundTrip_GivesTheOriginalString)
+{
+    std::string all;
+    for (int c = 1; c < 128; ++c)
+    {
+        all.push_back((char) c);
+    }
+
+    for (const std::string &str: {std::string("a^^b"), std::string("^J^M^I^ "), std::string("\n\n\r\t^"), all,
+                                  std::string(100, '^')})
+    {
+        EXPECT_EQ(DxfCaretEscape::unescape(DxfCaretEscape::escape(str)), str);
+    }
+}
@@ -0,0 +1,211 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <cstdio>
+#include <dwg/CadDocument.h>
+#include <dwg/entities/Line.h>
+#include <dwg/entities/collection/EntityCollection.h>
+#include <dwg/header/CadHeader.h>
+#include <dwg/io/dxf/DxfReader.h>
+#include <dwg/io/dxf/DxfWriter.h>
+#include <dwg/tables/BlockRecord.h>
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dwg;
+
+namespace {
+
+//Stream buffer over a string that hands out the data in small pieces and counts the bytes read
+class CountingBuffer : public std::streambuf
+{
+public:
+    explicit CountingBuffer(std::string data) : _data(std::move(data))
+    {
+        setg(_data.data(), _data.data(), _data.data());
+    }
+
+    std::size_t bytesRead() const
+    {
+        return _bytesRead;
+    }
+
+protected:
+    int_type underflow() override
+    {
+        std::size_t position = gptr() - eback();
+        if (position >= _data.size())
+        {
+            return traits_type::eof();
+        }
+        std::size_t end = std::min(_data.size(), position + 4096);
+        _bytesRead = std::max(_bytesRead, end);
+        setg(_data.data(), _data.data() + position, _data.data() + end);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : _data.size();
+        return seekpos(base + off, which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+    {
+        if (pos < 0 || (std::size_t) pos > _data.size())
+        {
+            return pos_type(off_type(-1));
+        }
+        setg(_data.data(), _data.data() + pos, _data.data() + pos);
+        return pos;
+    }
+
+private:
+    std::string _data;
+    std::size_t _bytesRead = 0;
+};
+
+DxfHeaderSummary probeFile(const std::string &filename)
+{
+    std::fstream stream(filename, std::ios::in | std::ios::binary);
+    DxfReader reader(&stream);
+    DxfHeaderSummary summary = reader.probe();
+    stream.close();
+    std::remove(filename.c_str());
+    return summary;
+}
+
+void writeFile(const std::string &filename, const std::string &content)
+{
+    std::ofstream out(filename, std::ios::binary);
+    out << content;
+}
+
+std::string header(const std::string &variables)
+{
+    return "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1018\n  9\n$DWGCODEPAGE\n  3\nANSI_1251\n" + variables +
+           "  9\n$HANDSEED\n  5\n2A\n  0\nENDSEC\n";
+}
+
+void expectWrittenHeader(bool binary)
+{
+    const std::string filename = binary ? "DxfReaderTest_binary.dxf" : "DxfReaderTest_ascii.dxf";
+
+    CadDocument document;
+    document.header()->setModelSpaceExtMin(XYZ(-1.5, -2, 0));
+    document.header()->setModelSpaceExtMax(XYZ(100.25, 50, 3));
+    document.header()->setInsUnits(UnitsType::Millimeters);
+    document.modelSpace()->entities()->add(new Line());
+    {
+        DxfWriter writer(filename, &document, binary);
+        writer.addHeaderVariable("$EXTMIN");
+        writer.addHeaderVariable("$EXTMAX");
+        writer.write();
+    }
+
+    DxfHeaderSummary summary = probeFile(filename);
+    EXPECT_EQ(summary.isBinary, binary);
+    EXPECT_EQ(summary.version, document.header()->version());
+    EXPECT_EQ(summary.versionName, document.header()->versionString());
+    EXPECT_EQ(summary.codePage, document.header()->codePage());
+    EXPECT_EQ(summary.handleSeed, document.header()->handleSeed());
+    EXPECT_EQ(summary.insUnits, UnitsType::Millimeters);
+    EXPECT_EQ(summary.extMin, XYZ(-1.5, -2, 0));
+    EXPECT_EQ(summary.extMax, XYZ(100.25, 50, 3));
+}
+
+}// namespace
+
+TEST(DxfReaderTest, Probe_ReadsTheHeaderOfAnAsciiFile)
+{
+    expectWrittenHeader(false);
+}
+
+TEST(DxfReaderTest, Probe_ReadsTheHeaderOfABinaryFile)
+{
+    expectWrittenHeader(true);
+}
+
+TEST(DxfReaderTest, Probe_StopsAtTheEndOfTheHeader)
+{
+    //Nothing after the header is valid DXF, reading on would fail
+    std::string body;
+    while (body.size() < (8 << 20))
+    {
+        body += "not a group code\n";
+    }
+    CountingBuffer buffer(header("  9\n$INSUNITS\n 70\n4\n") + body);
+    std::fstream stream;
+    static_cast<std::ios &>(stream).rdbuf(&buffer);
+
+    DxfReader reader(&stream);
+    DxfHeaderSummary summary = reader.probe();
+    EXPECT_FALSE(summary.isBinary);
+    EXPECT_EQ(summary.version, ACadVersion::AC1018);
+    EXPECT_EQ(summary.versionName, "AC1018");
+    EXPECT_EQ(summary.codePage, "ANSI_1251");
+    EXPECT_EQ(summary.insUnits, UnitsType::Millimeters);
+    EXPECT_EQ(summary.handleSeed, 0x2A);
+
+    //The first block holds the whole header
+    EXPECT_LT(buffer.bytesRead(), 1 << 20);
+}
+
+TEST(DxfReaderTest, Probe_ReadsAHeaderLargerThanABlock)
+{
+    //Unknown variables push the last ones past the first blocks read
+    std::string variables;
+    for (int i = 0; variables.size() < 300000; ++i)
+    {
+        variables += "  9\n$UNKNOWN" + std::to_string(i) + "\n  1\nsome value\n";
+    }
+    variables += "  9\n$EXTMAX\n 10\n7.5\n 20\n8.5\n 30\n9.5\n";
+    writeFile("DxfReaderTest_large.dxf", header(variables) + "  0\nEOF\n");
+
+    DxfHeaderSummary summary = probeFile("DxfReaderTest_large.dxf");
+    EXPECT_EQ(summary.version, ACadVersion::AC1018);
+    EXPECT_EQ(summary.extMax, XYZ(7.5, 8.5, 9.5));
+    EXPECT_EQ(summary.handleSeed, 0x2A);
+}
+
+TEST(DxfReaderTest, Probe_KeepsTheDefaultsWithoutHeader)
+{
+    writeFile("DxfReaderTest_noheader.dxf", "  0\nSECTION\n  2\nENTITIES\n  0\nENDSEC\n  0\nEOF\n");
+
+    DxfHeaderSummary summary = probeFile("DxfReaderTest_noheader.dxf");
+    EXPECT_EQ(summary.version, ACadVersion::Unknown);
+    EXPECT_TRUE(summary.versionName.empty());
+    EXPECT_TRUE(summary.codePage.empty());
+    EXPECT_EQ(summary.handleSeed, 0);
+}
+
+TEST(DxfReaderTest, Probe_ReadsATruncatedHeader)
+{
+    writeFile("DxfReaderTest_truncated.dxf",
+              "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1015\n  9\n$DWGCODEPAGE\n  3\nANSI_1252\n");
+
+    DxfHeaderSummary summary = probeFile("DxfReaderTest_truncated.dxf");
+    EXPECT_EQ(summary.version, ACadVersion::AC1015);
+    EXPECT_EQ(summary.codePage, "ANSI_1252");
+}
@@ -0,0 +1,127 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/io/dxf/readers/DxfSectionIndex_p.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace dwg;
+
+namespace {
+
+std::string record(const std::string &name)
+{
+    return "  0\n" + name + "\n  8\n0\n";
+}
+
+std::string document(const std::string &entities)
+{
+    return "  0\nSECTION\n  2\nHEADER\n  9\n$ACADVER\n  1\nAC1015\n  9\n$DWGCODEPAGE\n  3\nANSI_1252\n  0\nENDSEC\n"
+           "  0\nSECTION\n  2\nENTITIES\n" +
+           entities + "  0\nENDSEC\n  0\nEOF\n";
+}
+
+std::string polyline(int vertices)
+{
+    std::string polyline = record("POLYLINE") + " 66\n1\n";
+    for (int i = 0; i < vertices; ++i)
+    {
+        polyline += record("VERTEX") + " 10\n" + std::to_string(i) + ".0\n 20\n0.0\n";
+    }
+    return polyline + record("SEQEND");
+}
+
+//Name of the record a chunk starts with
+std::string firstRecord(const std::string &data, std::size_t offset)
+{
+    std::size_t begin = data.find('\n', offset) + 1;
+    return data.substr(begin, data.find('\n', begin) - begin);
+}
+
+}// namespace
+
+TEST(DxfSectionIndexTest, Scan_FindsTheSectionRanges)
+{
+    std::string data = document(record("LINE"));
+    DxfSectionIndex index = DxfSectionIndex::Scan(data.data(), data.size());
+
+    ASSERT_EQ(index.sections().size(), 2);
+    EXPECT_EQ(index.acadVersion(), "AC1015");
+    EXPECT_EQ(index.codePage(), "ANSI_1252");
+
+    const DxfSectionRange *header = index.find("HEADER");
+    ASSERT_NE(header, nullptr);
+    EXPECT_EQ(header->begin, data.find("  2\nHEADER"));
+    EXPECT_EQ(header->end, data.find("ENDSEC\n") + 7);
+    EXPECT_TRUE(header->chunks.empty());
+
+    const DxfSectionRange *entities = index.find("ENTITIES");
+    ASSERT_NE(entities, nullptr);
+    EXPECT_EQ(entities->begin, data.find("  2\nENTITIES"));
+    EXPECT_EQ(entities->end, data.rfind("ENDSEC\n") + 7);
+    EXPECT_TRUE(entities->chunks.empty());
+
+    EXPECT_EQ(index.find("OBJECTS"), nullptr);
+}
+
+TEST(DxfSectionIndexTest, Scan_SplitsOnlyBeforeTopLevelRecords)
+{
+    std::string data = document(record("LINE") + polyline(2) + record("INSERT") + " 66\n1\n" + record("ATTRIB") +
+                                record("SEQEND") + record("CIRCLE"));
+    DxfSectionIndex index = DxfSectionIndex::Scan(data.data(), data.size(), 1);
+
+    const DxfSectionRange *entities = index.find("ENTITIES");
+    ASSERT_NE(entities, nullptr);
+
+    std::vector<std::string> names;
+    for (std::size_t offset: entities->chunks)
+    {
+        names.push_back(firstRecord(data, offset));
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"LINE", "POLYLINE", "INSERT", "CIRCLE"}));
+}
+
+TEST(DxfSectionIndexTest, Chunks_KeepThePolylineThatCrossesTheSize)
+{
+    std::string data = document(record("LINE") + polyline(100) + record("CIRCLE") + record("ARC"));
+
+    //The threshold is reached on the first vertices of the polyline
+    std::size_t chunkSize = data.find("VERTEX") - data.find("  2\nENTITIES");
+    DxfSectionIndex index = DxfSectionIndex::Scan(data.data(), data.size(), chunkSize);
+
+    const DxfSectionRange *entities = index.find("ENTITIES");
+    ASSERT_NE(entities, nullptr);
+
+    std::vector<DxfSectionRange> chunks = DxfSectionIndex::Chunks(*entities);
+    ASSERT_EQ(chunks.size(), 2);
+    EXPECT_EQ(firstRecord(data, chunks[1].begin), "CIRCLE");
+
+    std::string first = data.substr(chunks[0].begin, chunks[0].end - chunks[0].begin);
+    EXPECT_NE(first.find("POLYLINE"), std::string::npos);
+    EXPECT_NE(first.find("SEQEND"), std::string::npos);
+
+    //The chunks cover the section without gaps
+    EXPECT_EQ(chunks.front().begin, entities->begin);
+    EXPECT_EQ(chunks[0].end, chunks[1].begin);
+    EXPECT_EQ(chunks.back().end, entities->end);
+}
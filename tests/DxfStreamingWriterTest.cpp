@@ -0,0 +1,181 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <dwg/CadDocument.h>
+#include <dwg/entities/AttributeEntity.h>
+#include <dwg/entities/Insert.h>
+#include <dwg/entities/PolyLine.h>
+#include <dwg/entities/Seqend.h>
+#include <dwg/entities/Vertex.h>
+#include <dwg/entities/collection/AttributeEntitySeqendCollection.h>
+#include <dwg/entities/collection/VertexSeqendCollection.h>
+#include <dwg/header/CadHeader.h>
+#include <dwg/io/dxf/DxfStreamingWriter.h>
+#include <dwg/tables/BlockRecord.h>
+#include <dwg/tables/TextStyle.h>
+#include <dwg/tables/collections/TextStylesTable.h>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace dwg;
+
+namespace {
+
+//Group code and value pairs of an ASCII DXF file, both lines trimmed
+std::vector<std::pair<int, std::string>> readPairs(const std::string &filename)
+{
+    std::vector<std::pair<int, std::string>> pairs;
+    std::ifstream in(filename);
+    std::string code, value;
+    auto trim = [](std::string &s) {
+        s.erase(0, s.find_first_not_of(" \t\r"));
+        s.erase(s.find_last_not_of(" \t\r") + 1);
+    };
+    while (std::getline(in, code) && std::getline(in, value))
+    {
+        trim(code);
+        trim(value);
+        pairs.emplace_back(std::stoi(code), value);
+    }
+    return pairs;
+}
+
+//Entity names of the ENTITIES section with the handle of each record
+std::vector<std::pair<std::string, std::string>> readEntities(const std::string &filename)
+{
+    std::vector<std::pair<std::string, std::string>> entities;
+    auto pairs = readPairs(filename);
+    bool inEntities = false;
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        if (pairs[i].first == 2 && pairs[i].second == "ENTITIES")
+        {
+            inEntities = true;
+            continue;
+        }
+        if (!inEntities || pairs[i].first != 0)
+            continue;
+        if (pairs[i].second == "ENDSEC")
+            break;
+
+        std::string handle;
+        if (i + 1 < pairs.size() && pairs[i + 1].first == 5)
+            handle = pairs[i + 1].second;
+        entities.emplace_back(pairs[i].second, handle);
+    }
+    return entities;
+}
+
+}// namespace
+
+TEST(DxfStreamingWriterTest, Append_SubEntitiesGetUniqueHandles)
+{
+    const std::string filename = "DxfStreamingWriterTest_handles.dxf";
+    const int count = 50;
+
+    CadDocument document;
+    TextStyle *style = document.textStyles()->valueT<TextStyle *>(TextStyle::DefaultName);
+    {
+        DxfStreamingWriter writer(filename, false);
+        writer.open(&document);
+        for (int i = 0; i < count; ++i)
+        {
+            Polyline3D polyline;
+            Vertex3D v1, v2, v3;
+            polyline.vertices()->add({&v1, &v2, &v3});
+            writer.append(&polyline);
+
+            Insert insert(document.modelSpace());
+            AttributeEntity a1, a2;
+            a1.setStyle(style);
+            a2.setStyle(style);
+            insert.attributes()->add({&a1, &a2});
+            writer.append(&insert);
+
+            writer.appendLine(XYZ(0, 0, 0), XYZ(i, i, 0));
+
+            EXPECT_NE(v1.handle(), 0ULL);
+            EXPECT_NE(a2.handle(), 0ULL);
+            EXPECT_NE(insert.attributes()->seqend()->handle(), 0ULL);
+        }
+        writer.close();
+    }
+
+    std::map<std::string, int> counts;
+    std::set<std::string> handles;
+    for (auto &&[name, handle]: readEntities(filename))
+    {
+        ++counts[name];
+        EXPECT_FALSE(handle.empty()) << name;
+        EXPECT_NE(handle, "0") << name;
+        EXPECT_TRUE(handles.insert(handle).second) << name << " " << handle;
+    }
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(counts["POLYLINE"], count);
+    EXPECT_EQ(counts["VERTEX"], 3 * count);
+    EXPECT_EQ(counts["INSERT"], count);
+    EXPECT_EQ(counts["ATTRIB"], 2 * count);
+    EXPECT_EQ(counts["SEQEND"], 2 * count);
+    EXPECT_EQ(counts["LINE"], count);
+}
+
+TEST(DxfStreamingWriterTest, Open_KeepsHeaderHandleSeed)
+{
+    const std::string filename = "DxfStreamingWriterTest_seed.dxf";
+
+    CadDocument document;
+    const unsigned long long seed = document.header()->handleSeed();
+    {
+        DxfStreamingWriter writer(filename, false);
+        writer.open(&document);
+        writer.appendPoint(XYZ(1, 2, 3));
+        //Not closed, the destructor ends the file
+    }
+    EXPECT_EQ(document.header()->handleSeed(), seed);
+
+    auto pairs = readPairs(filename);
+    std::remove(filename.c_str());
+    ASSERT_FALSE(pairs.empty());
+    EXPECT_EQ(pairs.back(), std::make_pair(0, std::string("EOF")));
+}
+
+TEST(DxfStreamingWriterTest, AppendLine_ThrowsOnUnknownLayer)
+{
+    const std::string filename = "DxfStreamingWriterTest_layer.dxf";
+
+    CadDocument document;
+    {
+        DxfStreamingWriter writer(filename, false);
+        writer.open(&document);
+        EXPECT_THROW(writer.appendLine(XYZ(0, 0, 0), XYZ(1, 1, 0), "missing"), std::runtime_error);
+        EXPECT_NO_THROW(writer.appendLine(XYZ(0, 0, 0), XYZ(1, 1, 0), "0"));
+        writer.close();
+    }
+    std::remove(filename.c_str());
+}
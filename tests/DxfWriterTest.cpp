@@ -0,0 +1,230 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <dwg/CadDocument.h>
+#include <dwg/entities/Arc.h>
+#include <dwg/entities/Circle.h>
+#include <dwg/entities/Line.h>
+#include <dwg/entities/Point.h>
+#include <dwg/entities/collection/EntityCollection.h>
+#include <dwg/io/dxf/DxfWriter.h>
+#include <dwg/tables/BlockRecord.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <string>
+
+using namespace dwg;
+
+namespace {
+
+//Values of the first LINE record of the ENTITIES section by group code, lines trimmed
+std::map<int, std::string> readLine(const std::string &filename)
+{
+    std::map<int, std::string> values;
+    std::ifstream in(filename);
+    std::string code, value;
+    auto trim = [](std::string &s) {
+        s.erase(0, s.find_first_not_of(" \t\r"));
+        s.erase(s.find_last_not_of(" \t\r") + 1);
+    };
+
+    bool inEntities = false;
+    bool inLine = false;
+    while (std::getline(in, code) && std::getline(in, value))
+    {
+        trim(code);
+        trim(value);
+        int c = std::stoi(code);
+        if (c == 2 && value == "ENTITIES")
+        {
+            inEntities = true;
+        }
+        else if (inEntities && c == 0)
+        {
+            if (inLine)
+            {
+                break;
+            }
+            inLine = value == "LINE";
+        }
+        else if (inLine)
+        {
+            values[c] = value;
+        }
+    }
+    return values;
+}
+
+std::map<int, std::string> writeLine(const std::string &filename, const XYZ &start, const XYZ &end,
+                                     int doublePrecision = -1)
+{
+    CadDocument document;
+    Line *line = new Line();
+    line->setStartPoint(start);
+    line->setEndPoint(end);
+    document.modelSpace()->entities()->add(line);
+    {
+        DxfWriter writer(filename, &document, false);
+        writer.setDoublePrecision(doublePrecision);
+        writer.write();
+    }
+
+    std::map<int, std::string> values = readLine(filename);
+    std::remove(filename.c_str());
+    return values;
+}
+
+//Model space with lines, circles, arcs and points in turn
+void addEntities(CadDocument &document, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        double d = i * 0.37;
+        switch (i % 4)
+        {
+            case 0:
+            {
+                Line *line = new Line();
+                line->setStartPoint(XYZ(d, -d, 0));
+                line->setEndPoint(XYZ(d * 2, d / 3, 1));
+                document.modelSpace()->entities()->add(line);
+                break;
+            }
+            case 1:
+            {
+                Circle *circle = new Circle();
+                circle->setCenter(XYZ(d, d, d));
+                circle->setRadius(1 + d);
+                document.modelSpace()->entities()->add(circle);
+                break;
+            }
+            case 2:
+            {
+                Arc *arc = new Arc();
+                arc->setCenter(XYZ(-d, d, 0));
+                arc->setRadius(2 + d);
+                arc->setStartAngle(d / 10);
+                arc->setEndAngle(d / 5);
+                document.modelSpace()->entities()->add(arc);
+                break;
+            }
+            default:
+            {
+                Point *point = new Point();
+                point->setLocation(XYZ(d, 0, -d));
+                document.modelSpace()->entities()->add(point);
+                break;
+            }
+        }
+    }
+}
+
+std::string writeDocument(const std::string &filename, CadDocument &document, bool binary, int sectionThreads)
+{
+    {
+        DxfWriter writer(filename, &document, binary);
+        writer.setSectionThreads(sectionThreads);
+        writer.write();
+    }
+
+    std::ifstream in(filename, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::remove(filename.c_str());
+    return bytes;
+}
+
+bool sameBits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+}// namespace
+
+TEST(DxfWriterTest, Ascii_WritesShortestRoundTripDoubles)
+{
+    const XYZ start(0.1, 1.0 / 3.0, -2.5);
+    const XYZ end(1e-7, 123456.789, 1e300);
+    std::map<int, std::string> values = writeLine("DxfWriterTest_shortest.dxf", start, end);
+
+    EXPECT_EQ(values[10], "0.1");
+    EXPECT_EQ(values[20], "0.3333333333333333");
+    EXPECT_EQ(values[30], "-2.5");
+    EXPECT_EQ(values[21], "123456.789");
+
+    EXPECT_TRUE(sameBits(std::stod(values[10]), start.X));
+    EXPECT_TRUE(sameBits(std::stod(values[20]), start.Y));
+    EXPECT_TRUE(sameBits(std::stod(values[30]), start.Z));
+    EXPECT_TRUE(sameBits(std::stod(values[11]), end.X));
+    EXPECT_TRUE(sameBits(std::stod(values[21]), end.Y));
+    EXPECT_TRUE(sameBits(std::stod(values[31]), end.Z));
+}
+
+TEST(DxfWriterTest, Ascii_WritesFixedPrecisionWithoutTrailingZeros)
+{
+    std::map<int, std::string> values = writeLine("DxfWriterTest_fixed.dxf", XYZ(0.1, 1.0 / 3.0, -2.5),
+                                                  XYZ(-1e-7, 123456.789, 1e300), 3);
+
+    EXPECT_EQ(values[10], "0.1");
+    EXPECT_EQ(values[20], "0.333");
+    EXPECT_EQ(values[30], "-2.5");
+    EXPECT_EQ(values[11], "0");
+    EXPECT_EQ(values[21], "123456.789");
+    //Too large for the fixed notation, written in the shortest form
+    EXPECT_NE(values[31].find('e'), std::string::npos);
+    EXPECT_TRUE(sameBits(std::stod(values[31]), 1e300));
+}
+
+TEST(DxfWriterTest, Ascii_ParallelSectionsWriteTheSameBytes)
+{
+    CadDocument document;
+    addEntities(document, 403);
+
+    std::string serial = writeDocument("DxfWriterTest_serial.dxf", document, false, 1);
+    ASSERT_NE(serial.find("CIRCLE"), std::string::npos);
+    ASSERT_NE(serial.find("POINT"), std::string::npos);
+
+    for (int threads: {2, 3, 8})
+    {
+        std::string parallel = writeDocument("DxfWriterTest_parallel.dxf", document, false, threads);
+        EXPECT_TRUE(parallel == serial) << threads << " threads";
+    }
+}
+
+TEST(DxfWriterTest, Binary_ParallelSectionsWriteTheSameBytes)
+{
+    CadDocument document;
+    addEntities(document, 403);
+
+    std::string serial = writeDocument("DxfWriterTest_serial.dxf", document, true, 1);
+    ASSERT_EQ(serial.compare(0, 18, "AutoCAD Binary DXF"), 0);
+
+    for (int threads: {2, 3, 8})
+    {
+        std::string parallel = writeDocument("DxfWriterTest_parallel.dxf", document, true, threads);
+        EXPECT_TRUE(parallel == serial) << threads << " threads";
+    }
+}
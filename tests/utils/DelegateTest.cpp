@@ -0,0 +1,127 @@
+/**
+ * libDWG - A C++ library for reading and writing DWG and DXF files in CAD.
+ *
+ * This file is part of libDWG.
+ *
+ * libDWG is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * libDWG is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * For more information, visit the project's homepage or contact the author.
+ */
+
+#include <atomic>
+#include <dwg/utils/Delegate.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace dwg;
+
+namespace {
+
+struct Listener
+{
+    Delegate<void(int)> *event = nullptr;
+    Listener *other = nullptr;
+    std::atomic<int> calls{0};
+
+    void count(int)
+    {
+        ++calls;
+    }
+
+    void addOther(int)
+    {
+        ++calls;
+        event->add(other, &Listener::count);
+    }
+
+    void removeBoth(int)
+    {
+        ++calls;
+        event->remove(this, &Listener::removeBoth);
+        event->remove(other, &Listener::count);
+    }
+};
+
+}// namespace
+
+TEST(DelegateTest, AddDuringDispatch_RunsFromTheNextDispatch)
+{
+    Delegate<void(int)> event;
+    Listener adder;
+    Listener added;
+    adder.event = &event;
+    adder.other = &added;
+    event.add(&adder, &Listener::addOther);
+
+    event(1);
+    EXPECT_EQ(adder.calls, 1);
+    EXPECT_EQ(added.calls, 0);
+
+    event(2);
+    EXPECT_EQ(adder.calls, 2);
+    EXPECT_EQ(added.calls, 1);
+}
+
+TEST(DelegateTest, RemoveDuringDispatch_FinishesTheCurrentDispatch)
+{
+    Delegate<void(int)> event;
+    Listener remover;
+    Listener removed;
+    remover.event = &event;
+    remover.other = &removed;
+    event.add(&remover, &Listener::removeBoth);
+    event.add(&removed, &Listener::count);
+
+    event(1);
+    EXPECT_EQ(remover.calls, 1);
+    EXPECT_EQ(removed.calls, 1);
+
+    event(2);
+    EXPECT_EQ(remover.calls, 1);
+    EXPECT_EQ(removed.calls, 1);
+}
+
+TEST(DelegateTest, ConcurrentDispatch_WhileSubscribing)
+{
+    Delegate<void(int)> event;
+    Listener steady;
+    Listener toggled;
+    event.add(&steady, &Listener::count);
+
+    const int dispatches = 20000;
+    std::vector<std::thread> invokers;
+    for (int t = 0; t < 4; ++t)
+    {
+        invokers.emplace_back([&event]() {
+            for (int i = 0; i < dispatches; ++i)
+            {
+                event(i);
+            }
+        });
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        event.add(&toggled, &Listener::count);
+        event.remove(&toggled, &Listener::count);
+    }
+
+    for (std::thread &invoker: invokers)
+    {
+        invoker.join();
+    }
+    EXPECT_EQ(steady.calls, 4 * dispatches);
+}
@@ -32,28 +32,28 @@ TEST(StringTest, Replace) {
 }
 
 TEST(StringTest, Parse) {
-    EXPECT_EQ(StringHelp::parse("123"), 123);
-    EXPECT_EQ(StringHelp::parse("-456"), -456);
-    EXPECT_EQ(StringHelp::parse("0"), 0);
+    EXPECT_EQ(StringHelp::parse32("123"), 123);
+    EXPECT_EQ(StringHelp::parse32("-456"), -456);
+    EXPECT_EQ(StringHelp::parse32("0"), 0);
 }
 
 TEST(StringTest, TryParse) {
     int value = 0;
-    EXPECT_TRUE(StringHelp::tryParse("123", value));
+    EXPECT_TRUE(StringHelp::tryParse32("123", value));
     EXPECT_EQ(value, 123);
-    EXPECT_FALSE(StringHelp::tryParse("abc", value));
+    EXPECT_FALSE(StringHelp::tryParse32("abc", value));
 }
 
 TEST(StringTest, ParseUnsigned) {
-    EXPECT_EQ(StringHelp::parseUnsigned("123"), 123u);
-    EXPECT_EQ(StringHelp::parseUnsigned("0"), 0u);
+    EXPECT_EQ(StringHelp::parseUnsigned32("123"), 123u);
+    EXPECT_EQ(StringHelp::parseUnsigned32("0"), 0u);
 }
 
 TEST(StringTest, TryParseUnsigned) {
     unsigned int value = 0;
-    EXPECT_TRUE(StringHelp::tryParseUnsigned("123", value));
+    EXPECT_TRUE(StringHelp::tryParseUnsigned32("123", value));
     EXPECT_EQ(value, 123u);
-    EXPECT_FALSE(StringHelp::tryParseUnsigned("-1", value));
+    EXPECT_FALSE(StringHelp::tryParseUnsigned32("-1", value));
 }
 
 TEST(StringTest, Parse64) {
@@ -90,6 +90,24 @@ TEST(StringTest, TryParseHex64) {
     EXPECT_FALSE(StringHelp::tryParseHex64("G12345", value));
 }
 
+TEST(StringTest, TryParseStringView) {
+    std::string_view line = "  330\n";
+    int code = 0;
+    EXPECT_TRUE(StringHelp::tryParse32(line.substr(0, 5), code));
+    EXPECT_EQ(code, 330);
+
+    unsigned long long handle = 0;
+    EXPECT_TRUE(StringHelp::tryParseHex64(std::string_view("1F"), handle));
+    EXPECT_EQ(handle, 0x1FULL);
+    EXPECT_TRUE(StringHelp::tryParseHex64("0x1F", handle));
+    EXPECT_EQ(handle, 0x1FULL);
+
+    unsigned char flag = 0;
+    EXPECT_TRUE(StringHelp::tryParseUnsigned8("1", flag));
+    EXPECT_EQ(flag, 1);
+    EXPECT_FALSE(StringHelp::tryParseUnsigned8("-1", flag));
+}
+
 TEST(StringTest, ParseFloat) {
     EXPECT_EQ(StringHelp::parseFloat("123.45"), 123.45);
     EXPECT_EQ(StringHelp::parseFloat("-1.23"), -1.23);